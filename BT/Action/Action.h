@@ -1,7 +1,10 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 #include "../Node.h"
 
@@ -32,4 +35,23 @@ namespace bt
         ActionFunction action_func_;
     };
 
+    // 호출 객체 타입을 그대로 갖는 Action 노드 (std::function 타입 소거/힙 할당 없음, 호출이 인라인됨)
+    template <typename F>
+    class ActionT final : public Node
+    {
+    public:
+        ActionT(const std::string& name, F func) : Node(name, NodeType::ACTION), func_(std::move(func)) {}
+
+        NodeStatus Execute(Context& context) override { return func_(context); }
+
+    private:
+        F func_;
+    };
+
+    template <typename F>
+    std::shared_ptr<ActionT<std::decay_t<F>>> MakeAction(const std::string& name, F&& func)
+    {
+        return std::make_shared<ActionT<std::decay_t<F>>>(name, std::forward<F>(func));
+    }
+
 } // namespace bt
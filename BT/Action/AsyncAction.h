@@ -0,0 +1,95 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "../Context.h"
+#include "../Node.h"
+#include "../ThreadPool.h"
+
+namespace bt
+{
+
+    // 비동기 Action 노드 (경로 탐색, 시야 판정처럼 오래 걸리는 작업을 틱 밖에서 실행)
+    // 첫 틱에 작업을 시작하고 결과가 나올 때까지 RUNNING을 반환하며, 에이전트 틱을 막지 않는다.
+    // 진행 중인 작업은 에이전트의 TreeState에 노드 id별 리소스로 보관되므로 트리를 여러 에이전트가 공유해도 된다.
+    // 실행이 중단되면(Halt) 작업에 취소를 표시하고 결과를 버린다.
+    class AsyncAction : public Node
+    {
+    public:
+        // 틱 스레드에서 호출: 에이전트 상태에서 입력을 읽고 작업을 시작해 결과 future를 반환
+        // (future가 소멸 시 대기하면 안 되므로 std::async 대신 promise나 JobPool::Submit을 사용)
+        using Launcher = std::function<std::future<NodeStatus>(Context&, const CancelToken&)>;
+
+        // 작업 풀에서 실행되는 본체 (Context에 접근하지 않는다, 필요한 입력은 Prepare에서 복사)
+        using Job = std::function<NodeStatus(const CancelToken&)>;
+
+        AsyncAction(const std::string& name, Launcher launcher)
+            : Node(name, NodeType::ACTION), launcher_(std::move(launcher))
+        {
+        }
+
+        // prepare가 틱 스레드에서 만든 작업을 pool에서 실행
+        static std::shared_ptr<AsyncAction> OnPool(const std::string&               name,
+                                                   JobPool&                         pool,
+                                                   std::function<Job(Context&)>     prepare)
+        {
+            return std::make_shared<AsyncAction>(
+                name,
+                [&pool, prepare = std::move(prepare)](Context& context, const CancelToken& token)
+                {
+                    Job job = prepare(context);
+                    if (!job)
+                        return std::future<NodeStatus>();
+                    return pool.Submit([job = std::move(job), token]() { return job(token); });
+                });
+        }
+
+        NodeStatus Execute(Context& context) override
+        {
+            TreeState& state = context.GetTreeState();
+            AsyncTask* task  = state.FindResource<AsyncTask>(id_);
+            if (!task)
+            {
+                if (!launcher_)
+                    return NodeStatus::FAILURE;
+
+                CancelToken             token(std::make_shared<std::atomic<bool>>(false));
+                std::future<NodeStatus> result = launcher_(context, token);
+                if (!result.valid())
+                    return NodeStatus::FAILURE; // 시작하지 않음
+                auto started    = std::make_unique<AsyncTask>();
+                started->result = std::move(result);
+                started->token  = std::move(token);
+                task            = &state.AttachResource(id_, std::move(started));
+            }
+
+            if (task->result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                return NodeStatus::RUNNING;
+            }
+
+            NodeStatus status = NodeStatus::FAILURE;
+            try
+            {
+                status = task->result.get();
+            }
+            catch (...)
+            {
+                // 작업에서 던진 예외나 버려진 작업은 실패로 처리
+            }
+            state.ReleaseResource(id_);
+            return status;
+        }
+
+        void Halt(Context& context) override { context.GetTreeState().ReleaseResource(id_); }
+
+    private:
+        Launcher launcher_;
+    };
+
+} // namespace bt
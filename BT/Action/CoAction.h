@@ -0,0 +1,248 @@
+#pragma once
+
+// 코루틴 Action 노드 (C++20 코루틴을 지원하는 컴파일러에서만 정의, BT_HAS_COROUTINES로 확인)
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#define BT_HAS_COROUTINES 1
+
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "../Context.h"
+#include "../FrameArena.h"
+#include "../Node.h"
+
+namespace bt
+{
+
+    // 다음 틱까지 대기 (co_await NextTick())
+    struct NextTick
+    {
+    };
+
+    // 지정한 시간 동안 대기 (co_await Sleep(dt)), 대기 중에는 본체를 재개하지 않고 깨어날 시각을 스케줄러에 알린다
+    struct Sleep
+    {
+        template <typename Rep, typename Period>
+        explicit Sleep(std::chrono::duration<Rep, Period> duration)
+            : duration(std::chrono::duration_cast<std::chrono::steady_clock::duration>(duration))
+        {
+        }
+
+        std::chrono::steady_clock::duration duration;
+    };
+
+    // 코루틴 본체의 반환 타입 (co_return NodeStatus::SUCCESS 등으로 끝낸다)
+    // CoAction이 시작한 본체의 프레임은 에이전트의 FrameArena에서 할당된다.
+    class CoTask
+    {
+    public:
+        struct promise_type
+        {
+            NodeStatus                            status = NodeStatus::FAILURE;
+            std::exception_ptr                    error;
+            std::chrono::steady_clock::time_point wake_time; // Sleep 대기 중이면 깨어날 시각
+            bool                                  sleeping  = false;
+            bool (*poll)(void*)                             = nullptr; // future 대기 중이면 준비 여부 확인 함수
+            void*                                 poll_arg  = nullptr;
+
+            CoTask              get_return_object() { return CoTask(Handle::from_promise(*this)); }
+            std::suspend_always initial_suspend() noexcept { return {}; } // 첫 재개는 CoAction::Execute에서
+            std::suspend_always final_suspend() noexcept { return {}; }
+            void                return_value(NodeStatus result) { status = result; }
+            void                unhandled_exception() { error = std::current_exception(); }
+
+            // 프레임 할당: CoAction이 본체를 시작하는 동안 지정한 에이전트 아레나 (그 밖에서 만들면 전역 힙)
+            static void* operator new(std::size_t size) { return FrameArena::Allocate(FrameArena::Current(), size); }
+            static void  operator delete(void* ptr) { FrameArena::Deallocate(ptr); }
+
+            auto await_transform(NextTick) { return std::suspend_always{}; }
+
+            auto await_transform(Sleep sleep)
+            {
+                struct Awaiter
+                {
+                    promise_type&                       promise;
+                    std::chrono::steady_clock::duration duration;
+
+                    bool await_ready() const noexcept { return duration <= std::chrono::steady_clock::duration::zero(); }
+                    void await_suspend(Handle) noexcept
+                    {
+                        promise.wake_time = std::chrono::steady_clock::now() + duration;
+                        promise.sleeping  = true;
+                    }
+                    void await_resume() const noexcept {}
+                };
+                return Awaiter{*this, sleep.duration};
+            }
+
+            // co_await future: 준비될 때까지 매 틱 확인만 하고, 준비되면 결과(get)를 돌려준다
+            template <typename T>
+            auto await_transform(std::future<T>& future)
+            {
+                return FutureAwaiter<T, std::future<T>&>{*this, future};
+            }
+            template <typename T>
+            auto await_transform(std::future<T>&& future)
+            {
+                return FutureAwaiter<T, std::future<T>>{*this, std::move(future)};
+            }
+        };
+
+        using Handle = std::coroutine_handle<promise_type>;
+
+        CoTask() = default;
+        CoTask(CoTask&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+        CoTask& operator=(CoTask&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Destroy();
+                handle_ = std::exchange(other.handle_, nullptr);
+            }
+            return *this;
+        }
+        ~CoTask() { Destroy(); } // 끝나기 전에 소멸하면 본체의 지역 객체도 정리된다
+
+        explicit operator bool() const { return static_cast<bool>(handle_); }
+        bool          IsDone() const { return handle_.done(); }
+        promise_type& GetPromise() const { return handle_.promise(); }
+
+        // 대기 조건이 풀렸으면 본체를 재개 (끝나면 true)
+        // 대기 중이면 재개하지 않는다. Sleep 대기는 깨어날 시각을 context에 알린다.
+        bool Resume(Context& context)
+        {
+            promise_type& promise = handle_.promise();
+            if (promise.sleeping)
+            {
+                if (context.GetFrameTime() < promise.wake_time)
+                {
+                    context.RequestWakeAt(promise.wake_time);
+                    return false;
+                }
+                promise.sleeping = false;
+            }
+            if (promise.poll)
+            {
+                if (!promise.poll(promise.poll_arg))
+                    return false;
+                promise.poll = nullptr;
+            }
+
+            handle_.resume();
+            if (promise.sleeping && !handle_.done())
+            {
+                context.RequestWakeAt(promise.wake_time);
+            }
+            return handle_.done();
+        }
+
+    private:
+        template <typename T, typename Future>
+        struct FutureAwaiter
+        {
+            promise_type& promise;
+            Future        future;
+
+            static bool Ready(void* self)
+            {
+                auto& awaiter = *static_cast<FutureAwaiter*>(self);
+                return awaiter.future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+            }
+
+            bool await_ready() { return Ready(this); }
+            void await_suspend(Handle) noexcept
+            {
+                promise.poll     = &FutureAwaiter::Ready;
+                promise.poll_arg = this;
+            }
+            T await_resume() { return future.get(); }
+        };
+
+        explicit CoTask(Handle handle) : handle_(handle) {}
+
+        void Destroy()
+        {
+            if (handle_)
+            {
+                handle_.destroy();
+                handle_ = nullptr;
+            }
+        }
+
+        Handle handle_;
+    };
+
+    // 코루틴 Action 노드
+    // 여러 틱에 걸친 행동을 상태 기계 대신 하나의 코루틴 본체로 작성한다. 본체는 에이전트마다 따로 시작되어
+    // 에이전트의 TreeState에 노드 id별 리소스로 보관되고, 끝나면(co_return) 그 결과를 반환한다.
+    // 실행이 중단되면(Halt, 상위 노드의 선점, 트리 상태 초기화) 코루틴 프레임을 파괴해 지역 객체를 정리한다.
+    //
+    //   auto patrol = std::make_shared<CoAction>("patrol", [](Context& context) -> CoTask {
+    //       while (!Arrived(context)) { Step(context); co_await NextTick(); }
+    //       co_await Sleep(std::chrono::seconds(2));
+    //       co_return NodeStatus::SUCCESS;
+    //   });
+    class CoAction : public Node
+    {
+    public:
+        using Body = std::function<CoTask(Context&)>;
+
+        CoAction(const std::string& name, Body body) : Node(name, NodeType::ACTION), body_(std::move(body)) {}
+
+        NodeStatus Execute(Context& context) override
+        {
+            TreeState& state = context.GetTreeState();
+            Frame*     frame = state.FindResource<Frame>(id_);
+            if (!frame)
+            {
+                if (!body_)
+                    return NodeStatus::FAILURE;
+
+                FrameArena::Scope scope(&state.GetFrameArena()); // 코루틴 프레임과 보관용 Frame 모두 아레나에서
+                CoTask            task = body_(context);
+                if (!task)
+                    return NodeStatus::FAILURE;
+                frame = &state.AttachResource(id_, std::make_unique<Frame>(std::move(task)));
+            }
+
+            if (!frame->task.Resume(context))
+            {
+                return NodeStatus::RUNNING;
+            }
+
+            NodeStatus         status = frame->task.GetPromise().status;
+            std::exception_ptr error  = frame->task.GetPromise().error;
+            state.ReleaseResource(id_);
+            if (error)
+            {
+                std::rethrow_exception(error); // 일반 Execute에서 던진 것처럼 호출자에게 전달
+            }
+            return status;
+        }
+
+        void Halt(Context& context) override { context.GetTreeState().ReleaseResource(id_); }
+
+    private:
+        struct Frame : NodeResource
+        {
+            explicit Frame(CoTask task) : task(std::move(task)) {}
+
+            static void* operator new(std::size_t size) { return FrameArena::Allocate(FrameArena::Current(), size); }
+            static void  operator delete(void* ptr) { FrameArena::Deallocate(ptr); }
+
+            CoTask task;
+        };
+
+        Body body_;
+    };
+
+} // namespace bt
+
+#endif
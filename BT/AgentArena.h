@@ -0,0 +1,248 @@
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace bt
+{
+
+    // 에이전트별 메모리 아레나 (Context의 트리 상태, 블랙보드 슬롯, 인터페이스 표, 코루틴 프레임 청크)
+    // 2의 거듭제곱 크기 구간별 해제 목록을 두고 새 블록은 연속된 청크에서 잘라 쓴다. 한 에이전트의 틱 상태가
+    // 몇 개의 청크에 모이므로 틱 중 접근이 지역적이고, 정상 상태에서는 전역 힙을 거치지 않는다.
+    // 한 에이전트(한 틱 스레드)만 사용하므로 잠금이 없다. Reset은 청크를 유지한 채 비워 다음 에이전트에 넘긴다.
+    class AgentArena : public std::pmr::memory_resource
+    {
+    public:
+        static constexpr size_t kDefaultChunkSize = 16 * 1024;
+        static constexpr size_t kMinBlock         = 16;
+        static constexpr size_t kClassCount      = 13; // 16B ~ 64KB, 그보다 크면 상위 할당기
+
+        explicit AgentArena(size_t                     chunk_size = kDefaultChunkSize,
+                            std::pmr::memory_resource* upstream   = std::pmr::new_delete_resource())
+            : chunk_size_(chunk_size < kMinBlock ? kMinBlock : chunk_size), upstream_(upstream)
+        {
+        }
+
+        ~AgentArena() override
+        {
+            for (const Chunk& chunk : chunks_)
+            {
+                upstream_->deallocate(chunk.data, chunk.size, alignof(std::max_align_t));
+            }
+        }
+
+        AgentArena(const AgentArena&)            = delete;
+        AgentArena& operator=(const AgentArena&) = delete;
+
+        // 모든 블록을 버리고 처음 청크부터 다시 쓴다 (이 아레나에서 할당한 객체가 모두 소멸한 뒤 호출)
+        void Reset()
+        {
+            for (auto& head : free_)
+            {
+                head = nullptr;
+            }
+            chunk_index_ = 0;
+            cursor_      = chunks_.empty() ? nullptr : chunks_[0].data;
+            remaining_   = chunks_.empty() ? 0 : chunks_[0].size;
+            bytes_in_use_ = 0;
+        }
+
+        // 통계
+        size_t GetChunkCount() const { return chunks_.size(); }
+        size_t GetReservedBytes() const
+        {
+            size_t total = 0;
+            for (const Chunk& chunk : chunks_)
+            {
+                total += chunk.size;
+            }
+            return total;
+        }
+        size_t GetBytesInUse() const { return bytes_in_use_; }
+
+        // ptr이 이 아레나의 청크 안에 있는지 (디버그/검증용)
+        bool Contains(const void* ptr) const
+        {
+            auto* byte = static_cast<const std::byte*>(ptr);
+            for (const Chunk& chunk : chunks_)
+            {
+                if (byte >= chunk.data && byte < chunk.data + chunk.size)
+                    return true;
+            }
+            return false;
+        }
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            uint32_t size_class = SizeClass(bytes);
+            if (size_class >= kClassCount || alignment > alignof(std::max_align_t))
+            {
+                return upstream_->allocate(bytes, alignment);
+            }
+
+            size_t block_size = kMinBlock << size_class;
+            bytes_in_use_ += block_size;
+            if (FreeBlock* block = free_[size_class])
+            {
+                free_[size_class] = block->next;
+                return block;
+            }
+            return Carve(block_size);
+        }
+
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override
+        {
+            uint32_t size_class = SizeClass(bytes);
+            if (size_class >= kClassCount || alignment > alignof(std::max_align_t))
+            {
+                upstream_->deallocate(ptr, bytes, alignment);
+                return;
+            }
+
+            bytes_in_use_ -= kMinBlock << size_class;
+            auto* block       = static_cast<FreeBlock*>(ptr);
+            block->next       = free_[size_class];
+            free_[size_class] = block;
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        struct Chunk
+        {
+            std::byte* data;
+            size_t     size;
+        };
+
+        static uint32_t SizeClass(size_t bytes)
+        {
+            uint32_t size_class = 0;
+            size_t   block      = kMinBlock;
+            while (block < bytes)
+            {
+                block <<= 1;
+                size_class++;
+            }
+            return size_class;
+        }
+
+        // 블록 크기가 모두 16의 배수이므로 청크 안의 블록은 max_align_t 정렬을 유지한다
+        void* Carve(size_t block_size)
+        {
+            while (remaining_ < block_size)
+            {
+                // Reset 뒤에는 기존 청크를 순서대로 재사용하고, 모자라면 새 청크를 붙인다 (남은 자투리는 버린다)
+                if (!chunks_.empty() && chunk_index_ + 1 < chunks_.size())
+                {
+                    chunk_index_++;
+                }
+                else
+                {
+                    size_t size = block_size > chunk_size_ ? block_size : chunk_size_;
+                    chunks_.push_back({static_cast<std::byte*>(upstream_->allocate(size, alignof(std::max_align_t))),
+                                       size});
+                    chunk_index_ = chunks_.size() - 1;
+                }
+                cursor_    = chunks_[chunk_index_].data;
+                remaining_ = chunks_[chunk_index_].size;
+            }
+
+            void* block = cursor_;
+            cursor_ += block_size;
+            remaining_ -= block_size;
+            return block;
+        }
+
+        size_t                     chunk_size_;
+        std::pmr::memory_resource* upstream_;
+        FreeBlock*                 free_[kClassCount] = {};
+        std::vector<Chunk>         chunks_;
+        size_t                     chunk_index_  = 0;
+        std::byte*                 cursor_       = nullptr;
+        size_t                     remaining_    = 0;
+        size_t                     bytes_in_use_ = 0;
+    };
+
+    // 아레나 재사용 풀 (몬스터가 사라지면 아레나를 비워 해제 목록에 두고, 다음 스폰에 그대로 넘긴다)
+    // Acquire가 돌려준 포인터가 마지막으로 해제될 때 아레나가 풀로 돌아간다. 풀이 먼저 소멸해도 안전하다.
+    class AgentArenaPool
+    {
+    public:
+        explicit AgentArenaPool(size_t chunk_size = AgentArena::kDefaultChunkSize, size_t max_free = 1024)
+            : shared_(std::make_shared<Shared>())
+        {
+            shared_->chunk_size = chunk_size;
+            shared_->max_free   = max_free;
+        }
+
+        std::shared_ptr<AgentArena> Acquire()
+        {
+            std::unique_ptr<AgentArena> arena;
+            {
+                std::lock_guard<std::mutex> lock(shared_->mutex);
+                if (!shared_->free.empty())
+                {
+                    arena = std::move(shared_->free.back());
+                    shared_->free.pop_back();
+                    shared_->reused++;
+                }
+            }
+            if (!arena)
+            {
+                arena = std::make_unique<AgentArena>(shared_->chunk_size);
+            }
+
+            std::weak_ptr<Shared> owner = shared_;
+            return std::shared_ptr<AgentArena>(arena.release(),
+                                               [owner](AgentArena* released)
+                                               {
+                                                   std::unique_ptr<AgentArena> recycled(released);
+                                                   auto                        shared = owner.lock();
+                                                   if (!shared)
+                                                       return;
+                                                   recycled->Reset();
+                                                   std::lock_guard<std::mutex> lock(shared->mutex);
+                                                   if (shared->free.size() < shared->max_free)
+                                                   {
+                                                       shared->free.push_back(std::move(recycled));
+                                                   }
+                                               });
+        }
+
+        // 통계
+        size_t GetFreeCount() const
+        {
+            std::lock_guard<std::mutex> lock(shared_->mutex);
+            return shared_->free.size();
+        }
+        size_t GetReuseCount() const
+        {
+            std::lock_guard<std::mutex> lock(shared_->mutex);
+            return shared_->reused;
+        }
+
+    private:
+        struct Shared
+        {
+            std::mutex                               mutex;
+            std::vector<std::unique_ptr<AgentArena>> free;
+            size_t                                   chunk_size = AgentArena::kDefaultChunkSize;
+            size_t                                   max_free   = 0;
+            size_t                                   reused     = 0;
+        };
+
+        std::shared_ptr<Shared> shared_;
+    };
+
+} // namespace bt
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <string>
+
+#include "Context.h"
+#include "Node.h"
+
+namespace bt
+{
+
+    // 에이전트 타입이 정해진 리프 노드의 기반 클래스
+    // 실행자가 틱 전에 Context::SetAgent로 넘긴 에이전트를 참조로 받아 실행한다. GetAI() + dynamic_pointer_cast와 달리
+    // 참조 카운트 증감이나 RTTI 탐색 없이 타입 태그 비교 한 번으로 끝난다. 에이전트가 없거나 타입이 다르면 FAILURE.
+    //
+    //   class HasTarget : public AgentNode<Monster>
+    //   {
+    //       NodeStatus ExecuteAgent(Monster& monster, Context&) override { ... }
+    //   };
+    template <typename TAgent>
+    class AgentNode : public Node
+    {
+    public:
+        AgentNode(const std::string& name, NodeType type) : Node(name, type) {}
+
+        NodeStatus Execute(Context& context) final
+        {
+            TAgent* agent = context.GetAgent<TAgent>();
+            return agent ? ExecuteAgent(*agent, context) : NodeStatus::FAILURE;
+        }
+
+    protected:
+        virtual NodeStatus ExecuteAgent(TAgent& agent, Context& context) = 0;
+    };
+
+} // namespace bt
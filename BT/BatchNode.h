@@ -0,0 +1,114 @@
+#pragma once
+
+#include <string>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "AgentNode.h"
+#include "Context.h"
+#include "Node.h"
+
+namespace bt
+{
+
+    // 여러 에이전트를 한 번에 실행할 수 있는 리프 (CompiledTree::ExecuteBatch가 노드당 한 번 호출)
+    // contexts는 배치 전체, slots[0..count)는 이번에 이 노드에 도달한 에이전트의 인덱스다.
+    // 각 에이전트의 결과를 statuses[slot]에 기록한다. 노드 상태 기록/스케줄링 표시는 호출하는 쪽이 한다.
+    class IBatchLeaf
+    {
+    public:
+        virtual ~IBatchLeaf() = default;
+
+        virtual void ExecuteBatch(Context* const* contexts,
+                                  const uint32_t* slots,
+                                  size_t          count,
+                                  NodeStatus*     statuses) = 0;
+
+        // Node::PassesGuard의 배치 버전 (메모리 Selector의 선점 가드, 통과하면 statuses[slot]이 SUCCESS)
+        // 기본은 Node::PassesGuard 기본과 같이 가드 없음이다.
+        virtual void PassesGuardBatch(Context* const* /* contexts */,
+                                      const uint32_t* slots,
+                                      size_t          count,
+                                      NodeStatus*     statuses)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                statuses[slots[i]] = NodeStatus::FAILURE;
+            }
+        }
+    };
+
+    // 에이전트 배열 단위로 평가하는 조건 노드
+    // 에이전트 포인터를 블록(kBlockSize) 단위로 모아 EvaluateBatch를 한 번 호출한다. 구현은 필요한 필드를
+    // 열(SoA) 배열로 모은 뒤 분기 없는 루프로 passed를 채우면 컴파일러가 벡터화할 수 있다.
+    // 단일 에이전트 실행(그래프 실행, 배치 밖 호출)도 크기 1인 배치로 같은 함수를 쓰므로 결과가 항상 같다.
+    //
+    //   class InAttackRange : public BatchCondition<Monster>
+    //   {
+    //       void EvaluateBatch(Monster* const* monsters, Context* const*, size_t count, uint8_t* passed) override;
+    //   };
+    template <typename TAgent>
+    class BatchCondition : public AgentNode<TAgent>, public IBatchLeaf
+    {
+    public:
+        static constexpr size_t kBlockSize = 64;
+
+        explicit BatchCondition(const std::string& name) : AgentNode<TAgent>(name, NodeType::CONDITION) {}
+
+        void ExecuteBatch(Context* const* contexts, const uint32_t* slots, size_t count, NodeStatus* statuses) final
+        {
+            TAgent*  agents[kBlockSize];
+            Context* block_contexts[kBlockSize];
+            uint32_t block_slots[kBlockSize];
+            uint8_t  passed[kBlockSize];
+
+            size_t filled = 0;
+            auto   flush  = [&]()
+            {
+                EvaluateBatch(agents, block_contexts, filled, passed);
+                for (size_t i = 0; i < filled; ++i)
+                {
+                    statuses[block_slots[i]] = passed[i] ? NodeStatus::SUCCESS : NodeStatus::FAILURE;
+                }
+                filled = 0;
+            };
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint32_t slot  = slots[i];
+                TAgent*        agent = contexts[slot]->template GetAgent<TAgent>();
+                if (!agent)
+                {
+                    statuses[slot] = NodeStatus::FAILURE; // AgentNode와 같이 에이전트가 없으면 실패
+                    continue;
+                }
+                agents[filled]         = agent;
+                block_contexts[filled] = contexts[slot];
+                block_slots[filled]    = slot;
+                if (++filled == kBlockSize)
+                {
+                    flush();
+                }
+            }
+            if (filled > 0)
+            {
+                flush();
+            }
+        }
+
+    protected:
+        // agents[i]/contexts[i]의 조건 결과를 passed[i]에 기록 (0이면 FAILURE, 그 외 SUCCESS)
+        virtual void EvaluateBatch(TAgent* const* agents, Context* const* contexts, size_t count, uint8_t* passed) = 0;
+
+        NodeStatus ExecuteAgent(TAgent& agent, Context& context) final
+        {
+            TAgent*  agents[1]   = {&agent};
+            Context* contexts[1] = {&context};
+            uint8_t  passed      = 0;
+            EvaluateBatch(agents, contexts, 1, &passed);
+            return passed ? NodeStatus::SUCCESS : NodeStatus::FAILURE;
+        }
+    };
+
+} // namespace bt
@@ -0,0 +1,756 @@
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../Action/Action.h"
+#include "../Action/CoAction.h"
+#include "../AgentNode.h"
+#include "../BatchNode.h"
+#include "../Condition/Condition.h"
+#include "../Control/Parallel.h"
+#include "../Control/Random.h"
+#include "../Control/Selector.h"
+#include "../Control/Sequence.h"
+#include "../Control/UtilitySelector.h"
+#include "../Control/WeightedRandomSelector.h"
+#include "../Decorator/Invert.h"
+#include "../Decorator/Repeat.h"
+#include "../Decorator/Timeout.h"
+#include "../Engine.h"
+#include "../StaticTree.h"
+#include "../Trace.h"
+#include "../Tree.h"
+#include "../TreeLoader.h"
+#include "Benchmark.h"
+
+namespace bt
+{
+    namespace benchmark
+    {
+
+        namespace
+        {
+            // 에이전트 블랙보드 키는 먼저 등록해 둔다 (슬롯 배열이 키 id 크기만큼 잡히므로 작은 id가 유리)
+            const BlackboardKey<int> target_key("bench_target");
+            const BlackboardKey<int> counter_key("bench_counter");
+
+            NodeStatus Succeed(Context&) { return NodeStatus::SUCCESS; }
+            NodeStatus Fail(Context&) { return NodeStatus::FAILURE; }
+
+            bool HasTarget(Context& context) { return context.Get(target_key) != 0; }
+            bool InRange(Context& context) { return (context.Get(target_key) & 1) != 0; }
+
+            NodeStatus Attack(Context& context)
+            {
+                context.Set(counter_key, context.Get(counter_key) + 1);
+                return NodeStatus::SUCCESS;
+            }
+
+            NodeStatus Patrol(Context& context)
+            {
+                context.Set(counter_key, context.Get(counter_key) + 2);
+                return NodeStatus::RUNNING;
+            }
+
+            // 리프마다 고유 타입을 갖는 호출 객체 (함수 포인터와 달리 템플릿 노드에서 인라인된다)
+            auto has_target_fn = [](Context& context) { return HasTarget(context); };
+            auto in_range_fn   = [](Context& context) { return InRange(context); };
+            auto attack_fn     = [](Context& context) { return Attack(context); };
+            auto patrol_fn     = [](Context& context) { return Patrol(context); };
+
+            std::shared_ptr<Node> SuccessLeaf(const std::string& name) { return MakeAction(name, &Succeed); }
+            std::shared_ptr<Node> FailureLeaf(const std::string& name) { return MakeAction(name, &Fail); }
+
+            // 깊은 트리: Sequence를 depth 단계 중첩, 단계마다 성공 리프 하나
+            std::shared_ptr<Node> BuildDeep(int depth)
+            {
+                auto root    = std::make_shared<Sequence>("deep_0");
+                auto current = root;
+                for (int level = 1; level < depth; ++level)
+                {
+                    current->AddChild(SuccessLeaf("leaf_" + std::to_string(level)));
+                    auto next = std::make_shared<Sequence>("deep_" + std::to_string(level));
+                    current->AddChild(next);
+                    current = next;
+                }
+                current->AddChild(SuccessLeaf("leaf_last"));
+                return root;
+            }
+
+            // 넓은 트리: 실패 리프 width개 뒤의 성공 리프를 찾는 Selector
+            std::shared_ptr<Node> BuildWide(int width)
+            {
+                auto root = std::make_shared<Selector>("wide");
+                for (int i = 0; i < width; ++i)
+                {
+                    root->AddChild(FailureLeaf("fail_" + std::to_string(i)));
+                }
+                root->AddChild(SuccessLeaf("success"));
+                return root;
+            }
+
+            // 병렬 트리: Parallel(groups) × Parallel(leaves)
+            std::shared_ptr<Node> BuildParallel(int groups, int leaves)
+            {
+                auto root = std::make_shared<Parallel>("parallel_root", Parallel::Policy::SUCCEED_ON_ALL);
+                for (int g = 0; g < groups; ++g)
+                {
+                    auto group =
+                        std::make_shared<Parallel>("group_" + std::to_string(g), Parallel::Policy::FAIL_ON_ONE);
+                    for (int i = 0; i < leaves; ++i)
+                    {
+                        group->AddChild(SuccessLeaf("leaf_" + std::to_string(i)));
+                    }
+                    root->AddChild(group);
+                }
+                return root;
+            }
+
+            // 데코레이터 트리: 리프마다 Invert(Invert(Repeat(1, Timeout(리프))))
+            std::shared_ptr<Node> BuildDecorated(int chains)
+            {
+                auto root = std::make_shared<Sequence>("decorated");
+                for (int i = 0; i < chains; ++i)
+                {
+                    std::string suffix  = std::to_string(i);
+                    auto        timeout = std::make_shared<Timeout>("timeout_" + suffix, std::chrono::seconds(1));
+                    timeout->AddChild(SuccessLeaf("leaf_" + suffix));
+                    auto repeat = std::make_shared<Repeat>("repeat_" + suffix, 1);
+                    repeat->AddChild(timeout);
+                    auto inner = std::make_shared<Invert>("invert_inner_" + suffix);
+                    inner->AddChild(repeat);
+                    auto outer = std::make_shared<Invert>("invert_outer_" + suffix);
+                    outer->AddChild(inner);
+                    root->AddChild(outer);
+                }
+                return root;
+            }
+
+            // 고블린 BT 모양: Selector(Sequence(HasTarget, InRange, Attack), Patrol)
+            template <typename MakeCond, typename MakeAct>
+            std::shared_ptr<Tree> BuildGoblin(MakeCond make_condition, MakeAct make_action)
+            {
+                auto root     = std::make_shared<Selector>("goblin_root");
+                auto sequence = std::make_shared<Sequence>("attack_sequence");
+                sequence->AddChild(make_condition("has_target", has_target_fn));
+                sequence->AddChild(make_condition("in_range", in_range_fn));
+                sequence->AddChild(make_action("attack", attack_fn));
+                root->AddChild(sequence);
+                root->AddChild(make_action("patrol", patrol_fn));
+
+                auto tree = std::make_shared<Tree>("goblin_bench");
+                tree->SetRoot(root);
+                tree->SetExecutionMode(ExecutionMode::MEMORY);
+                tree->Compile();
+                return tree;
+            }
+
+            std::shared_ptr<Tree> BuildTemplateGoblin()
+            {
+                return BuildGoblin([](const std::string& name, auto func) { return MakeCondition(name, func); },
+                                   [](const std::string& name, auto func) { return MakeAction(name, func); });
+            }
+
+            // 트리 하나를 그래프/컴파일 두 형태로 측정
+            void RunTree(BenchmarkRunner& runner, const std::string& name, std::shared_ptr<Node> root)
+            {
+                auto tree = std::make_shared<Tree>(name);
+                tree->SetRoot(root);
+                Context context;
+                runner.Run("tree/" + name + "/graph", 1, [&]() { DoNotOptimize(tree->Execute(context)); });
+                tree->Compile();
+                runner.Run("tree/" + name + "/compiled", 1, [&]() { DoNotOptimize(tree->Execute(context)); });
+            }
+
+            // 리프가 접근하는 에이전트 데이터 (서버의 Monster 역할)
+            struct BenchMonster
+            {
+                int target  = 0;
+                int counter = 0;
+            };
+
+            // N 에이전트 틱용 실행자
+            class BenchAgent : public IExecutor
+            {
+            public:
+                BenchAgent(std::shared_ptr<Tree> tree, int target) : tree_(std::move(tree))
+                {
+                    context_.Set(target_key, target);
+                }
+
+                void Update(float) override { tree_->Execute(context_); }
+
+                void                  SetBehaviorTree(std::shared_ptr<Tree> tree) override { tree_ = tree; }
+                std::shared_ptr<Tree> GetBehaviorTree() const override { return tree_; }
+
+                Context&       GetContext() override { return context_; }
+                const Context& GetContext() const override { return context_; }
+
+                const std::string& GetName() const override { return name_; }
+                const std::string& GetBTName() const override { return name_; }
+
+                bool IsActive() const override { return true; }
+                void SetActive(bool) override {}
+
+                BenchMonster& GetMonster() { return monster_; }
+
+            private:
+                std::shared_ptr<Tree> tree_;
+                Context               context_;
+                std::string           name_ = "bench_agent";
+                BenchMonster          monster_;
+            };
+
+            NodeStatus MonsterHasTarget(BenchMonster& monster)
+            {
+                return monster.target != 0 ? NodeStatus::SUCCESS : NodeStatus::FAILURE;
+            }
+            NodeStatus MonsterInRange(BenchMonster& monster)
+            {
+                return (monster.target & 1) != 0 ? NodeStatus::SUCCESS : NodeStatus::FAILURE;
+            }
+            NodeStatus MonsterAttack(BenchMonster& monster)
+            {
+                monster.counter++;
+                return NodeStatus::SUCCESS;
+            }
+            NodeStatus MonsterPatrol(BenchMonster& monster)
+            {
+                monster.counter += 2;
+                return NodeStatus::RUNNING;
+            }
+
+            // 서버/클라이언트 리프의 기존 방식: GetAI() 복사 + dynamic_pointer_cast로 실행자를 찾아 에이전트에 접근
+            template <NodeStatus (*Op)(BenchMonster&)>
+            class CastLeaf final : public Node
+            {
+            public:
+                CastLeaf(const std::string& name, NodeType type) : Node(name, type) {}
+
+                NodeStatus Execute(Context& context) override
+                {
+                    auto ai = context.GetAI();
+                    if (!ai)
+                        return NodeStatus::FAILURE;
+                    auto executor = std::dynamic_pointer_cast<BenchAgent>(ai);
+                    return executor ? Op(executor->GetMonster()) : NodeStatus::FAILURE;
+                }
+            };
+
+            // 타입이 지정된 에이전트 참조를 받는 리프
+            template <NodeStatus (*Op)(BenchMonster&)>
+            class TypedLeaf final : public AgentNode<BenchMonster>
+            {
+            public:
+                TypedLeaf(const std::string& name, NodeType type) : AgentNode(name, type) {}
+
+            protected:
+                NodeStatus ExecuteAgent(BenchMonster& monster, Context&) override { return Op(monster); }
+            };
+
+            // 고블린 BT 모양을 에이전트 접근 방식별 리프로 구성
+            template <template <NodeStatus (*)(BenchMonster&)> class Leaf>
+            std::shared_ptr<Tree> BuildAgentGoblin()
+            {
+                auto root     = std::make_shared<Selector>("goblin_root");
+                auto sequence = std::make_shared<Sequence>("attack_sequence");
+                sequence->AddChild(std::make_shared<Leaf<&MonsterHasTarget>>("has_target", NodeType::CONDITION));
+                sequence->AddChild(std::make_shared<Leaf<&MonsterInRange>>("in_range", NodeType::CONDITION));
+                sequence->AddChild(std::make_shared<Leaf<&MonsterAttack>>("attack", NodeType::ACTION));
+                root->AddChild(sequence);
+                root->AddChild(std::make_shared<Leaf<&MonsterPatrol>>("patrol", NodeType::ACTION));
+
+                auto tree = std::make_shared<Tree>("goblin_agent_bench");
+                tree->SetRoot(root);
+                tree->Compile();
+                return tree;
+            }
+
+            // 몬스터 묶음의 타겟을 열 배열로 모아 한 번에 확인하는 배치 조건
+            class BatchHasTarget final : public BatchCondition<BenchMonster>
+            {
+            public:
+                explicit BatchHasTarget(const std::string& name) : BatchCondition(name) {}
+
+            protected:
+                void EvaluateBatch(BenchMonster* const* monsters,
+                                   Context* const*,
+                                   size_t   count,
+                                   uint8_t* passed) override
+                {
+                    int targets[kBlockSize];
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        targets[i] = monsters[i]->target;
+                    }
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        passed[i] = targets[i] != 0;
+                    }
+                }
+            };
+
+            class BatchInRange final : public BatchCondition<BenchMonster>
+            {
+            public:
+                explicit BatchInRange(const std::string& name) : BatchCondition(name) {}
+
+            protected:
+                void EvaluateBatch(BenchMonster* const* monsters,
+                                   Context* const*,
+                                   size_t   count,
+                                   uint8_t* passed) override
+                {
+                    int targets[kBlockSize];
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        targets[i] = monsters[i]->target;
+                    }
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        passed[i] = (targets[i] & 1) != 0;
+                    }
+                }
+            };
+
+            // 서버 goblin_bt 모양 (메모리 모드, 컴파일), 조건만 배치 조건으로 바꿀 수 있다
+            std::shared_ptr<Tree> BuildMonsterGoblin(bool batch_conditions)
+            {
+                auto root     = std::make_shared<Selector>("goblin_root");
+                auto sequence = std::make_shared<Sequence>("attack_sequence");
+                if (batch_conditions)
+                {
+                    sequence->AddChild(std::make_shared<BatchHasTarget>("has_target"));
+                    sequence->AddChild(std::make_shared<BatchInRange>("in_range"));
+                }
+                else
+                {
+                    sequence->AddChild(
+                        std::make_shared<TypedLeaf<&MonsterHasTarget>>("has_target", NodeType::CONDITION));
+                    sequence->AddChild(std::make_shared<TypedLeaf<&MonsterInRange>>("in_range", NodeType::CONDITION));
+                }
+                sequence->AddChild(std::make_shared<TypedLeaf<&MonsterAttack>>("attack", NodeType::ACTION));
+                root->AddChild(sequence);
+                root->AddChild(std::make_shared<TypedLeaf<&MonsterPatrol>>("patrol", NodeType::ACTION));
+
+                auto tree = std::make_shared<Tree>("goblin_batch_bench");
+                tree->SetRoot(root);
+                tree->SetExecutionMode(ExecutionMode::MEMORY);
+                tree->Compile();
+                return tree;
+            }
+
+            void RunTreeShapes(BenchmarkRunner& runner)
+            {
+                RunTree(runner, "deep32", BuildDeep(32));
+                RunTree(runner, "wide256", BuildWide(256));
+                RunTree(runner, "parallel16x16", BuildParallel(16, 16));
+                RunTree(runner, "decorator32", BuildDecorated(32));
+            }
+
+            void RunLeafCalls(BenchmarkRunner& runner)
+            {
+                // 같은 고블린 트리를 리프 구현만 바꿔 비교 (타겟/사거리를 매 틱 바꿔 모든 분기를 지나게 함)
+                auto function_tree = BuildGoblin(
+                    [](const std::string& name, auto func) { return std::make_shared<Condition>(name, func); },
+                    [](const std::string& name, auto func) { return std::make_shared<Action>(name, func); });
+                auto template_tree = BuildTemplateGoblin();
+                auto attack_branch =
+                    dsl::Sequence(dsl::Condition(has_target_fn), dsl::Condition(in_range_fn), dsl::Action(attack_fn));
+                auto static_node =
+                    MakeStaticNode("goblin_static", dsl::Selector(std::move(attack_branch), dsl::Action(patrol_fn)));
+
+                Context context;
+                int     tick = 0;
+                runner.Run("leaf/std_function",
+                           1,
+                           [&]()
+                           {
+                               context.Set(target_key, tick++ % 3);
+                               DoNotOptimize(function_tree->Execute(context));
+                           });
+                runner.Run("leaf/template",
+                           1,
+                           [&]()
+                           {
+                               context.Set(target_key, tick++ % 3);
+                               DoNotOptimize(template_tree->Execute(context));
+                           });
+                runner.Run("leaf/static_dsl",
+                           1,
+                           [&]()
+                           {
+                               context.Set(target_key, tick++ % 3);
+                               DoNotOptimize(static_node->TickStatic(context));
+                           });
+
+                // 프로파일링을 켰을 때의 비용
+                template_tree->EnableProfiling();
+                runner.Run("leaf/template_profiled",
+                           1,
+                           [&]()
+                           {
+                               context.Set(target_key, tick++ % 3);
+                               DoNotOptimize(template_tree->Execute(context));
+                           });
+                template_tree->DisableProfiling();
+
+                // 실행 추적을 켰을 때의 비용 (운영용 표본 간격 100 / 매 틱 기록)
+                auto recorder = std::make_shared<TraceRecorder>(100);
+                template_tree->SetTraceRecorder(recorder);
+                runner.Run("leaf/template_traced_1_in_100",
+                           1,
+                           [&]()
+                           {
+                               context.Set(target_key, tick++ % 3);
+                               DoNotOptimize(template_tree->Execute(context));
+                           });
+                recorder->SetSampleInterval(1);
+                runner.Run("leaf/template_traced_every_tick",
+                           1,
+                           [&]()
+                           {
+                               context.Set(target_key, tick++ % 3);
+                               DoNotOptimize(template_tree->Execute(context));
+                           });
+                template_tree->SetTraceRecorder(nullptr);
+            }
+
+            // 리프의 에이전트 접근: dynamic_pointer_cast vs 틱마다 한 번 설정하는 타입 지정 참조
+            void RunAgentAccess(BenchmarkRunner& runner)
+            {
+                auto cast_tree  = BuildAgentGoblin<CastLeaf>();
+                auto typed_tree = BuildAgentGoblin<TypedLeaf>();
+                auto agent      = std::make_shared<BenchAgent>(cast_tree, 0);
+
+                Context context;
+                context.SetAI(agent);
+                int tick = 0;
+                runner.Run("agent_access/dynamic_cast",
+                           1,
+                           [&]()
+                           {
+                               agent->GetMonster().target = tick++ % 3;
+                               DoNotOptimize(cast_tree->Execute(context));
+                           });
+                runner.Run("agent_access/typed",
+                           1,
+                           [&]()
+                           {
+                               context.SetAgent(&agent->GetMonster());
+                               agent->GetMonster().target = tick++ % 3;
+                               DoNotOptimize(typed_tree->Execute(context));
+                           });
+            }
+
+            // 틱마다 random_device와 mt19937을 새로 만드는 이전 Random 구현 (비교 기준)
+            class EntropyRandom : public Node
+            {
+            public:
+                EntropyRandom(const std::string& name) : Node(name, NodeType::RANDOM) {}
+
+                NodeStatus Execute(Context& context) override
+                {
+                    std::random_device              rd;
+                    std::mt19937                    gen(rd());
+                    std::uniform_int_distribution<> dis(0, static_cast<int>(children_.size()) - 1);
+                    return children_[static_cast<size_t>(dis(gen))]->Tick(context);
+                }
+            };
+
+            // 자식 8개 중 하나를 고르는 비용: 틱마다 엔트로피 읽기 vs 에이전트 Rng, 가중치/유틸리티 선택
+            void RunRandomSelection(BenchmarkRunner& runner)
+            {
+                auto build = [](std::shared_ptr<Node> root)
+                {
+                    for (int i = 0; i < 8; ++i)
+                    {
+                        root->AddChild(
+                            MakeAction("choice" + std::to_string(i), [](Context&) { return NodeStatus::SUCCESS; }));
+                    }
+                    auto tree = std::make_shared<Tree>("random_bench");
+                    tree->SetRoot(root);
+                    return tree;
+                };
+                auto entropy_tree  = build(std::make_shared<EntropyRandom>("entropy"));
+                auto seeded_tree   = build(std::make_shared<Random>("seeded"));
+                auto weighted_tree = build(std::make_shared<WeightedRandomSelector>(
+                    "weighted", std::vector<float>{8.0f, 4.0f, 2.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f}));
+                auto utility_tree  = build(std::make_shared<UtilitySelector>(
+                    "utility",
+                    [](Context& context, float* scores, size_t count)
+                    {
+                        float distance = static_cast<float>(context.Get(target_key) + 1);
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            scores[i] = 1.0f / (distance + static_cast<float>(i));
+                        }
+                    }));
+
+                Context context;
+                context.SeedRandom(1);
+                runner.Run("random/random_device", 1, [&]() { DoNotOptimize(entropy_tree->Execute(context)); });
+                runner.Run("random/seeded", 1, [&]() { DoNotOptimize(seeded_tree->Execute(context)); });
+                runner.Run("random/weighted", 1, [&]() { DoNotOptimize(weighted_tree->Execute(context)); });
+                runner.Run("random/utility", 1, [&]() { DoNotOptimize(utility_tree->Execute(context)); });
+            }
+
+            // 네 틱에 걸친 행동: 틱마다 재진입하는 상태 기계 리프 vs 코루틴 리프 (연산 1회 = 행동 한 번 완료)
+            void RunLongActions(BenchmarkRunner& runner)
+            {
+                auto state_machine = MakeAction("walk_state",
+                                                [](Context& context)
+                                                {
+                                                    NodeState& state = context.GetNodeState(0);
+                                                    if (++state.counter < 4)
+                                                        return NodeStatus::RUNNING;
+                                                    state.counter = 0;
+                                                    return NodeStatus::SUCCESS;
+                                                });
+                Context state_context;
+                runner.Run("long_action/state_machine",
+                           1,
+                           [&]()
+                           {
+                               while (state_machine->Tick(state_context) == NodeStatus::RUNNING)
+                               {
+                               }
+                           });
+
+#ifdef BT_HAS_COROUTINES
+                auto coroutine = std::make_shared<CoAction>("walk_coroutine",
+                                                            [](Context&) -> CoTask
+                                                            {
+                                                                for (int i = 0; i < 3; ++i)
+                                                                {
+                                                                    co_await NextTick();
+                                                                }
+                                                                co_return NodeStatus::SUCCESS;
+                                                            });
+                Context co_context;
+                runner.Run("long_action/coroutine",
+                           1,
+                           [&]()
+                           {
+                               while (coroutine->Tick(co_context) == NodeStatus::RUNNING)
+                               {
+                               }
+                           });
+#endif
+            }
+
+            void RunBlackboard(BenchmarkRunner& runner)
+            {
+                const int                       key_count = 100;
+                std::vector<std::string>        names;
+                std::vector<BlackboardKey<int>> keys;
+                for (int i = 0; i < key_count; ++i)
+                {
+                    names.push_back("bench_bb_" + std::to_string(i));
+                    keys.emplace_back(names.back());
+                }
+
+                Blackboard string_bb;
+                int        i = 0;
+                runner.Run("blackboard/string_set_get",
+                           1,
+                           [&]()
+                           {
+                               const std::string& name = names[i++ % key_count];
+                               string_bb.SetData(name, i);
+                               DoNotOptimize(string_bb.GetDataAs<int>(name));
+                           });
+
+                Blackboard typed_bb;
+                runner.Run("blackboard/typed_set_get",
+                           1,
+                           [&]()
+                           {
+                               const auto& key = keys[i++ % key_count];
+                               typed_bb.Set(key, i);
+                               DoNotOptimize(typed_bb.Get(key));
+                           });
+
+                // 설정 → 분대 → 에이전트 계층에서 설정 값 조회
+                auto config = std::make_shared<Blackboard>();
+                for (const auto& key : keys)
+                {
+                    config->Set(key, 1);
+                }
+                auto       squad = std::make_shared<Blackboard>(config);
+                Blackboard agent(squad);
+                runner.Run("blackboard/layered_get", 1, [&]() { DoNotOptimize(agent.Get(keys[i++ % key_count])); });
+
+                BlackboardKey<std::string> name_key("bench_bb_name");
+                const std::string          value(48, 'x'); // SSO를 넘는 길이
+                runner.Run("blackboard/boxed_string_set", 1, [&]() { typed_bb.Set(name_key, value); });
+            }
+
+            void RunConstruction(BenchmarkRunner& runner)
+            {
+                runner.Run("build/goblin_compiled", 1, [&]() { DoNotOptimize(BuildTemplateGoblin()); });
+                runner.Run("build/deep32_compiled",
+                           1,
+                           [&]()
+                           {
+                               auto tree = std::make_shared<Tree>("deep");
+                               tree->SetRoot(BuildDeep(32));
+                               DoNotOptimize(tree->Compile());
+                           });
+            }
+
+            // 같은 고블린 트리를 JSON/미리 컴파일된 바이너리에서 로드 (검증 + 생성 + 컴파일 포함)
+            void RunLoading(BenchmarkRunner& runner)
+            {
+                NodeRegistry registry;
+                registry.Register("HasTarget", [](const std::string& name, const NodeParams&)
+                                  { return MakeCondition(name, has_target_fn); });
+                registry.Register("InRange", [](const std::string& name, const NodeParams&)
+                                  { return MakeCondition(name, in_range_fn); });
+                registry.Register("Attack", [](const std::string& name, const NodeParams&)
+                                  { return MakeAction(name, attack_fn); });
+                registry.Register("Patrol", [](const std::string& name, const NodeParams&)
+                                  { return MakeAction(name, patrol_fn); });
+
+                const std::string text = R"({
+                    "name": "goblin_bench", "execution_mode": "MEMORY", "dependencies": ["bench_target"],
+                    "root": {"type": "Selector", "name": "goblin_root", "children": [
+                        {"type": "Sequence", "name": "attack_sequence", "children": [
+                            {"type": "HasTarget", "name": "has_target"},
+                            {"type": "InRange", "name": "in_range"},
+                            {"type": "Attack", "name": "attack"}]},
+                        {"type": "Patrol", "name": "patrol"}]}
+                })";
+
+                TreeLoader           loader(registry);
+                std::vector<uint8_t> binary = loader.Precompile(nlohmann::json::parse(text));
+                runner.Run("load/goblin_json",
+                           1,
+                           [&]() { DoNotOptimize(loader.LoadJson(nlohmann::json::parse(text))); });
+                runner.Run("load/goblin_binary", 1, [&]() { DoNotOptimize(loader.LoadBinary(binary)); });
+            }
+
+            // 등록된 트리 64개 중 하나를 이름/TreeId로 조회
+            void RunEngineLookup(BenchmarkRunner& runner)
+            {
+                Engine engine;
+                for (int i = 0; i < 64; ++i)
+                {
+                    engine.RegisterTree("bench_tree_" + std::to_string(i), BuildTemplateGoblin());
+                }
+                const std::string name = "bench_tree_42";
+                const TreeId      id   = engine.GetTreeId(name);
+
+                runner.Run("engine/lookup_name", 1, [&]() { DoNotOptimize(engine.GetTree(name)); });
+                runner.Run("engine/lookup_id", 1, [&]() { DoNotOptimize(engine.GetTree(id)); });
+            }
+
+            void RunAgents(BenchmarkRunner& runner)
+            {
+                auto tree = BuildTemplateGoblin();
+
+                std::vector<size_t> agent_counts = {1000, 10000};
+                if (!runner.IsQuick())
+                {
+                    agent_counts.push_back(100000);
+                }
+
+                for (size_t count : agent_counts)
+                {
+                    std::string suffix   = std::to_string(count / 1000) + "k";
+                    std::string serial   = "agents/serial/" + suffix;
+                    std::string parallel = "agents/parallel/" + suffix;
+                    if (!runner.IsSelected(serial) && !runner.IsSelected(parallel))
+                        continue; // 에이전트 생성 비용을 피한다
+
+                    std::vector<std::shared_ptr<IExecutor>> agents;
+                    agents.reserve(count);
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        agents.push_back(std::make_shared<BenchAgent>(tree, static_cast<int>(i % 3)));
+                    }
+
+                    Engine engine;
+                    runner.Run(serial, count, [&]() { engine.TickAll(agents, 0.016f); });
+
+                    engine.SetThreadCount(WorkStealingPool::DefaultThreadCount());
+                    runner.Run(parallel, count, [&]() { engine.TickAll(agents, 0.016f); });
+                }
+            }
+
+            // 같은 트리를 실행하는 N 에이전트: 한 명씩 Execute vs 노드 단위로 묶어 ExecuteBatch
+            // (연산 1회 = 에이전트 1틱)
+            void RunBatchTicks(BenchmarkRunner& runner)
+            {
+                auto single_tree = BuildMonsterGoblin(false);
+                auto batch_tree  = BuildMonsterGoblin(true);
+
+                for (size_t count : {size_t(1000), size_t(10000)})
+                {
+                    std::string suffix = std::to_string(count / 1000) + "k";
+                    std::string single = "batch/per_agent/" + suffix;
+                    std::string batch  = "batch/batched/" + suffix;
+                    if (!runner.IsSelected(single) && !runner.IsSelected(batch))
+                        continue;
+
+                    std::vector<BenchMonster>             monsters(count);
+                    std::vector<std::unique_ptr<Context>> owned;
+                    std::vector<Context*>                 contexts;
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        monsters[i].target = static_cast<int>(i % 3);
+                        owned.push_back(std::make_unique<Context>());
+                        owned.back()->SetAgent(&monsters[i]);
+                        contexts.push_back(owned.back().get());
+                    }
+
+                    runner.Run(single,
+                               count,
+                               [&]()
+                               {
+                                   const auto now = std::chrono::steady_clock::now(); // 엔진처럼 프레임 시각 공유
+                                   for (Context* context : contexts)
+                                   {
+                                       context->SetFrameTime(now);
+                                       DoNotOptimize(single_tree->Execute(*context));
+                                   }
+                               });
+
+                    std::vector<NodeStatus>    statuses(count);
+                    CompiledTree::BatchScratch scratch;
+                    runner.Run(batch,
+                               count,
+                               [&]()
+                               {
+                                   const auto now = std::chrono::steady_clock::now();
+                                   for (Context* context : contexts)
+                                   {
+                                       context->SetFrameTime(now);
+                                   }
+                                   batch_tree->ExecuteBatch(contexts.data(), count, statuses.data(), scratch);
+                                   DoNotOptimize(statuses[0]);
+                               });
+                }
+            }
+        } // namespace
+
+        void RunBehaviorTreeBenchmarks(BenchmarkRunner& runner)
+        {
+            RunTreeShapes(runner);
+            RunLeafCalls(runner);
+            RunAgentAccess(runner);
+            RunRandomSelection(runner);
+            RunLongActions(runner);
+            RunBlackboard(runner);
+            RunConstruction(runner);
+            RunLoading(runner);
+            RunEngineLookup(runner);
+            RunAgents(runner);
+            RunBatchTicks(runner);
+        }
+
+    } // namespace benchmark
+} // namespace bt
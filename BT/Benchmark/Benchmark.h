@@ -0,0 +1,199 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cstdint>
+
+#include <nlohmann/json.hpp>
+
+namespace bt
+{
+    namespace benchmark
+    {
+
+        // 전역 할당 횟수 (BenchmarkMain.cpp의 operator new가 증가시킨다)
+        inline std::atomic<uint64_t>& AllocationCounter()
+        {
+            static std::atomic<uint64_t> counter{0};
+            return counter;
+        }
+
+        // 최적화로 측정 대상 계산이 사라지지 않게 한다
+        template <typename T>
+        inline void DoNotOptimize(const T& value)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            asm volatile("" : : "r,m"(value) : "memory");
+#else
+            static volatile const void* sink;
+            sink = &value;
+#endif
+        }
+
+        struct BenchmarkOptions
+        {
+            size_t      samples       = 51;    // 표본 수 (중앙값/p99 계산 단위)
+            double      min_sample_ms = 2.0;   // 표본 하나의 최소 측정 시간 (짧은 연산은 여러 번 반복)
+            double      max_total_s   = 3.0;   // 벤치마크 하나의 측정 시간 상한 (표본 수를 줄임)
+            bool        quick         = false; // CI용 축소 실행 (큰 에이전트 수 생략, 표본 감소)
+            std::string filter;                // 이름에 포함된 경우만 실행
+        };
+
+        // 벤치마크 하나의 결과 (시간은 연산 1회 기준 나노초)
+        struct BenchmarkResult
+        {
+            std::string name;
+            size_t      items_per_op   = 1; // 연산 1회가 처리하는 항목 수 (에이전트 수 등)
+            size_t      samples        = 0;
+            uint64_t    ops_per_sample = 0;
+            double      median_ns      = 0.0;
+            double      p99_ns         = 0.0;
+            double      min_ns         = 0.0;
+            double      mean_ns        = 0.0;
+            double      allocs_per_op  = 0.0;
+        };
+
+        // 표본 기반 마이크로벤치마크 실행기
+        // 연산을 표본 시간이 min_sample_ms 이상이 되도록 묶어 반복 측정하고, 표본별 연산당 시간의 분포를 보고한다.
+        class BenchmarkRunner
+        {
+        public:
+            explicit BenchmarkRunner(BenchmarkOptions options) : options_(std::move(options)) {}
+
+            bool IsQuick() const { return options_.quick; }
+
+            bool IsSelected(const std::string& name) const
+            {
+                return options_.filter.empty() || name.find(options_.filter) != std::string::npos;
+            }
+
+            // op()를 반복 측정 (op는 같은 작업을 여러 번 수행해도 되는 연산이어야 한다)
+            template <typename F>
+            void Run(const std::string& name, size_t items_per_op, F&& op)
+            {
+                if (!IsSelected(name))
+                    return;
+
+                // 예열 겸 보정: 표본 하나가 min_sample_ms 이상 되도록 반복 횟수 결정
+                uint64_t ops       = 1;
+                double   sample_ns = TimeOps(op, ops);
+                double   target_ns = options_.min_sample_ms * 1e6;
+                while (sample_ns < target_ns && ops < (uint64_t(1) << 24))
+                {
+                    double scale = sample_ns > 0.0 ? std::min(target_ns / sample_ns * 1.2, 10.0) : 10.0;
+                    ops          = std::max<uint64_t>(ops + 1, static_cast<uint64_t>(std::ceil(ops * scale)));
+                    sample_ns    = TimeOps(op, ops);
+                }
+
+                size_t samples = options_.quick ? std::min<size_t>(options_.samples, 15) : options_.samples;
+                size_t budget  = static_cast<size_t>(options_.max_total_s * 1e9 / std::max(sample_ns, 1.0));
+                samples        = std::max<size_t>(5, std::min(samples, budget));
+
+                std::vector<double> per_op(samples);
+                uint64_t            allocations = AllocationCounter().load(std::memory_order_relaxed);
+                for (size_t i = 0; i < samples; ++i)
+                {
+                    per_op[i] = TimeOps(op, ops) / static_cast<double>(ops);
+                }
+                allocations = AllocationCounter().load(std::memory_order_relaxed) - allocations;
+
+                std::sort(per_op.begin(), per_op.end());
+                BenchmarkResult result;
+                result.name           = name;
+                result.items_per_op   = items_per_op;
+                result.samples        = samples;
+                result.ops_per_sample = ops;
+                result.median_ns      = per_op[samples / 2];
+                size_t p99_rank       = static_cast<size_t>(std::ceil(samples * 0.99)); // nearest-rank
+                result.p99_ns         = per_op[std::min(samples, p99_rank) - 1];
+                result.min_ns         = per_op.front();
+                double total          = 0.0;
+                for (double value : per_op)
+                {
+                    total += value;
+                }
+                result.mean_ns       = total / static_cast<double>(samples);
+                result.allocs_per_op = static_cast<double>(allocations) / static_cast<double>(samples * ops);
+
+                PrintRow(result);
+                results_.push_back(result);
+            }
+
+            const std::vector<BenchmarkResult>& GetResults() const { return results_; }
+
+            void PrintHeader() const
+            {
+                std::cout << std::left << std::setw(44) << "benchmark" << std::right << std::setw(14) << "median ns"
+                          << std::setw(14) << "p99 ns" << std::setw(14) << "ns/item" << std::setw(12) << "allocs/op"
+                          << std::setw(10) << "samples" << "\n";
+                std::cout << std::string(108, '-') << "\n";
+            }
+
+            // CI에서 커밋 간 비교할 수 있는 JSON
+            nlohmann::json ToJson() const
+            {
+                nlohmann::json benchmarks = nlohmann::json::array();
+                for (const auto& result : results_)
+                {
+                    benchmarks.push_back({{"name", result.name},
+                                          {"items_per_op", result.items_per_op},
+                                          {"samples", result.samples},
+                                          {"ops_per_sample", result.ops_per_sample},
+                                          {"median_ns", result.median_ns},
+                                          {"p99_ns", result.p99_ns},
+                                          {"min_ns", result.min_ns},
+                                          {"mean_ns", result.mean_ns},
+                                          {"median_ns_per_item", result.median_ns / result.items_per_op},
+                                          {"allocs_per_op", result.allocs_per_op}});
+                }
+
+                nlohmann::json context = {{"hardware_threads", std::thread::hardware_concurrency()},
+                                          {"quick", options_.quick},
+                                          {"samples", options_.samples},
+                                          {"min_sample_ms", options_.min_sample_ms}};
+#ifdef NDEBUG
+                context["assertions"] = false;
+#else
+                context["assertions"] = true;
+#endif
+                return {{"context", context}, {"benchmarks", benchmarks}};
+            }
+
+        private:
+            template <typename F>
+            static double TimeOps(F& op, uint64_t ops)
+            {
+                auto begin = std::chrono::steady_clock::now();
+                for (uint64_t i = 0; i < ops; ++i)
+                {
+                    op();
+                }
+                return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+            }
+
+            static void PrintRow(const BenchmarkResult& result)
+            {
+                std::cout << std::left << std::setw(44) << result.name << std::right << std::fixed
+                          << std::setprecision(1) << std::setw(14) << result.median_ns << std::setw(14) << result.p99_ns
+                          << std::setw(14) << result.median_ns / result.items_per_op << std::setprecision(2)
+                          << std::setw(12) << result.allocs_per_op << std::setw(10) << result.samples << "\n";
+                std::cout.unsetf(std::ios::floatfield);
+            }
+
+            BenchmarkOptions             options_;
+            std::vector<BenchmarkResult> results_;
+        };
+
+        // 벤치마크 등록 (BehaviorTreeBenchmarks.cpp)
+        void RunBehaviorTreeBenchmarks(BenchmarkRunner& runner);
+
+    } // namespace benchmark
+} // namespace bt
@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+
+#include "Benchmark.h"
+
+// 아래 operator new/delete 쌍은 malloc/free로 일치하지만 GCC가 인라인된 호출 지점에서 오탐한다
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// 할당 횟수 측정을 위한 전역 operator new 교체 (nothrow/배열 버전은 기본 구현이 이 함수들을 호출한다)
+void* operator new(std::size_t size)
+{
+    bt::benchmark::AllocationCounter().fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+#ifndef _MSC_VER // MSVC는 aligned_alloc이 없어 정렬 할당은 세지 않는다
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    bt::benchmark::AllocationCounter().fetch_add(1, std::memory_order_relaxed);
+    std::size_t align = static_cast<std::size_t>(alignment);
+    std::size_t bytes = (std::max<std::size_t>(size, 1) + align - 1) / align * align;
+    if (void* memory = std::aligned_alloc(align, bytes))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept { std::free(memory); }
+#endif
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+
+namespace
+{
+    void PrintUsage()
+    {
+        std::cout << "사용법: BT_Benchmarks [옵션]\n"
+                  << "  --filter <문자열>   이름에 문자열이 포함된 벤치마크만 실행\n"
+                  << "  --json <경로>       결과를 JSON으로 저장 (CI 비교용)\n"
+                  << "  --samples <수>      벤치마크별 표본 수 (기본값: 51)\n"
+                  << "  --quick             축소 실행 (100k 에이전트 생략, 표본 15개 이하)\n"
+                  << "  --help              도움말 표시\n";
+    }
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    bt::benchmark::BenchmarkOptions options;
+    std::string                     json_path;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--filter" && i + 1 < argc)
+        {
+            options.filter = argv[++i];
+        }
+        else if (arg == "--json" && i + 1 < argc)
+        {
+            json_path = argv[++i];
+        }
+        else if (arg == "--samples" && i + 1 < argc)
+        {
+            options.samples = std::max(5, std::atoi(argv[++i]));
+        }
+        else if (arg == "--quick")
+        {
+            options.quick = true;
+        }
+        else
+        {
+            PrintUsage();
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    try
+    {
+        bt::benchmark::BenchmarkRunner runner(options);
+        runner.PrintHeader();
+        bt::benchmark::RunBehaviorTreeBenchmarks(runner);
+
+        if (!json_path.empty())
+        {
+            std::ofstream out(json_path);
+            if (!out)
+            {
+                std::cerr << "JSON 파일을 열 수 없습니다: " << json_path << std::endl;
+                return 1;
+            }
+            out << runner.ToJson().dump(2) << "\n";
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "벤치마크 실행 중 예외 발생: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -1,75 +1,275 @@
 #pragma once
 
+#include <deque>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <typeinfo>
 #include <unordered_map>
 #include <vector>
 
 #include <any>
+#include <cstddef>
+#include <cstdint>
 
 namespace bt
 {
 
+    // Blackboard 키 이름 → 정수 id 전역 등록부
+    // 같은 이름은 어느 트리/에이전트에서든 같은 슬롯 id를 갖는다.
+    class BlackboardKeyRegistry
+    {
+    public:
+        static BlackboardKeyRegistry& Instance()
+        {
+            static BlackboardKeyRegistry instance;
+            return instance;
+        }
+
+        // 이름을 id로 변환 (처음 보는 이름이면 새 id 부여)
+        uint32_t Intern(const std::string& name)
+        {
+            {
+                std::shared_lock<std::shared_mutex> lock(mutex_);
+                auto                                it = ids_.find(name);
+                if (it != ids_.end())
+                    return it->second;
+            }
+
+            std::unique_lock<std::shared_mutex> lock(mutex_);
+            auto                                it = ids_.find(name);
+            if (it != ids_.end())
+                return it->second;
+
+            uint32_t id = static_cast<uint32_t>(names_.size());
+            names_.push_back(name);
+            ids_.emplace(name, id);
+            return id;
+        }
+
+        // 등록된 이름만 조회 (읽기 경로에서 새 id를 만들지 않음)
+        bool Find(const std::string& name, uint32_t& id) const
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            auto                                it = ids_.find(name);
+            if (it == ids_.end())
+                return false;
+            id = it->second;
+            return true;
+        }
+
+        std::string GetName(uint32_t id) const
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            return id < names_.size() ? names_[id] : std::string();
+        }
+
+        size_t Size() const
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            return names_.size();
+        }
+
+    private:
+        BlackboardKeyRegistry() = default;
+
+        std::unordered_map<std::string, uint32_t> ids_;
+        std::deque<std::string>                   names_; // id → 이름
+        mutable std::shared_mutex                 mutex_;
+    };
+
+    // 타입이 지정된 Blackboard 키 (트리 구성 시 한 번 만들어 두고 재사용)
+    template <typename T>
+    class BlackboardKey
+    {
+    public:
+        explicit BlackboardKey(const std::string& name) : id_(BlackboardKeyRegistry::Instance().Intern(name)) {}
+
+        uint32_t    GetId() const { return id_; }
+        std::string GetName() const { return BlackboardKeyRegistry::Instance().GetName(id_); }
+
+    private:
+        uint32_t id_;
+    };
+
     // Behavior Tree의 Blackboard (데이터 저장소)
+    // 키 id로 인덱싱하는 평탄한 슬롯 배열. 작은 trivially copyable 타입은 슬롯 안에 직접 저장하고(힙 할당 없음),
+    // 그 외 타입은 std::any로 저장한다. 문자열 키 API는 등록부 조회를 거치는 호환 계층이다.
+    //
+    // 계층 구조: 부모 계층(몬스터 타입별 설정, 분대 공유 등)을 연결하면 조회는 자기 계층에서 부모 쪽으로 내려가고,
+    // 쓰기는 항상 자기 계층에만 기록된다 (부모 값은 처음 쓸 때 가려짐, copy-on-write).
+    // 따라서 에이전트 계층에는 실제로 달라진 값만 남는다. Size/GetKeys 등 열거 API는 자기 계층만 대상으로 한다.
+    // 공유 계층은 const로 참조하며, 공유 계층을 바꿀 때는 복사본을 수정해 새로 연결하거나(스냅샷 교체)
+    // 병렬 틱이 없는 구간에서만 소유자가 수정해야 한다.
     class Blackboard
     {
     public:
-        Blackboard()  = default;
+        Blackboard() = default;
+        explicit Blackboard(std::shared_ptr<const Blackboard> parent) : parent_(std::move(parent)) {}
+        explicit Blackboard(std::pmr::memory_resource* resource) : slots_(resource) {} // 슬롯 배열을 할당할 곳
         ~Blackboard() = default;
 
+        // 부모 계층 연결
+        void SetParent(std::shared_ptr<const Blackboard> parent) { parent_ = std::move(parent); }
+        const std::shared_ptr<const Blackboard>& GetParent() const { return parent_; }
+
+        // 슬롯에 직접 저장 가능한 타입
+        template <typename T>
+        static constexpr bool IsInline =
+            std::is_trivially_copyable_v<T> && sizeof(T) <= 16 && alignof(T) <= alignof(std::max_align_t);
+
+        // ===== 타입 키 API (O(1), 문자열 해시 없음) =====
+
+        template <typename T>
+        void Set(const BlackboardKey<T>& key, const T& value)
+        {
+            SetSlot<T>(key.GetId(), value);
+        }
+
+        // 값 포인터 (없거나 타입이 다르면 nullptr, 다음 쓰기 전까지 유효)
+        template <typename T>
+        const T* GetPtr(const BlackboardKey<T>& key) const
+        {
+            return GetSlot<T>(key.GetId());
+        }
+
+        // 값 조회 (없거나 타입이 다르면 기본값)
+        template <typename T>
+        T Get(const BlackboardKey<T>& key, const T& default_value = T{}) const
+        {
+            const T* value = GetSlot<T>(key.GetId());
+            return value ? *value : default_value;
+        }
+
+        template <typename T>
+        bool TryGet(const BlackboardKey<T>& key, T& out) const
+        {
+            const T* value = GetSlot<T>(key.GetId());
+            if (!value)
+                return false;
+            out = *value;
+            return true;
+        }
+
+        template <typename T>
+        bool Has(const BlackboardKey<T>& key) const
+        {
+            return LookupSlot(key.GetId()) != nullptr;
+        }
+
+        // 자기 계층에 값이 있는지 (부모 값을 가리고 있는지)
+        template <typename T>
+        bool HasLocal(const BlackboardKey<T>& key) const
+        {
+            return HasSlot(key.GetId());
+        }
+
+        // 자기 계층의 값만 삭제 (부모 값이 다시 보임)
+        template <typename T>
+        void Remove(const BlackboardKey<T>& key)
+        {
+            ResetSlot(key.GetId());
+        }
+
+        // ===== 문자열 키 API (호환 계층) =====
+
         // 데이터 설정
-        void SetData(const std::string& key, const std::any& value) { data_[key] = value; }
+        void SetData(const std::string& key, const std::any& value)
+        {
+            Slot& slot = AcquireSlot(BlackboardKeyRegistry::Instance().Intern(key));
+            slot.boxed = value;
+            slot.ops   = &BoxedOps();
+        }
 
         // 데이터 조회
         std::any GetData(const std::string& key) const
         {
-            auto it = data_.find(key);
-            if (it != data_.end())
+            const Slot* slot = FindSlot(key);
+            return slot ? slot->ops->to_any(*slot) : std::any();
+        }
+
+        // 데이터 존재 여부 확인
+        bool HasData(const std::string& key) const { return FindSlot(key) != nullptr; }
+
+        // 데이터 삭제 (자기 계층만)
+        void RemoveData(const std::string& key)
+        {
+            uint32_t id;
+            if (BlackboardKeyRegistry::Instance().Find(key, id))
             {
-                return it->second;
+                ResetSlot(id);
             }
-            return std::any();
         }
 
-        // 데이터 존재 여부 확인
-        bool HasData(const std::string& key) const { return data_.find(key) != data_.end(); }
+        // 자기 계층의 모든 데이터 삭제 (부모 연결은 유지)
+        void Clear()
+        {
+            slots_.clear();
+            size_          = 0;
+            clear_version_ = ++version_;
+        }
 
-        // 데이터 삭제
-        void RemoveData(const std::string& key) { data_.erase(key); }
+        // 쓰기 버전 (자기 계층에 쓰기/삭제가 있을 때마다 증가, 부모 계층의 변경은 포함하지 않음)
+        uint32_t GetVersion() const { return version_; }
+
+        // 키에 마지막으로 쓰기/삭제가 있었던 시점의 버전 (캐시된 계산 결과가 아직 유효한지 확인용)
+        uint32_t GetWriteVersion(uint32_t id) const
+        {
+            uint32_t written = id < slots_.size() ? slots_[id].version : 0;
+            return written > clear_version_ ? written : clear_version_;
+        }
+        template <typename T>
+        uint32_t GetWriteVersion(const BlackboardKey<T>& key) const
+        {
+            return GetWriteVersion(key.GetId());
+        }
 
-        // 모든 데이터 삭제
-        void Clear() { data_.clear(); }
+        // since 버전 이후 자기 계층에 쓰기/삭제가 있었던 키마다 visit(키 id, 쓰기 버전, 삭제 여부) 호출 (실행 추적용)
+        // Clear로 지워진 키는 나오지 않는다 (Clear 이후에 다시 쓴 키만 나온다).
+        template <typename F>
+        void ForEachWriteSince(uint32_t since, F&& visit) const
+        {
+            for (uint32_t id = 0; id < slots_.size(); ++id)
+            {
+                if (slots_[id].version > since)
+                {
+                    visit(id, slots_[id].version, slots_[id].ops == nullptr);
+                }
+            }
+        }
 
-        // 데이터 개수
-        size_t Size() const { return data_.size(); }
+        // 자기 계층의 데이터 개수
+        size_t Size() const { return size_; }
 
         // 비어있는지 확인
-        bool Empty() const { return data_.empty(); }
+        bool Empty() const { return size_ == 0; }
 
         // 타입 안전한 데이터 접근
         template <typename T>
         T GetDataAs(const std::string& key) const
         {
-            auto it = data_.find(key);
-            if (it != data_.end())
+            const Slot* slot = FindSlot(key);
+            if (slot)
             {
-                try
+                if (const T* value = SlotValue<T>(*slot))
                 {
-                    return std::any_cast<T>(it->second);
+                    return *value;
                 }
-                catch (const std::bad_any_cast& e)
+
+                // 타입 변환 실패 시 기본값 반환
+                if constexpr (std::is_default_constructible_v<T>)
+                {
+                    return T{};
+                }
+                else
                 {
-                    // 타입 변환 실패 시 기본값 반환
-                    if constexpr (std::is_default_constructible_v<T>)
-                    {
-                        return T{};
-                    }
-                    else
-                    {
-                        throw std::runtime_error("Blackboard: 타입 변환 실패 - " + std::string(e.what()));
-                    }
+                    throw std::runtime_error("Blackboard: 타입 변환 실패 - " + key);
                 }
             }
 
@@ -88,17 +288,20 @@ namespace bt
         template <typename T>
         void SetData(const std::string& key, const T& value)
         {
-            data_[key] = value;
+            SetSlot<std::decay_t<T>>(BlackboardKeyRegistry::Instance().Intern(key), value); // 문자열 리터럴은 포인터로
         }
 
         // 키 목록 조회
         std::vector<std::string> GetKeys() const
         {
             std::vector<std::string> keys;
-            keys.reserve(data_.size());
-            for (const auto& pair : data_)
+            keys.reserve(size_);
+            for (uint32_t id = 0; id < slots_.size(); ++id)
             {
-                keys.push_back(pair.first);
+                if (slots_[id].ops)
+                {
+                    keys.push_back(BlackboardKeyRegistry::Instance().GetName(id));
+                }
             }
             return keys;
         }
@@ -108,16 +311,11 @@ namespace bt
         std::vector<std::pair<std::string, T>> GetDataOfType() const
         {
             std::vector<std::pair<std::string, T>> result;
-            for (const auto& pair : data_)
+            for (uint32_t id = 0; id < slots_.size(); ++id)
             {
-                try
+                if (const T* value = SlotValue<T>(slots_[id]))
                 {
-                    T value = std::any_cast<T>(pair.second);
-                    result.emplace_back(pair.first, value);
-                }
-                catch (const std::bad_any_cast&)
-                {
-                    // 타입이 맞지 않으면 무시
+                    result.emplace_back(BlackboardKeyRegistry::Instance().GetName(id), *value);
                 }
             }
             return result;
@@ -127,9 +325,14 @@ namespace bt
         void PrintAllData() const
         {
             std::cout << "=== Blackboard Contents ===" << std::endl;
-            for (const auto& pair : data_)
+            for (uint32_t id = 0; id < slots_.size(); ++id)
             {
-                std::cout << "Key: " << pair.first << " (Type: " << pair.second.type().name() << ")" << std::endl;
+                const Slot& slot = slots_[id];
+                if (slot.ops)
+                {
+                    std::cout << "Key: " << BlackboardKeyRegistry::Instance().GetName(id)
+                              << " (Type: " << slot.ops->type(slot).name() << ")" << std::endl;
+                }
             }
             std::cout << "=========================" << std::endl;
         }
@@ -140,10 +343,146 @@ namespace bt
 
         // 이동 생성자 및 할당 연산자
         Blackboard(Blackboard&& other) noexcept            = default;
-        Blackboard& operator=(Blackboard&& other) noexcept = default;
+        Blackboard& operator=(Blackboard&& other)          = default; // 할당기가 다르면 슬롯을 옮겨 담는다
 
     private:
-        std::unordered_map<std::string, std::any> data_;
+        struct Slot;
+
+        // 슬롯에 저장된 값의 타입별 연산 (ops 포인터가 곧 타입 태그)
+        struct SlotOps
+        {
+            std::any (*to_any)(const Slot&);
+            const std::type_info& (*type)(const Slot&);
+        };
+
+        struct Slot
+        {
+            const SlotOps* ops = nullptr; // nullptr이면 빈 슬롯
+            alignas(std::max_align_t) unsigned char inline_data[16];
+            std::any boxed;
+            uint32_t version = 0; // 마지막 쓰기/삭제 버전
+        };
+
+        template <typename T>
+        static const SlotOps& InlineOps()
+        {
+            static const SlotOps ops = {
+                [](const Slot& slot) -> std::any
+                { return *std::launder(reinterpret_cast<const T*>(slot.inline_data)); },
+                [](const Slot&) -> const std::type_info& { return typeid(T); }};
+            return ops;
+        }
+
+        static const SlotOps& BoxedOps()
+        {
+            static const SlotOps ops = {[](const Slot& slot) -> std::any { return slot.boxed; },
+                                        [](const Slot& slot) -> const std::type_info& { return slot.boxed.type(); }};
+            return ops;
+        }
+
+        template <typename T>
+        static const T* SlotValue(const Slot& slot)
+        {
+            if constexpr (IsInline<T>)
+            {
+                if (slot.ops == &InlineOps<T>())
+                {
+                    return std::launder(reinterpret_cast<const T*>(slot.inline_data));
+                }
+            }
+            // std::any로 저장된 값 (예외 없는 포인터 캐스트)
+            return slot.ops == &BoxedOps() ? std::any_cast<T>(&slot.boxed) : nullptr;
+        }
+
+        // 값이 있는 가장 가까운 계층의 슬롯
+        const Slot* LookupSlot(uint32_t id) const
+        {
+            for (const Blackboard* layer = this; layer; layer = layer->parent_.get())
+            {
+                if (layer->HasSlot(id))
+                {
+                    return &layer->slots_[id];
+                }
+            }
+            return nullptr;
+        }
+
+        template <typename T>
+        const T* GetSlot(uint32_t id) const
+        {
+            const Slot* slot = LookupSlot(id);
+            return slot ? SlotValue<T>(*slot) : nullptr;
+        }
+
+        template <typename T>
+        void SetSlot(uint32_t id, const T& value)
+        {
+            Slot& slot = AcquireSlot(id);
+            if constexpr (IsInline<T>)
+            {
+                if (slot.ops == &BoxedOps())
+                {
+                    slot.boxed.reset();
+                }
+                new (slot.inline_data) T(value);
+                slot.ops = &InlineOps<T>();
+            }
+            else
+            {
+                // 같은 타입이면 기존 저장소에 대입 (재할당 방지)
+                T* existing = slot.ops == &BoxedOps() ? std::any_cast<T>(&slot.boxed) : nullptr;
+                if (existing)
+                {
+                    *existing = value;
+                }
+                else
+                {
+                    slot.boxed = value;
+                }
+                slot.ops = &BoxedOps();
+            }
+        }
+
+        Slot& AcquireSlot(uint32_t id)
+        {
+            if (id >= slots_.size())
+            {
+                slots_.resize(id + 1);
+            }
+            Slot& slot = slots_[id];
+            if (!slot.ops)
+            {
+                size_++;
+            }
+            slot.version = ++version_;
+            return slot;
+        }
+
+        bool HasSlot(uint32_t id) const { return id < slots_.size() && slots_[id].ops != nullptr; }
+
+        void ResetSlot(uint32_t id)
+        {
+            if (!HasSlot(id))
+                return;
+            slots_[id].ops = nullptr;
+            slots_[id].boxed.reset();
+            slots_[id].version = ++version_;
+            size_--;
+        }
+
+        const Slot* FindSlot(const std::string& key) const
+        {
+            uint32_t id;
+            if (!BlackboardKeyRegistry::Instance().Find(key, id))
+                return nullptr;
+            return LookupSlot(id);
+        }
+
+        std::pmr::vector<Slot>            slots_; // 키 id로 인덱싱
+        size_t                            size_          = 0;
+        uint32_t                          version_       = 0;
+        uint32_t                          clear_version_ = 0;
+        std::shared_ptr<const Blackboard> parent_; // 조회가 이어지는 부모 계층
     };
 
 } // namespace bt
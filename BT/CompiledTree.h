@@ -0,0 +1,1243 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+
+#include "BatchNode.h"
+#include "Context.h"
+#include "Control/Parallel.h"
+#include "Control/Random.h"
+#include "Control/Selector.h"
+#include "Control/Sequence.h"
+#include "Decorator/Cooldown.h"
+#include "Decorator/Delay.h"
+#include "Decorator/Invert.h"
+#include "Decorator/Repeat.h"
+#include "Decorator/Timeout.h"
+#include "Node.h"
+
+namespace bt
+{
+
+    // 컴파일된 노드의 명령 코드
+    enum class OpCode : uint8_t
+    {
+        LEAF, // 불투명 노드 (Action/Condition/사용자 정의 노드) - Execute 직접 호출
+        SEQUENCE,
+        SELECTOR,
+        PARALLEL,
+        RANDOM,
+        REPEAT,
+        INVERT,
+        DELAY,
+        TIMEOUT,
+        COOLDOWN
+    };
+
+    // 컴파일된 노드 플래그
+    enum CompiledFlag : uint8_t
+    {
+        FLAG_MEMORY     = 1 << 0, // 메모리 Sequence/Selector
+        FLAG_GUARD      = 1 << 1, // 조건 노드 (메모리 모드에서 재확인 대상)
+        FLAG_CONCURRENT = 1 << 2  // 동시 실행 Parallel
+    };
+
+    // 평탄화된 노드 레코드 (전위 순회 순서로 배열에 저장)
+    // 첫 자식은 항상 index + 1, 다음 형제는 subtree_end에 위치한다.
+    struct CompiledNode
+    {
+        OpCode   op          = OpCode::LEAF;
+        uint8_t  flags       = 0; // CompiledFlag 조합
+        uint16_t child_count = 0;
+        uint32_t subtree_end = 0; // 이 노드의 서브트리 바로 다음 인덱스
+        uint32_t payload     = 0; // LEAF: leaves_ 인덱스
+        int32_t  param       = 0; // PARALLEL: 정책, REPEAT: 반복 횟수, DELAY/TIMEOUT/COOLDOWN: 밀리초
+    };
+
+    // Node 그래프를 평탄화한 실행 전용 트리
+    // 저작은 기존 Node 그래프로 하고, Tree::Compile()로 이 형태로 변환해 실행한다.
+    // 복합/데코레이터 노드는 switch로 해석하므로 가상 호출과 shared_ptr 참조 카운트가 없다.
+    // 레코드 인덱스는 노드 id와 같으며, 런타임 상태는 에이전트별 Context의 NodeState를 사용한다.
+    class CompiledTree
+    {
+    public:
+        explicit CompiledTree(std::shared_ptr<Node> root) : root_(std::move(root))
+        {
+            if (root_)
+            {
+                Flatten(root_.get(), 0);
+            }
+        }
+
+        // 한 번에 묶어 실행하기 좋은 에이전트 수 (노드마다 목록을 다시 훑으므로 묶음의 컨텍스트가 캐시에 남아야 한다)
+        static constexpr size_t kBatchChunk = 128;
+
+        // 배치 실행 작업 공간 (호출자가 보관해 재사용하면 정상 상태에서 할당이 없다, 한 번에 한 스레드만 사용)
+        struct BatchScratch
+        {
+            struct Level
+            {
+                std::vector<uint32_t> pending; // 아직 결과가 정해지지 않은 슬롯
+                std::vector<uint32_t> next;
+                std::vector<uint32_t> ticked;  // 이번 자식을 실행하는 슬롯
+                std::vector<uint32_t> marks;   // 노드 실행 전 스케줄링 표시 (ticked와 같은 순서)
+                std::vector<uint32_t> starts;  // 메모리 Sequence/Selector의 재개 위치 (슬롯 인덱스)
+            };
+
+            std::vector<uint32_t> slots;
+            std::vector<Level>    levels; // 트리 깊이별 (자식 호출이 부모의 목록을 덮어쓰지 않도록)
+        };
+
+        // 노드 id 부여: 해석 대상 노드는 전위 순서(컴파일 인덱스와 동일), 불투명 노드의 자손은 그 뒤에 부여
+        // 반환값은 전체 노드 수 (에이전트별 상태 블록 크기)
+        static uint32_t AssignNodeIds(Node* root)
+        {
+            uint32_t           next_id = 0;
+            std::vector<Node*> opaque;
+            AssignInterpretedIds(root, next_id, opaque);
+            for (Node* node : opaque)
+            {
+                AssignOpaqueIds(node, next_id);
+            }
+            return next_id;
+        }
+
+        // 타입 태그가 라이브러리 구현과 일치할 때만 해석 대상으로 취급
+        static OpCode ClassifyNode(Node* node)
+        {
+            switch (node->GetType())
+            {
+                case NodeType::SEQUENCE:
+                    return dynamic_cast<Sequence*>(node) ? OpCode::SEQUENCE : OpCode::LEAF;
+                case NodeType::SELECTOR:
+                    return dynamic_cast<Selector*>(node) ? OpCode::SELECTOR : OpCode::LEAF;
+                case NodeType::PARALLEL:
+                    return dynamic_cast<Parallel*>(node) ? OpCode::PARALLEL : OpCode::LEAF;
+                case NodeType::RANDOM:
+                    return dynamic_cast<Random*>(node) ? OpCode::RANDOM : OpCode::LEAF;
+                case NodeType::REPEAT:
+                    return dynamic_cast<Repeat*>(node) ? OpCode::REPEAT : OpCode::LEAF;
+                case NodeType::INVERT:
+                    return dynamic_cast<Invert*>(node) ? OpCode::INVERT : OpCode::LEAF;
+                case NodeType::DELAY:
+                    return dynamic_cast<Delay*>(node) ? OpCode::DELAY : OpCode::LEAF;
+                case NodeType::TIMEOUT:
+                    return dynamic_cast<Timeout*>(node) ? OpCode::TIMEOUT : OpCode::LEAF;
+                case NodeType::COOLDOWN:
+                    return dynamic_cast<Cooldown*>(node) ? OpCode::COOLDOWN : OpCode::LEAF;
+                default:
+                    return OpCode::LEAF;
+            }
+        }
+
+        // 트리 실행
+        NodeStatus Execute(Context& context)
+        {
+            if (nodes_.empty())
+            {
+                return NodeStatus::FAILURE;
+            }
+            return Tick(0, context);
+        }
+
+        // 같은 트리를 실행하는 여러 에이전트를 노드 단위로 묶어 실행
+        // 각 노드를 그 노드에 도달한 에이전트 목록에 대해 한 번 방문하고, 목록은 자식을 지날 때마다 줄어든다
+        // (Sequence는 SUCCESS인 에이전트만, Selector는 FAILURE인 에이전트만 다음 자식으로 내려간다).
+        // IBatchLeaf 리프는 목록 전체에 대해 한 번 호출되고, 그 외 리프는 에이전트마다 Evaluate한다.
+        // Sequence/Selector(반응형/메모리)/Invert 외의 노드는 에이전트별 해석(Tick)으로 처리한다.
+        // 에이전트별로 보면 노드 실행 순서와 상태 기록이 Execute와 같으므로 결과도 같다. 단, 서로 다른 에이전트의
+        // 리프 호출은 섞여서 일어나므로 리프가 다른 에이전트와 공유하는 상태에 쓰면 안 된다 (병렬 틱과 같은 계약).
+        // 모든 컨텍스트는 Tree::ExecuteBatch로 이 트리에 바인딩되어 있어야 하며(실행 모드 동일), 결과는
+        // statuses[0..count)에 기록된다.
+        void ExecuteBatch(Context* const* contexts, size_t count, NodeStatus* statuses, BatchScratch& scratch)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+            if (nodes_.empty())
+            {
+                std::fill(statuses, statuses + count, NodeStatus::FAILURE);
+                return;
+            }
+
+            Batch batch = BeginBatch(contexts, count, statuses, scratch);
+            TickBatch(0, scratch.slots.data(), count, 0, batch);
+        }
+
+        // RootGuardPasses의 배치 버전 (통과하면 statuses[i]가 SUCCESS, 아니면 FAILURE)
+        void RootGuardPassesBatch(Context* const* contexts, size_t count, NodeStatus* statuses, BatchScratch& scratch)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+            if (nodes_.empty())
+            {
+                std::fill(statuses, statuses + count, NodeStatus::FAILURE);
+                return;
+            }
+
+            Batch batch = BeginBatch(contexts, count, statuses, scratch);
+            GuardPassesBatch(0, scratch.slots.data(), count, 0, batch);
+        }
+
+        // 루트의 선점 가드 확인 (이 트리를 SubTree로 쓰는 바깥 메모리 Selector용, 가드가 없으면 false)
+        bool RootGuardPasses(Context& context) { return !nodes_.empty() && GuardPasses(0, context); }
+
+        // 에이전트의 실행 중 경로 중단
+        void Halt(Context& context)
+        {
+            if (!nodes_.empty())
+            {
+                HaltSubtree(0, context);
+            }
+        }
+
+        // 새로운 실행 시작 시 원본 노드 초기화 (재귀 없이 평탄한 순회)
+        void InitializeNodes()
+        {
+            for (Node* node : init_nodes_)
+            {
+                node->Initialize();
+            }
+        }
+
+        // 정보
+        size_t                           GetNodeCount() const { return nodes_.size(); }
+        size_t                           GetLeafCount() const { return leaves_.size(); }
+        const std::vector<CompiledNode>& GetNodes() const { return nodes_; }
+        Node*                            GetSourceNode(uint32_t index) const { return sources_[index]; }
+
+    private:
+        static void AssignInterpretedIds(Node* node, uint32_t& next_id, std::vector<Node*>& opaque)
+        {
+            node->SetId(next_id++);
+            if (ClassifyNode(node) == OpCode::LEAF)
+            {
+                opaque.push_back(node);
+                return;
+            }
+            for (const auto& child : node->GetChildren())
+            {
+                if (child)
+                {
+                    AssignInterpretedIds(child.get(), next_id, opaque);
+                }
+            }
+        }
+
+        static void AssignOpaqueIds(Node* node, uint32_t& next_id)
+        {
+            for (const auto& child : node->GetChildren())
+            {
+                if (child)
+                {
+                    child->SetId(next_id++);
+                    AssignOpaqueIds(child.get(), next_id);
+                }
+            }
+        }
+
+        uint32_t Flatten(Node* node, uint32_t depth)
+        {
+            max_depth_ = std::max(max_depth_, depth);
+            uint32_t index = static_cast<uint32_t>(nodes_.size());
+            nodes_.emplace_back();
+            sources_.push_back(node);
+            init_nodes_.push_back(node);
+
+            CompiledNode record;
+            record.op = ClassifyNode(node);
+            if (node->IsGuard())
+            {
+                record.flags |= FLAG_GUARD;
+            }
+
+            switch (record.op)
+            {
+                case OpCode::LEAF:
+                    record.payload = static_cast<uint32_t>(leaves_.size());
+                    leaves_.push_back(node);
+                    batch_leaves_.push_back(dynamic_cast<IBatchLeaf*>(node));
+                    break;
+                case OpCode::SEQUENCE:
+                    if (static_cast<Sequence*>(node)->IsMemory())
+                        record.flags |= FLAG_MEMORY;
+                    break;
+                case OpCode::SELECTOR:
+                    if (static_cast<Selector*>(node)->IsMemory())
+                        record.flags |= FLAG_MEMORY;
+                    break;
+                case OpCode::PARALLEL:
+                    record.param = static_cast<int32_t>(static_cast<Parallel*>(node)->GetPolicy());
+                    if (static_cast<Parallel*>(node)->IsConcurrent())
+                        record.flags |= FLAG_CONCURRENT;
+                    break;
+                case OpCode::REPEAT:
+                    record.param = static_cast<Repeat*>(node)->GetRepeatCount();
+                    break;
+                case OpCode::DELAY:
+                    record.param = static_cast<int32_t>(static_cast<Delay*>(node)->GetDelay().count());
+                    break;
+                case OpCode::TIMEOUT:
+                    record.param = static_cast<int32_t>(static_cast<Timeout*>(node)->GetTimeout().count());
+                    break;
+                case OpCode::COOLDOWN:
+                    record.param = static_cast<int32_t>(static_cast<Cooldown*>(node)->GetCooldown().count());
+                    break;
+                default:
+                    break;
+            }
+
+            // 불투명 노드는 자식을 스스로 실행하므로 펼치지 않고 초기화 목록에만 넣는다
+            if (record.op == OpCode::LEAF)
+            {
+                CollectOpaqueChildren(node);
+            }
+            else
+            {
+                for (const auto& child : node->GetChildren())
+                {
+                    // 기존 Sequence/Selector처럼 null 자식은 건너뛴다
+                    if (!child)
+                        continue;
+                    Flatten(child.get(), depth + 1);
+                    record.child_count++;
+                }
+            }
+
+            record.subtree_end = static_cast<uint32_t>(nodes_.size());
+            nodes_[index]      = record;
+            return index;
+        }
+
+        void CollectOpaqueChildren(Node* node)
+        {
+            for (const auto& child : node->GetChildren())
+            {
+                if (!child)
+                    continue;
+                init_nodes_.push_back(child.get());
+                CollectOpaqueChildren(child.get());
+            }
+        }
+
+        // 배치 실행 상태 (ExecuteBatch 한 번 동안 유효)
+        struct Batch
+        {
+            Context* const* contexts;
+            NodeStatus*     statuses; // 슬롯별 마지막으로 실행한 노드의 결과
+            BatchScratch&   scratch;
+            size_t          count;
+        };
+
+        Batch BeginBatch(Context* const* contexts, size_t count, NodeStatus* statuses, BatchScratch& scratch) const
+        {
+            if (scratch.levels.size() <= max_depth_)
+            {
+                scratch.levels.resize(max_depth_ + 1);
+            }
+            scratch.slots.resize(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                scratch.slots[i] = static_cast<uint32_t>(i);
+            }
+            return Batch{contexts, statuses, scratch, count};
+        }
+
+        static void ReserveStarts(BatchScratch::Level& level, size_t count)
+        {
+            if (level.starts.size() < count)
+            {
+                level.starts.resize(count);
+            }
+        }
+
+        // Tick의 배치 버전 (slots의 각 에이전트에 대해 노드 실행 후 상태 기록)
+        void TickBatch(uint32_t index, const uint32_t* slots, size_t count, uint32_t depth, Batch& batch)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            std::vector<uint32_t>& marks = batch.scratch.levels[depth].marks;
+            marks.resize(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                marks[i] = batch.contexts[slots[i]]->GetSchedulingMark();
+            }
+
+            DispatchBatch(index, slots, count, depth, batch);
+
+            // 자식 호출이 같은 깊이의 marks를 쓰지 않으므로 그대로 유효하다
+            for (size_t i = 0; i < count; ++i)
+            {
+                Context&         context = *batch.contexts[slots[i]];
+                const NodeStatus status  = batch.statuses[slots[i]];
+                if (status == NodeStatus::RUNNING && context.GetSchedulingMark() == marks[i])
+                {
+                    context.MarkBusy();
+                }
+                NodeState& state  = context.GetNodeState(index);
+                state.last_status = status;
+                state.is_running  = (status == NodeStatus::RUNNING);
+            }
+        }
+
+        void DispatchBatch(uint32_t index, const uint32_t* slots, size_t count, uint32_t depth, Batch& batch)
+        {
+            const CompiledNode& node = nodes_[index];
+
+            switch (node.op)
+            {
+                case OpCode::LEAF:
+                    TickLeafBatch(node, slots, count, depth, batch);
+                    return;
+
+                case OpCode::SEQUENCE:
+                case OpCode::SELECTOR:
+                {
+                    // 같은 트리에 바인딩된 컨텍스트는 실행 모드가 같다
+                    const NodeStatus proceed = node.op == OpCode::SEQUENCE ? NodeStatus::SUCCESS : NodeStatus::FAILURE;
+                    if (!IsMemory(node, *batch.contexts[slots[0]]))
+                    {
+                        TickReactiveBatch(index, proceed, slots, count, depth, batch);
+                    }
+                    else if (node.op == OpCode::SEQUENCE)
+                    {
+                        TickMemorySequenceBatch(index, slots, count, depth, batch);
+                    }
+                    else
+                    {
+                        TickMemorySelectorBatch(index, slots, count, depth, batch);
+                    }
+                    return;
+                }
+
+                case OpCode::INVERT:
+                    if (node.child_count == 0)
+                    {
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            batch.statuses[slots[i]] = NodeStatus::SUCCESS;
+                        }
+                        return;
+                    }
+                    TickBatch(index + 1, slots, count, depth + 1, batch);
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        NodeStatus& status = batch.statuses[slots[i]];
+                        if (status != NodeStatus::RUNNING)
+                        {
+                            status = status == NodeStatus::SUCCESS ? NodeStatus::FAILURE : NodeStatus::SUCCESS;
+                        }
+                    }
+                    return;
+
+                default:
+                    // 에이전트별 시간/카운터 상태를 쓰는 노드는 한 명씩 해석
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        batch.statuses[slots[i]] = Dispatch(index, *batch.contexts[slots[i]]);
+                    }
+                    return;
+            }
+        }
+
+        void TickLeafBatch(const CompiledNode& node, const uint32_t* slots, size_t count, uint32_t depth, Batch& batch)
+        {
+            Node*       leaf       = leaves_[node.payload];
+            IBatchLeaf* batch_leaf = batch_leaves_[node.payload];
+            if (!batch_leaf)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    batch.statuses[slots[i]] = leaf->Evaluate(*batch.contexts[slots[i]]);
+                }
+                return;
+            }
+            if (!leaf->IsPure())
+            {
+                batch_leaf->ExecuteBatch(batch.contexts, slots, count, batch.statuses);
+                return;
+            }
+
+            // 순수 노드는 이번 틱에 캐시된 결과가 없는 에이전트만 모아 계산
+            std::vector<uint32_t>& missed = batch.scratch.levels[depth].next;
+            missed.clear();
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (!leaf->RecallMemo(*batch.contexts[slots[i]], batch.statuses[slots[i]]))
+                {
+                    missed.push_back(slots[i]);
+                }
+            }
+            batch_leaf->ExecuteBatch(batch.contexts, missed.data(), missed.size(), batch.statuses);
+            for (uint32_t slot : missed)
+            {
+                leaf->StoreMemo(*batch.contexts[slot], batch.statuses[slot]);
+            }
+        }
+
+        // 반응형 Sequence/Selector: proceed 결과를 낸 에이전트만 다음 자식으로 진행
+        void TickReactiveBatch(uint32_t        index,
+                               NodeStatus      proceed,
+                               const uint32_t* slots,
+                               size_t          count,
+                               uint32_t        depth,
+                               Batch&          batch)
+        {
+            const uint32_t         end     = nodes_[index].subtree_end;
+            BatchScratch::Level&   level   = batch.scratch.levels[depth];
+            std::vector<uint32_t>& pending = level.pending;
+            std::vector<uint32_t>& next    = level.next;
+            pending.assign(slots, slots + count);
+
+            for (uint32_t child = index + 1; child < end && !pending.empty(); child = nodes_[child].subtree_end)
+            {
+                TickBatch(child, pending.data(), pending.size(), depth + 1, batch);
+                next.clear();
+                for (uint32_t slot : pending)
+                {
+                    const NodeStatus status = batch.statuses[slot];
+                    if (status == proceed)
+                    {
+                        next.push_back(slot);
+                    }
+                    else
+                    {
+                        SwitchRunningChild(index, child, status, *batch.contexts[slot]);
+                    }
+                }
+                pending.swap(next);
+            }
+
+            for (uint32_t slot : pending)
+            {
+                batch.statuses[slot] = SwitchRunningChild(index, end, proceed, *batch.contexts[slot]);
+            }
+        }
+
+        // TickMemorySequence의 배치 버전: 재개 위치가 c 이하인 에이전트는 c를 실행하고,
+        // 아직 재개 위치에 도달하지 않은 에이전트는 c가 가드 조건이면 재확인만 한다
+        void TickMemorySequenceBatch(uint32_t index, const uint32_t* slots, size_t count, uint32_t depth, Batch& batch)
+        {
+            const uint32_t         end     = nodes_[index].subtree_end;
+            BatchScratch::Level&   level   = batch.scratch.levels[depth];
+            std::vector<uint32_t>& pending = level.pending;
+            std::vector<uint32_t>& next    = level.next;
+            std::vector<uint32_t>& ticked  = level.ticked;
+            ReserveStarts(level, batch.count);
+            pending.assign(slots, slots + count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                level.starts[slots[i]] = ResumeChild(index, *batch.contexts[slots[i]]);
+            }
+
+            for (uint32_t child = index + 1; child < end && !pending.empty(); child = nodes_[child].subtree_end)
+            {
+                const bool guard = (nodes_[child].flags & FLAG_GUARD) != 0;
+                ticked.clear();
+                for (uint32_t slot : pending)
+                {
+                    if (level.starts[slot] <= child || guard)
+                    {
+                        ticked.push_back(slot);
+                    }
+                }
+                TickBatch(child, ticked.data(), ticked.size(), depth + 1, batch);
+
+                next.clear();
+                for (uint32_t slot : pending)
+                {
+                    const uint32_t start = level.starts[slot];
+                    if (start > child && !guard)
+                    {
+                        next.push_back(slot); // 이 자식은 건너뜀
+                        continue;
+                    }
+
+                    Context&   context = *batch.contexts[slot];
+                    NodeStatus status  = batch.statuses[slot];
+                    if (status == NodeStatus::SUCCESS)
+                    {
+                        next.push_back(slot);
+                    }
+                    else if (start > child)
+                    {
+                        HaltSubtree(start, context); // 가드 실패: 실행 중인 자식 중단
+                        context.GetNodeState(index).child_index = 0;
+                        batch.statuses[slot]                    = NodeStatus::FAILURE;
+                    }
+                    else
+                    {
+                        context.GetNodeState(index).child_index = (status == NodeStatus::RUNNING) ? child : 0;
+                    }
+                }
+                pending.swap(next);
+            }
+
+            for (uint32_t slot : pending)
+            {
+                batch.contexts[slot]->GetNodeState(index).child_index = 0;
+                batch.statuses[slot]                                  = NodeStatus::SUCCESS;
+            }
+        }
+
+        // TickMemorySelector의 배치 버전: 앞선 자식의 가드를 에이전트 묶음으로 확인해 재개 위치를 정한 뒤,
+        // 재개 위치가 c 이하인 에이전트만 c를 실행한다
+        void TickMemorySelectorBatch(uint32_t index, const uint32_t* slots, size_t count, uint32_t depth, Batch& batch)
+        {
+            const uint32_t         end     = nodes_[index].subtree_end;
+            BatchScratch::Level&   level   = batch.scratch.levels[depth];
+            std::vector<uint32_t>& pending = level.pending;
+            std::vector<uint32_t>& next    = level.next;
+            std::vector<uint32_t>& ticked  = level.ticked;
+            ReserveStarts(level, batch.count);
+
+            pending.clear();
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint32_t start   = ResumeChild(index, *batch.contexts[slots[i]]);
+                level.starts[slots[i]] = start;
+                if (start > index + 1)
+                {
+                    pending.push_back(slots[i]); // 가드 확인 대상
+                }
+            }
+
+            // 가드가 통과한 첫 앞선 자식으로 재개 위치를 당긴다
+            for (uint32_t child = index + 1; !pending.empty(); child = nodes_[child].subtree_end)
+            {
+                ticked.clear();
+                next.clear();
+                for (uint32_t slot : pending)
+                {
+                    if (level.starts[slot] > child)
+                    {
+                        ticked.push_back(slot);
+                    }
+                }
+                if (ticked.empty())
+                {
+                    break;
+                }
+                GuardPassesBatch(child, ticked.data(), ticked.size(), depth + 1, batch);
+                for (uint32_t slot : ticked)
+                {
+                    if (batch.statuses[slot] == NodeStatus::SUCCESS)
+                    {
+                        HaltSubtree(level.starts[slot], *batch.contexts[slot]);
+                        level.starts[slot] = child;
+                    }
+                    else
+                    {
+                        next.push_back(slot);
+                    }
+                }
+                pending.swap(next);
+            }
+
+            pending.assign(slots, slots + count);
+            for (uint32_t child = index + 1; child < end && !pending.empty(); child = nodes_[child].subtree_end)
+            {
+                ticked.clear();
+                for (uint32_t slot : pending)
+                {
+                    if (level.starts[slot] <= child)
+                    {
+                        ticked.push_back(slot);
+                    }
+                }
+                TickBatch(child, ticked.data(), ticked.size(), depth + 1, batch);
+
+                next.clear();
+                for (uint32_t slot : pending)
+                {
+                    const NodeStatus status = batch.statuses[slot];
+                    if (level.starts[slot] > child || status == NodeStatus::FAILURE)
+                    {
+                        next.push_back(slot);
+                    }
+                    else
+                    {
+                        batch.contexts[slot]->GetNodeState(index).child_index =
+                            (status == NodeStatus::RUNNING) ? child : 0;
+                    }
+                }
+                pending.swap(next);
+            }
+
+            for (uint32_t slot : pending)
+            {
+                batch.contexts[slot]->GetNodeState(index).child_index = 0;
+                batch.statuses[slot]                                  = NodeStatus::FAILURE;
+            }
+        }
+
+        // GuardPasses의 배치 버전 (통과하면 statuses[slot]이 SUCCESS, 아니면 FAILURE)
+        void GuardPassesBatch(uint32_t child, const uint32_t* slots, size_t count, uint32_t depth, Batch& batch)
+        {
+            const CompiledNode& node = nodes_[child];
+            if (node.flags & FLAG_GUARD)
+            {
+                TickBatch(child, slots, count, depth, batch);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    NodeStatus& status = batch.statuses[slots[i]];
+                    if (status != NodeStatus::SUCCESS)
+                    {
+                        status = NodeStatus::FAILURE;
+                    }
+                }
+                return;
+            }
+            if (node.op == OpCode::LEAF)
+            {
+                if (IBatchLeaf* batch_leaf = batch_leaves_[node.payload])
+                {
+                    batch_leaf->PassesGuardBatch(batch.contexts, slots, count, batch.statuses);
+                    return;
+                }
+                for (size_t i = 0; i < count; ++i)
+                {
+                    batch.statuses[slots[i]] = leaves_[node.payload]->PassesGuard(*batch.contexts[slots[i]])
+                                                   ? NodeStatus::SUCCESS
+                                                   : NodeStatus::FAILURE;
+                }
+                return;
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                batch.statuses[slots[i]] = NodeStatus::FAILURE;
+            }
+            if (node.op != OpCode::SEQUENCE)
+            {
+                return;
+            }
+
+            // Sequence 선두의 가드들 (child 자체는 실행하지 않으므로 child 깊이의 목록을 쓴다)
+            BatchScratch::Level&   level     = batch.scratch.levels[depth];
+            std::vector<uint32_t>& pending   = level.pending;
+            std::vector<uint32_t>& next      = level.next;
+            bool                   has_guard = false;
+            pending.assign(slots, slots + count);
+            for (uint32_t guard = child + 1; guard < node.subtree_end && !pending.empty();
+                 guard          = nodes_[guard].subtree_end)
+            {
+                if (!(nodes_[guard].flags & FLAG_GUARD))
+                    break;
+                TickBatch(guard, pending.data(), pending.size(), depth + 1, batch);
+                has_guard = true;
+                next.clear();
+                for (uint32_t slot : pending)
+                {
+                    if (batch.statuses[slot] == NodeStatus::SUCCESS)
+                    {
+                        next.push_back(slot);
+                    }
+                    else
+                    {
+                        batch.statuses[slot] = NodeStatus::FAILURE;
+                    }
+                }
+                pending.swap(next);
+            }
+            if (!has_guard)
+            {
+                for (uint32_t slot : pending)
+                {
+                    batch.statuses[slot] = NodeStatus::FAILURE;
+                }
+            }
+        }
+
+        // 레코드 실행 후 에이전트별 상태 기록 (Node::Tick과 동일)
+        NodeStatus Tick(uint32_t index, Context& context)
+        {
+            auto tick = [&]()
+            {
+                uint32_t mark = context.GetSchedulingMark();
+#ifndef BT_DISABLE_TRACING
+                Tracer*    tracer = context.GetTracer();
+                NodeStatus status = tracer ? tracer->Trace(index, IsLeaf(index), context,
+                                                           [&]() { return Dispatch(index, context); })
+                                           : Dispatch(index, context);
+#else
+                NodeStatus status = Dispatch(index, context);
+#endif
+                if (status == NodeStatus::RUNNING && context.GetSchedulingMark() == mark)
+                {
+                    context.MarkBusy();
+                }
+
+                NodeState& state  = context.GetNodeState(index);
+                state.last_status = status;
+                state.is_running  = (status == NodeStatus::RUNNING);
+                return status;
+            };
+
+#ifndef BT_DISABLE_PROFILING
+            if (Profiler* profiler = context.GetProfiler())
+            {
+                return profiler->Measure(index, tick);
+            }
+#endif
+            return tick();
+        }
+
+        // 자식이 없는 노드인지 (불투명 노드는 원본의 자식 유무, 실행 추적에서 리프를 구분할 때 사용)
+        bool IsLeaf(uint32_t index) const
+        {
+            const CompiledNode& node = nodes_[index];
+            return node.op == OpCode::LEAF ? leaves_[node.payload]->GetChildren().empty() : node.child_count == 0;
+        }
+
+        NodeStatus Dispatch(uint32_t index, Context& context)
+        {
+            const CompiledNode& node = nodes_[index];
+
+            switch (node.op)
+            {
+                case OpCode::LEAF:
+                    return leaves_[node.payload]->Evaluate(context);
+
+                case OpCode::SEQUENCE:
+                    if (IsMemory(node, context))
+                    {
+                        return TickMemorySequence(index, context);
+                    }
+                    for (uint32_t child = index + 1; child < node.subtree_end; child = nodes_[child].subtree_end)
+                    {
+                        NodeStatus status = Tick(child, context);
+                        if (status != NodeStatus::SUCCESS)
+                        {
+                            return SwitchRunningChild(index, child, status, context);
+                        }
+                    }
+                    return SwitchRunningChild(index, node.subtree_end, NodeStatus::SUCCESS, context);
+
+                case OpCode::SELECTOR:
+                    if (IsMemory(node, context))
+                    {
+                        return TickMemorySelector(index, context);
+                    }
+                    for (uint32_t child = index + 1; child < node.subtree_end; child = nodes_[child].subtree_end)
+                    {
+                        NodeStatus status = Tick(child, context);
+                        if (status != NodeStatus::FAILURE)
+                        {
+                            return SwitchRunningChild(index, child, status, context);
+                        }
+                    }
+                    return SwitchRunningChild(index, node.subtree_end, NodeStatus::FAILURE, context);
+
+                case OpCode::PARALLEL:
+                    return TickParallel(index, context);
+
+                case OpCode::RANDOM:
+                {
+                    if (node.child_count == 0)
+                    {
+                        return NodeStatus::FAILURE;
+                    }
+                    uint32_t         child = NthChild(index, context.GetRng().NextBelow(node.child_count));
+                    const NodeState& state = context.GetNodeState(index);
+                    if (state.is_running && state.child_index != child)
+                    {
+                        HaltSubtree(state.child_index, context);
+                    }
+                    NodeStatus status                       = Tick(child, context);
+                    context.GetNodeState(index).child_index = child;
+                    return status;
+                }
+
+                case OpCode::REPEAT:
+                    return TickRepeat(index, context);
+
+                case OpCode::INVERT:
+                {
+                    if (node.child_count == 0)
+                    {
+                        return NodeStatus::SUCCESS;
+                    }
+                    NodeStatus status = Tick(index + 1, context);
+                    if (status == NodeStatus::RUNNING)
+                    {
+                        return NodeStatus::RUNNING;
+                    }
+                    return status == NodeStatus::SUCCESS ? NodeStatus::FAILURE : NodeStatus::SUCCESS;
+                }
+
+                case OpCode::DELAY:
+                {
+                    const auto now   = context.GetFrameTime();
+                    NodeState& state = context.GetNodeState(index);
+                    if (!state.started)
+                    {
+                        state.deadline = now + std::chrono::milliseconds(node.param);
+                        state.started  = true;
+                    }
+                    if (now < state.deadline)
+                    {
+                        context.RequestWakeAt(state.deadline);
+                        return NodeStatus::RUNNING;
+                    }
+                    if (node.child_count == 0)
+                    {
+                        state.started = false;
+                        return NodeStatus::SUCCESS;
+                    }
+                    NodeStatus status = Tick(index + 1, context);
+                    if (status != NodeStatus::RUNNING)
+                    {
+                        context.GetNodeState(index).started = false;
+                    }
+                    return status;
+                }
+
+                case OpCode::TIMEOUT:
+                {
+                    if (node.child_count == 0)
+                    {
+                        return NodeStatus::SUCCESS;
+                    }
+                    const auto now   = context.GetFrameTime();
+                    NodeState& state = context.GetNodeState(index);
+                    if (!state.started)
+                    {
+                        state.deadline = now + std::chrono::milliseconds(node.param);
+                        state.started  = true;
+                    }
+                    if (now >= state.deadline)
+                    {
+                        state.started = false;
+                        HaltSubtree(index + 1, context);
+                        return NodeStatus::FAILURE;
+                    }
+                    NodeStatus status = Tick(index + 1, context);
+                    NodeState& after  = context.GetNodeState(index);
+                    if (status != NodeStatus::RUNNING)
+                    {
+                        after.started = false;
+                    }
+                    else
+                    {
+                        context.RequestWakeAt(after.deadline);
+                    }
+                    return status;
+                }
+
+                case OpCode::COOLDOWN:
+                {
+                    const auto now   = context.GetFrameTime();
+                    NodeState& state = context.GetNodeState(index);
+                    if (state.started)
+                    {
+                        if (now < state.deadline)
+                        {
+                            context.RequestWakeAt(state.deadline);
+                            return NodeStatus::FAILURE;
+                        }
+                        state.started = false;
+                    }
+                    NodeStatus status = node.child_count > 0 ? Tick(index + 1, context) : NodeStatus::SUCCESS;
+                    if (status != NodeStatus::RUNNING)
+                    {
+                        NodeState& after = context.GetNodeState(index);
+                        after.deadline   = now + std::chrono::milliseconds(node.param);
+                        after.started    = true;
+                    }
+                    return status;
+                }
+            }
+            return NodeStatus::FAILURE;
+        }
+
+        NodeStatus TickParallel(uint32_t index, Context& context)
+        {
+            const CompiledNode& node = nodes_[index];
+            if (node.child_count == 0)
+            {
+                return NodeStatus::SUCCESS;
+            }
+            if (node.flags & FLAG_CONCURRENT)
+            {
+                return TickConcurrentParallel(index, context);
+            }
+
+            int success_count = 0;
+            int failure_count = 0;
+            int running_count = 0;
+
+            for (uint32_t child = index + 1; child < node.subtree_end; child = nodes_[child].subtree_end)
+            {
+                switch (Tick(child, context))
+                {
+                    case NodeStatus::SUCCESS:
+                        success_count++;
+                        break;
+                    case NodeStatus::FAILURE:
+                        failure_count++;
+                        break;
+                    case NodeStatus::RUNNING:
+                        running_count++;
+                        break;
+                }
+            }
+
+            NodeStatus result = Parallel::Resolve(
+                static_cast<Parallel::Policy>(node.param), success_count, failure_count, running_count);
+            if (result != NodeStatus::RUNNING && running_count > 0)
+            {
+                HaltChildren(index, context);
+            }
+            return result;
+        }
+
+        // Parallel::ExecuteConcurrent와 같은 동작
+        NodeStatus TickConcurrentParallel(uint32_t index, Context& context)
+        {
+            const CompiledNode& node       = nodes_[index];
+            const auto          policy     = static_cast<Parallel::Policy>(node.param);
+            const uint32_t      tick       = context.GetTreeState().GetTick();
+            const bool          continuing = Parallel::IsContinuing(context.GetNodeState(index), tick);
+            if (!continuing)
+            {
+                HaltChildren(index, context);
+            }
+
+            NodeStatus result        = NodeStatus::RUNNING;
+            int        running_count = 0;
+            for (uint32_t child = index + 1; child < node.subtree_end && result == NodeStatus::RUNNING;
+                 child          = nodes_[child].subtree_end)
+            {
+                const NodeState& child_state = context.GetNodeState(child);
+                NodeStatus       status =
+                    (continuing && !child_state.is_running) ? child_state.last_status : Tick(child, context);
+                if (status == NodeStatus::RUNNING)
+                {
+                    running_count++;
+                }
+                result = Parallel::Decide(policy, status, running_count, nodes_[child].subtree_end == node.subtree_end);
+            }
+
+            if (result != NodeStatus::RUNNING)
+            {
+                HaltChildren(index, context);
+            }
+            context.GetNodeState(index).counter = static_cast<int32_t>(tick);
+            return result;
+        }
+
+        NodeStatus TickRepeat(uint32_t index, Context& context)
+        {
+            const CompiledNode& node = nodes_[index];
+            if (node.child_count == 0)
+            {
+                return NodeStatus::SUCCESS;
+            }
+
+            // 무한 반복
+            if (node.param == -1)
+            {
+                NodeStatus status = Tick(index + 1, context);
+                if (status == NodeStatus::SUCCESS)
+                {
+                    context.GetNodeState(index).counter = 0;
+                    return NodeStatus::RUNNING;
+                }
+                return status;
+            }
+
+            if (context.GetNodeState(index).counter < node.param)
+            {
+                NodeStatus status = Tick(index + 1, context);
+                NodeState& state  = context.GetNodeState(index);
+                if (status == NodeStatus::SUCCESS)
+                {
+                    state.counter++;
+                    if (state.counter >= node.param)
+                    {
+                        state.counter = 0;
+                        return NodeStatus::SUCCESS;
+                    }
+                    return NodeStatus::RUNNING;
+                }
+                else if (status == NodeStatus::FAILURE)
+                {
+                    state.counter = 0;
+                    return NodeStatus::FAILURE;
+                }
+                return NodeStatus::RUNNING;
+            }
+
+            context.GetNodeState(index).counter = 0;
+            return NodeStatus::SUCCESS;
+        }
+
+        static bool IsMemory(const CompiledNode& node, const Context& context)
+        {
+            return (node.flags & FLAG_MEMORY) || context.GetExecutionMode() == ExecutionMode::MEMORY;
+        }
+
+        // 저장된 실행 중 자식 (범위를 벗어나면 첫 자식)
+        uint32_t ResumeChild(uint32_t index, Context& context) const
+        {
+            uint32_t child = context.GetNodeState(index).child_index;
+            return (child > index && child < nodes_[index].subtree_end) ? child : index + 1;
+        }
+
+        NodeStatus TickMemorySequence(uint32_t index, Context& context)
+        {
+            const uint32_t end   = nodes_[index].subtree_end;
+            const uint32_t start = ResumeChild(index, context);
+
+            // 이미 통과한 자식 중 가드 조건은 매 틱 재확인
+            for (uint32_t child = index + 1; child < start; child = nodes_[child].subtree_end)
+            {
+                if ((nodes_[child].flags & FLAG_GUARD) && Tick(child, context) != NodeStatus::SUCCESS)
+                {
+                    HaltSubtree(start, context);
+                    context.GetNodeState(index).child_index = 0;
+                    return NodeStatus::FAILURE;
+                }
+            }
+
+            for (uint32_t child = start; child < end; child = nodes_[child].subtree_end)
+            {
+                NodeStatus status = Tick(child, context);
+                if (status != NodeStatus::SUCCESS)
+                {
+                    context.GetNodeState(index).child_index = (status == NodeStatus::RUNNING) ? child : 0;
+                    return status;
+                }
+            }
+            context.GetNodeState(index).child_index = 0;
+            return NodeStatus::SUCCESS;
+        }
+
+        NodeStatus TickMemorySelector(uint32_t index, Context& context)
+        {
+            const uint32_t end   = nodes_[index].subtree_end;
+            uint32_t       start = ResumeChild(index, context);
+
+            // 앞선 자식의 가드가 통과하면 실행 중인 자식을 중단하고 그 자식부터 다시 평가
+            for (uint32_t child = index + 1; child < start; child = nodes_[child].subtree_end)
+            {
+                if (GuardPasses(child, context))
+                {
+                    HaltSubtree(start, context);
+                    start = child;
+                    break;
+                }
+            }
+
+            for (uint32_t child = start; child < end; child = nodes_[child].subtree_end)
+            {
+                NodeStatus status = Tick(child, context);
+                if (status != NodeStatus::FAILURE)
+                {
+                    context.GetNodeState(index).child_index = (status == NodeStatus::RUNNING) ? child : 0;
+                    return status;
+                }
+            }
+            context.GetNodeState(index).child_index = 0;
+            return NodeStatus::FAILURE;
+        }
+
+        // 자식의 가드: 조건 노드 자체, Sequence 자식의 선두 조건들, 또는 불투명 노드가 위임한 가드
+        // (가드가 없으면 false)
+        bool GuardPasses(uint32_t child, Context& context)
+        {
+            const CompiledNode& node = nodes_[child];
+            if (node.flags & FLAG_GUARD)
+            {
+                return Tick(child, context) == NodeStatus::SUCCESS;
+            }
+            if (node.op == OpCode::LEAF)
+            {
+                return leaves_[node.payload]->PassesGuard(context);
+            }
+            if (node.op != OpCode::SEQUENCE)
+            {
+                return false;
+            }
+
+            bool has_guard = false;
+            for (uint32_t guard = child + 1; guard < node.subtree_end; guard = nodes_[guard].subtree_end)
+            {
+                if (!(nodes_[guard].flags & FLAG_GUARD))
+                    break;
+                if (Tick(guard, context) != NodeStatus::SUCCESS)
+                    return false;
+                has_guard = true;
+            }
+            return has_guard;
+        }
+
+        // 실행 중 경로 중단 (Node::HaltSubtree와 같은 동작, RUNNING인 레코드만 따라 내려간다)
+        void HaltSubtree(uint32_t index, Context& context)
+        {
+            if (!context.GetNodeState(index).is_running)
+            {
+                return;
+            }
+            const CompiledNode& node = nodes_[index];
+            if (node.op == OpCode::LEAF)
+            {
+                leaves_[node.payload]->HaltSubtree(context); // 불투명 노드는 자손까지
+                return;
+            }
+            HaltChildren(index, context);
+            context.GetNodeState(index).Reset();
+        }
+
+        void HaltChildren(uint32_t index, Context& context)
+        {
+            for (uint32_t child = index + 1; child < nodes_[index].subtree_end; child = nodes_[child].subtree_end)
+            {
+                HaltSubtree(child, context);
+            }
+        }
+
+        // 반응형 Sequence/Selector: Node::SwitchRunningChild와 같은 동작 (child_index는 레코드 인덱스)
+        NodeStatus SwitchRunningChild(uint32_t index, uint32_t child, NodeStatus status, Context& context)
+        {
+            const NodeState& state = context.GetNodeState(index);
+            if (state.is_running && state.child_index > child && state.child_index < nodes_[index].subtree_end)
+            {
+                HaltSubtree(state.child_index, context);
+            }
+            context.GetNodeState(index).child_index = (status == NodeStatus::RUNNING) ? child : 0;
+            return status;
+        }
+
+        uint32_t NthChild(uint32_t index, uint32_t n) const
+        {
+            uint32_t child = index + 1;
+            while (n-- > 0)
+            {
+                child = nodes_[child].subtree_end;
+            }
+            return child;
+        }
+
+        std::shared_ptr<Node>     root_;         // 원본 그래프 수명 유지용
+        std::vector<CompiledNode> nodes_;        // 전위 순서 노드 레코드
+        std::vector<Node*>        leaves_;       // LEAF 레코드가 가리키는 원본 노드
+        std::vector<IBatchLeaf*>  batch_leaves_; // leaves_와 같은 순서 (배치 실행을 지원하지 않으면 nullptr)
+        std::vector<Node*>        sources_;      // 레코드별 원본 노드 (디버깅용)
+        std::vector<Node*>        init_nodes_;   // 초기화 대상 전체 노드 (불투명 노드의 자손 포함)
+        uint32_t                  max_depth_ = 0; // 해석 대상 노드의 최대 깊이 (배치 작업 공간 크기)
+    };
+
+} // namespace bt
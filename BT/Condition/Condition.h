@@ -1,7 +1,10 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 #include "../Node.h"
 
@@ -36,4 +39,26 @@ namespace bt
         ConditionFunction condition_func_;
     };
 
+    // 호출 객체 타입을 그대로 갖는 Condition 노드 (std::function 타입 소거/힙 할당 없음, 호출이 인라인됨)
+    template <typename F>
+    class ConditionT final : public Node
+    {
+    public:
+        ConditionT(const std::string& name, F func) : Node(name, NodeType::CONDITION), func_(std::move(func)) {}
+
+        NodeStatus Execute(Context& context) override
+        {
+            return func_(context) ? NodeStatus::SUCCESS : NodeStatus::FAILURE;
+        }
+
+    private:
+        F func_;
+    };
+
+    template <typename F>
+    std::shared_ptr<ConditionT<std::decay_t<F>>> MakeCondition(const std::string& name, F&& func)
+    {
+        return std::make_shared<ConditionT<std::decay_t<F>>>(name, std::forward<F>(func));
+    }
+
 } // namespace bt
@@ -2,10 +2,16 @@
 
 #include <chrono>
 #include <memory>
+#include <memory_resource>
 #include <string>
+#include <unordered_map>
 
+#include "AgentArena.h"
 #include "Blackboard.h"
 #include "EnvironmentInfo.h"
+#include "NodeState.h"
+#include "Profiler.h"
+#include "Tracer.h"
 
 namespace bt
 {
@@ -14,12 +20,27 @@ namespace bt
     class IInterface;
     class IExecutor;
     class IOwner;
+    class Tree;
+    class TreeSlot;
 
     // Behavior Tree 컨텍스트 (Blackboard)
     class Context
     {
     public:
-        Context() : start_time_(std::chrono::steady_clock::now()), execution_count_(0) {}
+        Context() : Context(nullptr) {}
+
+        // 에이전트 아레나 사용: 트리 상태, 블랙보드 슬롯, 인터페이스 표, 코루틴 프레임을 이 아레나에서 할당한다.
+        // 아레나는 Context가 소멸할 때까지 유지되고, 마지막 참조가 풀린 뒤 풀로 돌아간다 (AgentArenaPool).
+        explicit Context(std::shared_ptr<AgentArena> arena)
+            : arena_(std::move(arena)),
+              interfaces_(Resource()),
+              blackboard_(Resource()),
+              start_time_(std::chrono::steady_clock::now()),
+              execution_count_(0),
+              frame_time_(start_time_),
+              tree_state_(Resource())
+        {
+        }
         ~Context() = default;
 
         // Blackboard 데이터 관리 (위임)
@@ -44,6 +65,19 @@ namespace bt
             blackboard_.SetData(key, value);
         }
 
+        // 타입 키 접근 (키 id로 슬롯 직접 접근)
+        template <typename T>
+        T Get(const BlackboardKey<T>& key, const T& default_value = T{}) const
+        {
+            return blackboard_.Get(key, default_value);
+        }
+
+        template <typename T>
+        void Set(const BlackboardKey<T>& key, const T& value)
+        {
+            blackboard_.Set(key, value);
+        }
+
         // Interface 참조 (IInterface 인터페이스 사용)
         void SetInterface(const std::string& name, std::shared_ptr<IInterface> interface)
         {
@@ -59,14 +93,58 @@ namespace bt
         void                       SetAI(std::shared_ptr<IExecutor> ai) { ai_ = ai; }
         std::shared_ptr<IExecutor> GetAI() const { return ai_; }
 
+        // 타입이 지정된 에이전트 참조 (소유하지 않음, 실행자가 틱 전에 설정하고 그 틱 동안 유효해야 한다)
+        // AgentNode<TAgent> 리프는 GetAI() 복사와 dynamic_pointer_cast 대신 이 포인터를 받는다.
+        // 설정한 타입과 정확히 같은 타입으로만 조회된다 (다르면 nullptr).
+        template <typename TAgent>
+        void SetAgent(TAgent* agent)
+        {
+            agent_      = agent;
+            agent_type_ = &AgentTypeTag<TAgent>::tag;
+        }
+        template <typename TAgent>
+        TAgent* GetAgent() const
+        {
+            return agent_type_ == &AgentTypeTag<TAgent>::tag ? static_cast<TAgent*>(agent_) : nullptr;
+        }
+
+        // 에이전트 식별자 (실행 추적/로그용, 실행자가 설정)
+        void     SetAgentId(uint64_t id) { agent_id_ = id; }
+        uint64_t GetAgentId() const { return agent_id_; }
+
+        // 에이전트 아레나 (없으면 nullptr, 전역 힙 사용)
+        AgentArena* GetArena() const { return arena_.get(); }
+
         // Blackboard 직접 접근
         Blackboard&       GetBlackboard() { return blackboard_; }
         const Blackboard& GetBlackboard() const { return blackboard_; }
 
+        // 공유(불변) Blackboard 계층 연결: 조회는 이 계층까지 이어지고 쓰기는 에이전트 계층에만 기록된다
+        void SetSharedBlackboard(std::shared_ptr<const Blackboard> shared) { blackboard_.SetParent(std::move(shared)); }
+        const std::shared_ptr<const Blackboard>& GetSharedBlackboard() const { return blackboard_.GetParent(); }
+
         // 실행 시간 관리
         void SetStartTime(std::chrono::steady_clock::time_point time) { start_time_ = time; }
         std::chrono::steady_clock::time_point GetStartTime() const { return start_time_; }
 
+        // 프레임 시각 (시간 기반 노드는 steady_clock::now() 대신 이 값을 읽는다)
+        // 엔진이 SetFrameTime으로 프레임마다 한 번 정하면 그 프레임의 모든 에이전트가 같은 시각을 보고,
+        // 정하지 않으면 Tree::Execute가 BeginFrame에서 실행마다 한 번 읽는다.
+        void SetFrameTime(std::chrono::steady_clock::time_point time)
+        {
+            frame_time_        = time;
+            frame_time_pinned_ = true;
+        }
+        std::chrono::steady_clock::time_point GetFrameTime() const { return frame_time_; }
+        void                                  BeginFrame()
+        {
+            if (!frame_time_pinned_)
+            {
+                frame_time_ = std::chrono::steady_clock::now();
+            }
+            frame_time_pinned_ = false;
+        }
+
         // 환경 정보 관리
         void                   SetEnvironmentInfo(const EnvironmentInfo* env_info) { environment_info_ = env_info; }
         const EnvironmentInfo* GetEnvironmentInfo() const { return environment_info_; }
@@ -81,17 +159,234 @@ namespace bt
         const std::string& GetCurrentRunningNode() const { return current_running_node_; }
         void               ClearCurrentRunningNode() { current_running_node_.clear(); }
 
+        // 실행 모드 (Tree::Execute가 설정)
+        void          SetExecutionMode(ExecutionMode mode) { execution_mode_ = mode; }
+        ExecutionMode GetExecutionMode() const { return execution_mode_; }
+
+        // 스케줄링 힌트 (Tree::Execute가 매 틱 리셋)
+        // 대기 중인 노드는 RequestWakeAt으로 다시 틱이 필요한 시각을 알리고,
+        // 그 외 이유로 RUNNING인 노드는 MarkBusy로 다음 틱이 필요함을 알린다.
+        void RequestWakeAt(std::chrono::steady_clock::time_point time)
+        {
+            if (time < wake_time_)
+            {
+                wake_time_ = time;
+            }
+            wake_requests_++;
+        }
+        void MarkBusy() { busy_count_++; }
+        void ResetSchedulingHints()
+        {
+            wake_time_     = std::chrono::steady_clock::time_point::max();
+            wake_requests_ = 0;
+            busy_count_    = 0;
+        }
+        std::chrono::steady_clock::time_point GetWakeTime() const { return wake_time_; }
+        bool     CanSleep() const { return wake_requests_ > 0 && busy_count_ == 0; }
+        uint32_t GetSchedulingMark() const { return wake_requests_ + busy_count_; }
+
+        // 노드 프로파일러 (Tree::Execute가 설정, nullptr이면 측정하지 않음)
+        void      SetProfiler(Profiler* profiler) { profiler_ = profiler; }
+        Profiler* GetProfiler() const { return profiler_; }
+
+        // 실행 추적 훅 (추적 중인 틱에만 연결, nullptr이면 추적하지 않음)
+        void    SetTracer(Tracer* tracer) { tracer_ = tracer; }
+        Tracer* GetTracer() const { return tracer_; }
+
+        // 에이전트별 트리 실행 상태 (트리 정의는 공유하고 상태만 에이전트가 소유)
+        // SubTree가 다른 트리를 실행하는 동안에는 그 노드가 에이전트별로 가진 하위 트리 상태 블록을 가리킨다.
+        TreeState&       GetTreeState() { return nested_state_ ? *nested_state_ : tree_state_; }
+        const TreeState& GetTreeState() const { return nested_state_ ? *nested_state_ : tree_state_; }
+        NodeState&       GetNodeState(uint32_t node_id) { return GetTreeState().Get(node_id); }
+
+        // 하위 트리 상태 블록으로 전환 (이전 블록을 반환, 하위 트리 실행이 끝나면 그 값으로 LeaveTreeState)
+        TreeState* EnterTreeState(TreeState* state)
+        {
+            TreeState* outer = nested_state_;
+            nested_state_    = state;
+            return outer;
+        }
+        void LeaveTreeState(TreeState* outer) { nested_state_ = outer; }
+
+        // Engine::ExecuteTree(TreeId)가 마지막으로 실행한 슬롯과 버전 (버전이 바뀔 때만 트리 포인터를 다시 읽는다)
+        struct TreeCache
+        {
+            std::shared_ptr<TreeSlot> slot; // 슬롯을 붙잡아 두어 해제된 주소를 다른 슬롯으로 착각하지 않는다
+            uint64_t                  version = 0;
+            std::shared_ptr<Tree>     tree;
+        };
+        TreeCache& GetTreeCache() { return tree_cache_; }
+
+        // 에이전트별 난수 (Random/WeightedRandomSelector가 사용, 같은 시드와 입력이면 같은 선택을 재현)
+        Rng& GetRng() { return tree_state_.GetRng(); }
+        void SeedRandom(uint64_t seed) { tree_state_.GetRng().Seed(seed); }
+
     private:
-        std::unordered_map<std::string, std::shared_ptr<IInterface>>
+        // 에이전트 타입별 고유 주소 (RTTI 없이 타입 비교)
+        template <typename TAgent>
+        struct AgentTypeTag
+        {
+            static constexpr char tag = 0;
+        };
+
+        std::pmr::memory_resource* Resource() const
+        {
+            return arena_ ? static_cast<std::pmr::memory_resource*>(arena_.get()) : std::pmr::get_default_resource();
+        }
+
+        std::shared_ptr<AgentArena> arena_; // 아레나에서 할당하는 멤버보다 먼저 선언 (가장 나중에 해제)
+        std::pmr::unordered_map<std::string, std::shared_ptr<IInterface>>
             interfaces_; // std::shared_ptr<IInterface> 이걸 std::any로 하면 그냥 Blackboard 쓰는 거잖아.
         std::shared_ptr<IOwner>    owner_;
         std::shared_ptr<IExecutor> ai_;
-        // 불변값을 갖는 blackboard를 추가하는 것을 고려해보자 => BT의 스크립트 설정값?
-        Blackboard                            blackboard_;
+        void*                      agent_      = nullptr;
+        const void*                agent_type_ = nullptr;
+        uint64_t                   agent_id_   = 0;
+        Blackboard                            blackboard_; // 에이전트 계층 (설정값 등 불변 계층은 부모로 연결)
         std::chrono::steady_clock::time_point start_time_;
         const EnvironmentInfo*                environment_info_ = nullptr;
         uint64_t                              execution_count_;
+        std::chrono::steady_clock::time_point frame_time_;
+        bool                                  frame_time_pinned_ = false;
         std::string                           current_running_node_;
+        TreeState                             tree_state_;
+        TreeState*                            nested_state_   = nullptr; // 실행 중인 하위 트리의 상태 블록
+        ExecutionMode                         execution_mode_ = ExecutionMode::REACTIVE;
+        std::chrono::steady_clock::time_point wake_time_      = std::chrono::steady_clock::time_point::max();
+        uint32_t                              wake_requests_  = 0;
+        uint32_t                              busy_count_     = 0;
+        Profiler*                             profiler_       = nullptr;
+        Tracer*                               tracer_         = nullptr;
+        TreeCache                             tree_cache_;
     };
 
+    // Node::Tick 정의 (Context 완전 타입 필요)
+    inline NodeStatus Node::Tick(Context& context)
+    {
+        auto tick = [&]()
+        {
+            uint32_t mark = context.GetSchedulingMark();
+#ifndef BT_DISABLE_TRACING
+            Tracer*    tracer = context.GetTracer();
+            NodeStatus status =
+                tracer ? tracer->Trace(id_, children_.empty(), context, [&]() { return Evaluate(context); })
+                       : Evaluate(context);
+#else
+            NodeStatus status = Evaluate(context);
+#endif
+
+            // 대기 요청도, 바쁜 자손도 없이 RUNNING이면 다음 틱이 필요한 노드
+            if (status == NodeStatus::RUNNING && context.GetSchedulingMark() == mark)
+            {
+                context.MarkBusy();
+            }
+
+            NodeState& state  = context.GetNodeState(id_);
+            state.last_status = status;
+            state.is_running  = (status == NodeStatus::RUNNING);
+            return status;
+        };
+
+#ifndef BT_DISABLE_PROFILING
+        if (Profiler* profiler = context.GetProfiler())
+        {
+            return profiler->Measure(id_, tick);
+        }
+#endif
+        return tick();
+    }
+
+    inline void Node::DeclarePure(const std::string& memo_key, const std::vector<std::string>& invalidate_on)
+    {
+        memo_id_ = MemoKeyRegistry::Intern(memo_key);
+        memo_deps_.clear();
+        for (const auto& key : invalidate_on)
+        {
+            memo_deps_.push_back(BlackboardKeyRegistry::Instance().Intern(key));
+        }
+    }
+
+    inline NodeStatus Node::Evaluate(Context& context)
+    {
+        NodeStatus status;
+        if (RecallMemo(context, status))
+        {
+            return status;
+        }
+        status = Execute(context);
+        StoreMemo(context, status);
+        return status;
+    }
+
+    inline bool Node::RecallMemo(Context& context, NodeStatus& status) const
+    {
+        TreeState&     state = context.GetTreeState();
+        const uint32_t tick  = state.GetTick();
+        if (memo_id_ == kNoMemo || tick == 0) // 트리 밖에서 직접 실행하면(tick 0) 캐시하지 않음
+        {
+            return false;
+        }
+
+        const Blackboard& blackboard = context.GetBlackboard();
+        const MemoEntry&  memo       = state.GetMemo(memo_id_);
+        if (memo.tick != tick)
+        {
+            return false;
+        }
+        for (uint32_t key : memo_deps_)
+        {
+            if (blackboard.GetWriteVersion(key) > memo.version)
+            {
+                return false; // 계산 뒤에 의존 키가 쓰임
+            }
+        }
+        status = memo.status;
+        return true;
+    }
+
+    inline void Node::StoreMemo(Context& context, NodeStatus status) const
+    {
+        TreeState&     state = context.GetTreeState();
+        const uint32_t tick  = state.GetTick();
+        if (memo_id_ != kNoMemo && tick != 0 && status != NodeStatus::RUNNING)
+        {
+            state.GetMemo(memo_id_) = MemoEntry{tick, context.GetBlackboard().GetVersion(), status};
+        }
+    }
+
+    inline void Node::HaltSubtree(Context& context)
+    {
+        if (!context.GetNodeState(id_).is_running)
+        {
+            return;
+        }
+        if (children_.empty() && context.GetTracer() && context.GetTracer()->ReplaysLeaves())
+        {
+            context.GetNodeState(id_).Reset(); // 재생 중인 리프는 실행된 적이 없다
+            return;
+        }
+        for (auto& child : children_)
+        {
+            if (child)
+            {
+                child->HaltSubtree(context);
+            }
+        }
+        Halt(context);
+        Cleanup();
+        Initialize();
+        context.GetNodeState(id_).Reset();
+    }
+
+    inline NodeStatus Node::SwitchRunningChild(Context& context, size_t index, NodeStatus status)
+    {
+        NodeState& state = context.GetNodeState(id_);
+        if (state.is_running && state.child_index > index && state.child_index < children_.size())
+        {
+            children_[state.child_index]->HaltSubtree(context);
+        }
+        state.child_index = (status == NodeStatus::RUNNING) ? static_cast<uint32_t>(index) : 0;
+        return status;
+    }
+
 } // namespace bt
@@ -2,6 +2,7 @@
 
 #include <string>
 
+#include "../Context.h"
 #include "../Node.h"
 
 namespace bt
@@ -11,6 +12,11 @@ namespace bt
     class Context;
 
     // Parallel 노드 (병렬 실행)
+    // 기본 모드는 매 틱 모든 자식을 실행해 그 틱의 결과만으로 정책을 판정하고, 결정되면 실행 중인 자식을 중단한다.
+    // 동시 실행(concurrent) 모드는 자식을 함께 진행되는 작업으로 다룬다:
+    //  - 실행이 이어지는 동안 이미 끝난 자식은 다시 실행하지 않고 결과를 유지한다 (AsyncAction이 작업을 다시 시작하지 않음).
+    //  - 정책이 결정되는 즉시 남은 자식을 실행하지 않고, 실행 중인 자식은 Halt로 중단한다.
+    //  - 직전 틱에 실행되지 않았으면(상위 노드가 다른 분기로 넘어갔다 돌아온 경우 등) 처음부터 다시 시작한다.
     class Parallel : public Node
     {
     public:
@@ -21,8 +27,8 @@ namespace bt
             FAIL_ON_ONE     // 하나라도 실패하면 실패
         };
 
-        Parallel(const std::string& name, Policy policy = Policy::SUCCEED_ON_ONE)
-            : Node(name, NodeType::PARALLEL), policy_(policy)
+        Parallel(const std::string& name, Policy policy = Policy::SUCCEED_ON_ONE, bool concurrent = false)
+            : Node(name, NodeType::PARALLEL), policy_(policy), concurrent_(concurrent)
         {
         }
 
@@ -32,6 +38,10 @@ namespace bt
             {
                 return NodeStatus::SUCCESS;
             }
+            if (concurrent_)
+            {
+                return ExecuteConcurrent(context);
+            }
 
             int success_count = 0;
             int failure_count = 0;
@@ -40,7 +50,7 @@ namespace bt
             // 모든 자식 노드를 병렬로 실행
             for (auto& child : children_)
             {
-                NodeStatus status = child->Execute(context);
+                NodeStatus status = child->Tick(context);
                 switch (status)
                 {
                     case NodeStatus::SUCCESS:
@@ -55,37 +65,97 @@ namespace bt
                 }
             }
 
-            // 정책에 따라 결과 결정
-            switch (policy_)
+            // 정책에 따라 결과 결정 (결정되었는데 실행 중인 자식이 남았으면 중단)
+            NodeStatus result = Resolve(policy_, success_count, failure_count, running_count);
+            if (result != NodeStatus::RUNNING && running_count > 0)
+            {
+                HaltRunningChildren(context);
+            }
+            return result;
+        }
+
+        Policy GetPolicy() const { return policy_; }
+        bool   IsConcurrent() const { return concurrent_; }
+
+        // 기본 모드 판정 (컴파일된 트리와 공유)
+        static NodeStatus Resolve(Policy policy, int success_count, int failure_count, int running_count)
+        {
+            switch (policy)
             {
                 case Policy::SUCCEED_ON_ONE:
                     if (success_count > 0)
                         return NodeStatus::SUCCESS;
-                    if (running_count > 0)
-                        return NodeStatus::RUNNING;
-                    return NodeStatus::FAILURE;
+                    return running_count > 0 ? NodeStatus::RUNNING : NodeStatus::FAILURE;
 
                 case Policy::SUCCEED_ON_ALL:
-                    if (failure_count > 0)
-                        return NodeStatus::FAILURE;
-                    if (running_count > 0)
-                        return NodeStatus::RUNNING;
-                    return NodeStatus::SUCCESS;
-
                 case Policy::FAIL_ON_ONE:
                     if (failure_count > 0)
                         return NodeStatus::FAILURE;
-                    if (running_count > 0)
-                        return NodeStatus::RUNNING;
-                    return NodeStatus::SUCCESS;
-
-                default:
-                    return NodeStatus::FAILURE;
+                    return running_count > 0 ? NodeStatus::RUNNING : NodeStatus::SUCCESS;
             }
+            return NodeStatus::FAILURE;
+        }
+
+        // 동시 실행 모드 판정 (컴파일된 트리와 공유)
+        // 결정되는 즉시 그 결과를, 아직이면 RUNNING을 반환한다. finished가 true면 모든 자식이 끝난 상태다.
+        static NodeStatus Decide(Policy policy, NodeStatus child, int running_count, bool finished)
+        {
+            if (policy == Policy::SUCCEED_ON_ONE ? child == NodeStatus::SUCCESS : child == NodeStatus::FAILURE)
+                return child;
+            if (!finished || running_count > 0)
+                return NodeStatus::RUNNING;
+            return policy == Policy::SUCCEED_ON_ONE ? NodeStatus::FAILURE : NodeStatus::SUCCESS;
+        }
+
+        // 이번 틱이 직전 틱에서 이어지는 실행인지 (state.counter에 마지막 실행 틱을 기록)
+        static bool IsContinuing(const NodeState& state, uint32_t tick)
+        {
+            // 트리 밖에서 직접 실행하면(tick 0) 실행 중 여부만 본다
+            return state.is_running && (tick == 0 || state.counter == static_cast<int32_t>(tick - 1));
         }
 
     private:
+        NodeStatus ExecuteConcurrent(Context& context)
+        {
+            const uint32_t tick       = context.GetTreeState().GetTick();
+            const bool     continuing = IsContinuing(context.GetNodeState(id_), tick);
+            if (!continuing)
+            {
+                HaltRunningChildren(context); // 이전 실행에서 남은 작업 정리
+            }
+
+            NodeStatus result        = NodeStatus::RUNNING;
+            int        running_count = 0;
+            for (size_t i = 0; i < children_.size() && result == NodeStatus::RUNNING; ++i)
+            {
+                const NodeState& child_state = context.GetNodeState(children_[i]->GetId());
+                NodeStatus       status      = (continuing && !child_state.is_running) ? child_state.last_status
+                                                                                       : children_[i]->Tick(context);
+                if (status == NodeStatus::RUNNING)
+                {
+                    running_count++;
+                }
+                result = Decide(policy_, status, running_count, i + 1 == children_.size());
+            }
+
+            if (result != NodeStatus::RUNNING)
+            {
+                HaltRunningChildren(context);
+            }
+            context.GetNodeState(id_).counter = static_cast<int32_t>(tick);
+            return result;
+        }
+
+        void HaltRunningChildren(Context& context)
+        {
+            for (auto& child : children_)
+            {
+                child->HaltSubtree(context);
+            }
+        }
+
         Policy policy_;
+        bool   concurrent_;
     };
 
 } // namespace bt
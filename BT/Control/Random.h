@@ -1,8 +1,8 @@
 #pragma once
 
-#include <random>
 #include <string>
 
+#include "../Context.h"
 #include "../Node.h"
 
 namespace bt
@@ -12,6 +12,7 @@ namespace bt
     class Context;
 
     // Random 노드 (랜덤 선택)
+    // 에이전트의 Rng로 고르므로 같은 시드면 같은 자식을 고른다.
     class Random : public Node
     {
     public:
@@ -24,13 +25,17 @@ namespace bt
                 return NodeStatus::FAILURE;
             }
 
-            // 랜덤하게 자식 노드 선택
-            std::random_device              rd;
-            std::mt19937                    gen(rd());
-            std::uniform_int_distribution<> dis(0, children_.size() - 1);
+            // 직전 틱에 다른 자식이 실행 중이었으면 중단
+            size_t     random_index = context.GetRng().NextBelow(static_cast<uint32_t>(children_.size()));
+            NodeState& state        = context.GetNodeState(id_);
+            if (state.is_running && state.child_index != random_index && state.child_index < children_.size())
+            {
+                children_[state.child_index]->HaltSubtree(context);
+            }
 
-            int random_index = dis(gen);
-            return children_[random_index]->Execute(context);
+            NodeStatus status                     = children_[random_index]->Tick(context);
+            context.GetNodeState(id_).child_index = static_cast<uint32_t>(random_index);
+            return status;
         }
     };
 
@@ -2,6 +2,7 @@
 
 #include <string>
 
+#include "../Context.h"
 #include "../Node.h"
 
 namespace bt
@@ -11,30 +12,109 @@ namespace bt
     class Context;
 
     // Selector 노드 (하나라도 성공하면 성공)
+    // 메모리 모드에서는 RUNNING이었던 자식부터 재개하되, 우선순위가 높은 자식의 가드가 통과하면 선점한다.
     class Selector : public Node
     {
     public:
-        Selector(const std::string& name) : Node(name, NodeType::SELECTOR) {}
+        Selector(const std::string& name, bool memory = false) : Node(name, NodeType::SELECTOR), memory_(memory) {}
+
+        bool IsMemory() const { return memory_; }
 
         NodeStatus Execute(Context& context) override
         {
-            for (auto& child : children_)
+            if (memory_ || context.GetExecutionMode() == ExecutionMode::MEMORY)
             {
-                if (child)
+                return ExecuteMemory(context);
+            }
+
+            // 앞선 자식이 성공하거나 실행 중이 되면 직전 틱에 실행 중이던 뒤쪽 자식은 중단
+            for (size_t i = 0; i < children_.size(); ++i)
+            {
+                if (children_[i])
                 {
-                    NodeStatus status = child->Execute(context);
-                    if (status == NodeStatus::SUCCESS)
-                    {
-                        return NodeStatus::SUCCESS;
-                    }
-                    else if (status == NodeStatus::RUNNING)
+                    NodeStatus status = children_[i]->Tick(context);
+                    if (status != NodeStatus::FAILURE)
                     {
-                        return NodeStatus::RUNNING;
+                        return SwitchRunningChild(context, i, status);
                     }
                 }
             }
+            return SwitchRunningChild(context, children_.size(), NodeStatus::FAILURE);
+        }
+
+        // 자식의 가드: 조건 노드 자체, Sequence 자식의 선두 조건들, 또는 노드가 위임한 가드 (가드가 없으면 false)
+        static bool GuardPasses(Node* child, Context& context)
+        {
+            if (child->IsGuard())
+            {
+                return child->Tick(context) == NodeStatus::SUCCESS;
+            }
+            if (child->GetType() != NodeType::SEQUENCE)
+            {
+                return child->PassesGuard(context);
+            }
+
+            bool has_guard = false;
+            for (const auto& grandchild : child->GetChildren())
+            {
+                if (!grandchild || !grandchild->IsGuard())
+                    break;
+                if (grandchild->Tick(context) != NodeStatus::SUCCESS)
+                    return false;
+                has_guard = true;
+            }
+            return has_guard;
+        }
+
+    private:
+        NodeStatus ExecuteMemory(Context& context)
+        {
+            size_t start = context.GetNodeState(id_).child_index;
+            if (start >= children_.size())
+            {
+                start = 0;
+            }
+
+            // 앞선 자식의 가드가 통과하면 실행 중인 자식을 중단하고 그 자식부터 다시 평가
+            for (size_t i = 0; i < start; ++i)
+            {
+                if (children_[i] && GuardPasses(children_[i].get(), context))
+                {
+                    children_[start]->HaltSubtree(context);
+                    start = i;
+                    break;
+                }
+            }
+
+            for (size_t i = start; i < children_.size(); ++i)
+            {
+                if (!children_[i])
+                    continue;
+
+                NodeStatus status = children_[i]->Tick(context);
+                if (status == NodeStatus::RUNNING)
+                {
+                    context.GetNodeState(id_).child_index = static_cast<uint32_t>(i);
+                    return NodeStatus::RUNNING;
+                }
+                if (status == NodeStatus::SUCCESS)
+                {
+                    context.GetNodeState(id_).child_index = 0;
+                    return NodeStatus::SUCCESS;
+                }
+            }
+            context.GetNodeState(id_).child_index = 0;
             return NodeStatus::FAILURE;
         }
+
+        bool memory_;
+    };
+
+    // 메모리 Selector (실행 모드와 관계없이 항상 재개)
+    class MemorySelector : public Selector
+    {
+    public:
+        MemorySelector(const std::string& name) : Selector(name, true) {}
     };
 
 } // namespace bt
@@ -2,6 +2,7 @@
 
 #include <string>
 
+#include "../Context.h"
 #include "../Node.h"
 
 namespace bt
@@ -11,32 +12,86 @@ namespace bt
     class Context;
 
     // Sequence 노드 (순차 실행)
+    // 메모리 모드에서는 RUNNING이었던 자식부터 재개하고, 앞선 조건 자식(가드)만 다시 확인한다.
     class Sequence : public Node
     {
     public:
-        Sequence(const std::string& name) : Node(name, NodeType::SEQUENCE) {}
+        Sequence(const std::string& name, bool memory = false) : Node(name, NodeType::SEQUENCE), memory_(memory) {}
+
+        bool IsMemory() const { return memory_; }
 
         NodeStatus Execute(Context& context) override
         {
+            if (memory_ || context.GetExecutionMode() == ExecutionMode::MEMORY)
+            {
+                return ExecuteMemory(context);
+            }
+
             // 모든 자식 노드를 순차적으로 실행
-            // 하나라도 실패하면 실패 반환
-            for (auto& child : children_)
+            // 하나라도 실패하면 실패 반환 (직전 틱에 더 뒤의 자식이 실행 중이었으면 중단)
+            for (size_t i = 0; i < children_.size(); ++i)
             {
-                if (!child)
+                if (!children_[i])
                     continue;
 
-                NodeStatus status = child->Execute(context);
-                if (status == NodeStatus::FAILURE)
+                NodeStatus status = children_[i]->Tick(context);
+                if (status != NodeStatus::SUCCESS)
+                {
+                    return SwitchRunningChild(context, i, status);
+                }
+            }
+            return SwitchRunningChild(context, children_.size(), NodeStatus::SUCCESS);
+        }
+
+    private:
+        NodeStatus ExecuteMemory(Context& context)
+        {
+            size_t start = context.GetNodeState(id_).child_index;
+            if (start >= children_.size())
+            {
+                start = 0;
+            }
+
+            // 이미 통과한 자식 중 가드 조건은 매 틱 재확인
+            for (size_t i = 0; i < start; ++i)
+            {
+                if (children_[i] && children_[i]->IsGuard() && children_[i]->Tick(context) != NodeStatus::SUCCESS)
                 {
+                    children_[start]->HaltSubtree(context);
+                    context.GetNodeState(id_).child_index = 0;
                     return NodeStatus::FAILURE;
                 }
-                else if (status == NodeStatus::RUNNING)
+            }
+
+            for (size_t i = start; i < children_.size(); ++i)
+            {
+                if (!children_[i])
+                    continue;
+
+                NodeStatus status = children_[i]->Tick(context);
+                if (status == NodeStatus::RUNNING)
                 {
+                    context.GetNodeState(id_).child_index = static_cast<uint32_t>(i);
                     return NodeStatus::RUNNING;
                 }
+                if (status == NodeStatus::FAILURE)
+                {
+                    context.GetNodeState(id_).child_index = 0;
+                    return NodeStatus::FAILURE;
+                }
             }
+            context.GetNodeState(id_).child_index = 0;
             return NodeStatus::SUCCESS;
         }
+
+        bool memory_;
+    };
+
+    // 메모리 Sequence (실행 모드와 관계없이 항상 재개)
+    class MemorySequence : public Sequence
+    {
+    public:
+        MemorySequence(const std::string& name) : Sequence(name, true) {}
     };
 
 } // namespace bt
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../Context.h"
+#include "../Node.h"
+
+namespace bt
+{
+
+    // 유틸리티 Selector (점수가 높은 자식부터 시도)
+    // 매 틱 점수 함수 한 번으로 모든 자식의 점수를 계산하고(자식별 가상 호출 없이 배열 단위로 계산 가능),
+    // 점수가 높은 순서로 실행해 처음 실패하지 않은 자식의 결과를 반환한다. 0 이하(또는 NaN)인 자식은 건너뛴다.
+    // 점수가 같으면 앞선 자식이 우선한다. 반응형으로 동작해, 점수가 바뀌어 다른 자식이 선택되면
+    // 직전 틱에 실행 중이던 자식은 중단된다.
+    class UtilitySelector : public Node
+    {
+    public:
+        // scores[0..count)에 자식 순서대로 점수를 기록 (호출 전 0으로 채워져 있다)
+        using BatchScorer = std::function<void(Context&, float* scores, size_t count)>;
+
+        UtilitySelector(const std::string& name, BatchScorer scorer)
+            : Node(name, NodeType::SELECTOR), scorer_(std::move(scorer))
+        {
+        }
+
+        NodeStatus Execute(Context& context) override
+        {
+            const size_t count = children_.size();
+            if (count == 0 || !scorer_)
+            {
+                return NodeStatus::FAILURE;
+            }
+
+            float              inline_scores[kInlineChildren];
+            std::vector<float> heap_scores;
+            float*             scores = inline_scores;
+            if (count > kInlineChildren)
+            {
+                heap_scores.resize(count);
+                scores = heap_scores.data();
+            }
+            for (size_t i = 0; i < count; ++i)
+            {
+                scores[i] = 0.0f;
+            }
+            scorer_(context, scores, count);
+
+            for (;;)
+            {
+                size_t best = count;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (scores[i] > 0.0f && children_[i] && (best == count || scores[i] > scores[best]))
+                    {
+                        best = i;
+                    }
+                }
+                if (best == count)
+                {
+                    break;
+                }
+
+                NodeStatus status = children_[best]->Tick(context);
+                if (status != NodeStatus::FAILURE)
+                {
+                    return Finish(context, best, status);
+                }
+                scores[best] = 0.0f; // 시도한 자식은 후보에서 제외
+            }
+            return Finish(context, count, NodeStatus::FAILURE);
+        }
+
+    private:
+        static constexpr size_t kInlineChildren = 16;
+
+        // 직전 틱에 실행 중이던 자식이 이번에 선택된 자식과 다르면 중단
+        NodeStatus Finish(Context& context, size_t index, NodeStatus status)
+        {
+            NodeState& state = context.GetNodeState(id_);
+            if (state.is_running && state.child_index != index && state.child_index < children_.size())
+            {
+                children_[state.child_index]->HaltSubtree(context);
+            }
+            context.GetNodeState(id_).child_index = (status == NodeStatus::RUNNING) ? static_cast<uint32_t>(index) : 0;
+            return status;
+        }
+
+        BatchScorer scorer_;
+    };
+
+} // namespace bt
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../Context.h"
+#include "../Node.h"
+
+namespace bt
+{
+
+    // 가중치 랜덤 Selector
+    // 자식을 가중치에 비례한 확률로 뽑아 실행하고, 실패하면 남은 자식 중에서 다시 뽑는다 (비복원 추출).
+    // 실행 중인 자식이 있으면 다시 뽑지 않고 그 자식부터 재개한다.
+    // 가중치가 없는 자식은 1, 0 이하인 자식은 뽑지 않는다. 난수는 에이전트의 Rng를 사용한다.
+    class WeightedRandomSelector : public Node
+    {
+    public:
+        WeightedRandomSelector(const std::string& name, std::vector<float> weights = {})
+            : Node(name, NodeType::SELECTOR), weights_(std::move(weights))
+        {
+        }
+
+        const std::vector<float>& GetWeights() const { return weights_; }
+
+        NodeStatus Execute(Context& context) override
+        {
+            const size_t count   = children_.size();
+            size_t       resumed = count;
+
+            const NodeState& state = context.GetNodeState(id_);
+            if (state.is_running && state.child_index < count && children_[state.child_index])
+            {
+                resumed           = state.child_index;
+                NodeStatus status = children_[resumed]->Tick(context);
+                if (status != NodeStatus::FAILURE)
+                {
+                    return Finish(context, resumed, status);
+                }
+            }
+
+            // 남은 가중치 (자식이 적으면 스택 버퍼, 중첩된 Selector와 공유하지 않도록 틱마다 따로 둔다)
+            float              inline_weights[kInlineChildren];
+            std::vector<float> heap_weights;
+            float*             weights = inline_weights;
+            if (count > kInlineChildren)
+            {
+                heap_weights.resize(count);
+                weights = heap_weights.data();
+            }
+            for (size_t i = 0; i < count; ++i)
+            {
+                weights[i] = (i != resumed && children_[i]) ? GetWeight(i) : 0.0f;
+            }
+
+            for (;;)
+            {
+                float total = 0.0f;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    total += weights[i];
+                }
+                if (total <= 0.0f)
+                {
+                    break;
+                }
+
+                float  pick   = context.GetRng().NextFloat() * total;
+                size_t chosen = count;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (weights[i] <= 0.0f)
+                        continue;
+                    chosen = i; // 부동소수 오차로 끝까지 가면 마지막 후보
+                    if (pick < weights[i])
+                        break;
+                    pick -= weights[i];
+                }
+
+                NodeStatus status = children_[chosen]->Tick(context);
+                if (status != NodeStatus::FAILURE)
+                {
+                    return Finish(context, chosen, status);
+                }
+                weights[chosen] = 0.0f;
+            }
+            return Finish(context, count, NodeStatus::FAILURE);
+        }
+
+    private:
+        static constexpr size_t kInlineChildren = 16;
+
+        float GetWeight(size_t index) const
+        {
+            float weight = index < weights_.size() ? weights_[index] : 1.0f;
+            return weight > 0.0f ? weight : 0.0f;
+        }
+
+        NodeStatus Finish(Context& context, size_t index, NodeStatus status)
+        {
+            context.GetNodeState(id_).child_index = (status == NodeStatus::RUNNING) ? static_cast<uint32_t>(index) : 0;
+            return status;
+        }
+
+        std::vector<float> weights_;
+    };
+
+} // namespace bt
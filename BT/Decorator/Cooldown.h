@@ -0,0 +1,58 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include "../Context.h"
+#include "../Node.h"
+
+namespace bt
+{
+
+    // 전방 선언
+    class Context;
+
+    // Cooldown 노드 (재사용 대기시간)
+    // 자식이 끝나면(성공/실패) 대기시간 동안 자식을 실행하지 않고 FAILURE를 반환한다.
+    // 만료 시각은 에이전트별 NodeState에 저장하고, 막고 있는 동안 만료 시각을 RequestWakeAt으로 알려
+    // 다른 대기 노드 때문에 재워진 에이전트도 쿨다운이 끝나면 다시 평가된다.
+    class Cooldown : public Node
+    {
+    public:
+        Cooldown(const std::string& name, std::chrono::milliseconds cooldown)
+            : Node(name, NodeType::COOLDOWN), cooldown_(cooldown)
+        {
+        }
+
+        NodeStatus Execute(Context& context) override
+        {
+            const auto now   = context.GetFrameTime();
+            NodeState& state = context.GetNodeState(id_);
+
+            if (state.started)
+            {
+                if (now < state.deadline)
+                {
+                    context.RequestWakeAt(state.deadline);
+                    return NodeStatus::FAILURE;
+                }
+                state.started = false;
+            }
+
+            NodeStatus status = children_.empty() ? NodeStatus::SUCCESS : children_[0]->Tick(context);
+            if (status != NodeStatus::RUNNING)
+            {
+                NodeState& after = context.GetNodeState(id_);
+                after.deadline   = now + cooldown_;
+                after.started    = true;
+            }
+            return status;
+        }
+
+        std::chrono::milliseconds GetCooldown() const { return cooldown_; }
+
+    private:
+        std::chrono::milliseconds cooldown_;
+    };
+
+} // namespace bt
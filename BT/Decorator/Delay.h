@@ -3,6 +3,7 @@
 #include <chrono>
 #include <string>
 
+#include "../Context.h"
 #include "../Node.h"
 
 namespace bt
@@ -12,45 +13,50 @@ namespace bt
     class Context;
 
     // Delay 노드 (지연 실행)
+    // 만료 시각은 에이전트별 NodeState에 저장하고, 시간은 Context의 프레임 시각으로 잰다.
+    // 대기 중에는 만료 시각을 RequestWakeAt으로 알려, 엔진이 그때까지 에이전트를 틱하지 않고 재울 수 있다.
     class Delay : public Node
     {
     public:
-        Delay(const std::string& name, std::chrono::milliseconds delay)
-            : Node(name, NodeType::DELAY), delay_(delay), started_(false)
+        Delay(const std::string& name, std::chrono::milliseconds delay) : Node(name, NodeType::DELAY), delay_(delay)
         {
         }
 
         NodeStatus Execute(Context& context) override
         {
-            auto now = std::chrono::steady_clock::now();
+            const auto now   = context.GetFrameTime();
+            NodeState& state = context.GetNodeState(id_);
 
-            if (!started_)
+            if (!state.started)
             {
-                start_time_ = now;
-                started_    = true;
+                state.deadline = now + delay_;
+                state.started  = true;
+            }
+            if (now < state.deadline)
+            {
+                context.RequestWakeAt(state.deadline); // 만료 전까지는 틱할 필요 없음
                 return NodeStatus::RUNNING;
             }
 
-            auto elapsed = now - start_time_;
-            if (elapsed >= delay_)
+            if (children_.empty())
             {
-                started_ = false; // 다음 실행을 위해 리셋
-
-                // 자식 노드가 있으면 실행
-                if (!children_.empty())
-                {
-                    return children_[0]->Execute(context);
-                }
+                state.started = false; // 다음 실행을 위해 리셋
                 return NodeStatus::SUCCESS;
             }
 
-            return NodeStatus::RUNNING;
+            // 자식이 실행 중인 동안에는 다시 지연하지 않는다
+            NodeStatus status = children_[0]->Tick(context);
+            if (status != NodeStatus::RUNNING)
+            {
+                context.GetNodeState(id_).started = false;
+            }
+            return status;
         }
 
+        std::chrono::milliseconds GetDelay() const { return delay_; }
+
     private:
-        std::chrono::milliseconds             delay_;
-        std::chrono::steady_clock::time_point start_time_;
-        bool                                  started_;
+        std::chrono::milliseconds delay_;
     };
 
 } // namespace bt
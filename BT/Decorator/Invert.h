@@ -2,6 +2,7 @@
 
 #include <string>
 
+#include "../Context.h"
 #include "../Node.h"
 
 namespace bt
@@ -23,7 +24,7 @@ namespace bt
                 return NodeStatus::SUCCESS; // 자식이 없으면 성공 반환
             }
 
-            NodeStatus child_status = children_[0]->Execute(context);
+            NodeStatus child_status = children_[0]->Tick(context);
 
             // 결과 반전
             switch (child_status)
@@ -2,6 +2,7 @@
 
 #include <string>
 
+#include "../Context.h"
 #include "../Node.h"
 
 namespace bt
@@ -11,11 +12,12 @@ namespace bt
     class Context;
 
     // Repeat 노드 (반복 실행)
+    // 현재 반복 횟수는 에이전트별 NodeState::counter에 저장한다.
     class Repeat : public Node
     {
     public:
         Repeat(const std::string& name, int count = -1) // -1은 무한 반복
-            : Node(name, NodeType::REPEAT), repeat_count_(count), current_count_(0)
+            : Node(name, NodeType::REPEAT), repeat_count_(count)
         {
         }
 
@@ -29,44 +31,48 @@ namespace bt
             // 무한 반복인 경우
             if (repeat_count_ == -1)
             {
-                NodeStatus child_status = children_[0]->Execute(context);
+                NodeStatus child_status = children_[0]->Tick(context);
                 if (child_status == NodeStatus::SUCCESS)
                 {
-                    current_count_ = 0; // 리셋하고 다시 시작
+                    context.GetNodeState(id_).counter = 0; // 리셋하고 다시 시작
                     return NodeStatus::RUNNING;
                 }
                 return child_status;
             }
 
             // 제한된 반복인 경우
-            if (current_count_ < repeat_count_)
+            if (context.GetNodeState(id_).counter < repeat_count_)
             {
-                NodeStatus child_status = children_[0]->Execute(context);
+                NodeStatus child_status = children_[0]->Tick(context);
+
+                // 자식 실행 중 상태 블록이 확장될 수 있으므로 다시 조회
+                NodeState& state = context.GetNodeState(id_);
                 if (child_status == NodeStatus::SUCCESS)
                 {
-                    current_count_++;
-                    if (current_count_ >= repeat_count_)
+                    state.counter++;
+                    if (state.counter >= repeat_count_)
                     {
-                        current_count_ = 0; // 리셋
+                        state.counter = 0; // 리셋
                         return NodeStatus::SUCCESS;
                     }
                     return NodeStatus::RUNNING;
                 }
                 else if (child_status == NodeStatus::FAILURE)
                 {
-                    current_count_ = 0; // 리셋
+                    state.counter = 0; // 리셋
                     return NodeStatus::FAILURE;
                 }
                 return NodeStatus::RUNNING;
             }
 
-            current_count_ = 0; // 리셋
+            context.GetNodeState(id_).counter = 0; // 리셋
             return NodeStatus::SUCCESS;
         }
 
+        int GetRepeatCount() const { return repeat_count_; }
+
     private:
         int repeat_count_;
-        int current_count_;
     };
 
 } // namespace bt
@@ -3,6 +3,7 @@
 #include <chrono>
 #include <string>
 
+#include "../Context.h"
 #include "../Node.h"
 
 namespace bt
@@ -12,11 +13,12 @@ namespace bt
     class Context;
 
     // Timeout 노드 (시간 제한)
+    // 에이전트별로 자식을 처음 실행한 시점부터 시간을 잰다 (만료 시각을 NodeState에 저장, 프레임 시각 기준).
     class Timeout : public Node
     {
     public:
         Timeout(const std::string& name, std::chrono::milliseconds timeout)
-            : Node(name, NodeType::TIMEOUT), timeout_(timeout), start_time_(std::chrono::steady_clock::now())
+            : Node(name, NodeType::TIMEOUT), timeout_(timeout)
         {
         }
 
@@ -27,31 +29,44 @@ namespace bt
                 return NodeStatus::SUCCESS;
             }
 
-            auto now     = std::chrono::steady_clock::now();
-            auto elapsed = now - start_time_;
+            const auto now   = context.GetFrameTime();
+            NodeState& state = context.GetNodeState(id_);
 
-            // 시간 초과 확인
-            if (elapsed >= timeout_)
+            if (!state.started)
             {
-                start_time_ = now; // 리셋
+                state.deadline = now + timeout_;
+                state.started  = true;
+            }
+
+            // 시간 초과 확인 (실행 중인 자식은 중단)
+            if (now >= state.deadline)
+            {
+                state.started = false; // 리셋
+                children_[0]->HaltSubtree(context);
                 return NodeStatus::FAILURE;
             }
 
             // 자식 노드 실행
-            NodeStatus child_status = children_[0]->Execute(context);
+            NodeStatus child_status = children_[0]->Tick(context);
 
-            // 자식이 완료되면 시간 리셋
+            // 자식이 완료되면 시간 리셋, 대기 중이면 늦어도 제한 시각에는 깨어나야 함
+            NodeState& after = context.GetNodeState(id_);
             if (child_status != NodeStatus::RUNNING)
             {
-                start_time_ = now;
+                after.started = false;
+            }
+            else
+            {
+                context.RequestWakeAt(after.deadline);
             }
 
             return child_status;
         }
 
+        std::chrono::milliseconds GetTimeout() const { return timeout_; }
+
     private:
-        std::chrono::milliseconds             timeout_;
-        std::chrono::steady_clock::time_point start_time_;
+        std::chrono::milliseconds timeout_;
     };
 
 } // namespace bt
@@ -1,15 +1,24 @@
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "Context.h"
+#include "IExecutor.h"
+#include "Scheduler.h"
+#include "SubTree.h"
+#include "ThreadPool.h"
 #include "Tree.h"
+#include "TreeSlot.h"
 
 namespace bt
 {
@@ -17,54 +26,582 @@ namespace bt
     // 전방 선언
     class Context;
 
+    // 등록된 트리의 정수 핸들 (이름당 하나, 등록 해제 후 다시 등록해도 같은 값)
+    using TreeId = uint32_t;
+    constexpr TreeId kInvalidTreeId = std::numeric_limits<TreeId>::max();
+
     // Behavior Tree 엔진
     class Engine
     {
     public:
-        Engine() {}
+        Engine() { PublishTable(std::make_unique<TreeTable>()); }
         ~Engine() {}
 
         // 트리 관리
-        void RegisterTree(const std::string& name, std::shared_ptr<Tree> tree)
+        // 이름마다 TreeSlot 하나에 현재 버전을 게시한다. 이미 등록된 이름에 다시 등록하면 새 버전으로 교체되며(핫 리로드),
+        // 슬롯에 연결된 실행자는 다음 틱 시작 시 새 버전을 가져간다. 틱 루프를 멈출 필요가 없다.
+        //
+        // 조회는 읽기 전용 트리 테이블 스냅샷을 통해 락 없이 이루어진다. 등록/해제만 trees_mutex_를 잡고 테이블을
+        // 복사해 새 스냅샷으로 교체한다. 틱 경로에서는 GetTreeId로 한 번 얻은 TreeId를 쓰면 문자열 해시도 없다.
+        uint64_t RegisterTree(const std::string& name, std::shared_ptr<Tree> tree)
         {
             std::lock_guard<std::mutex> lock(trees_mutex_);
-            trees_[name] = tree;
-        }
+            if (tree && profiling_ && !tree->IsProfiling())
+            {
+                tree->EnableProfiling();
+            }
+            if (tree && trace_recorder_)
+            {
+                tree->SetTraceRecorder(trace_recorder_);
+            }
 
-        std::shared_ptr<Tree> GetTree(const std::string& name)
-        {
-            std::lock_guard<std::mutex> lock(trees_mutex_);
-            auto                        it = trees_.find(name);
-            if (it != trees_.end())
+            const TreeTable* current = Snapshot();
+            if (tree)
+            {
+                LinkAvailable(name, *tree, *current);
+            }
+            auto it = current->ids.find(name);
+            if (it != current->ids.end())
             {
-                return it->second;
+                return current->slots[it->second]->Publish(std::move(tree)); // 테이블은 그대로, 슬롯만 교체
             }
-            return nullptr;
+
+            // 새 이름(또는 해제 후 재등록): 슬롯을 채운 뒤 테이블을 게시하므로 읽기 쪽은 빈 슬롯을 보지 않는다
+            TreeId id    = ids_.emplace(name, static_cast<TreeId>(ids_.size())).first->second;
+            auto   table = std::make_unique<TreeTable>(*current);
+            if (table->slots.size() <= id)
+            {
+                table->slots.resize(id + 1);
+            }
+            table->slots[id] = std::make_shared<TreeSlot>(name);
+            table->ids[name] = id;
+            uint64_t version = table->slots[id]->Publish(std::move(tree));
+            PublishTable(std::move(table));
+            return version;
+        }
+
+        // 등록된 트리를 새 버전으로 교체 (등록되지 않은 이름이면 false)
+        bool ReloadTree(const std::string& name, std::shared_ptr<Tree> tree)
+        {
+            if (!GetTreeSlot(name))
+                return false;
+            RegisterTree(name, std::move(tree));
+            return true;
+        }
+
+        // 이름을 TreeId로 변환 (등록되지 않은 이름이면 kInvalidTreeId)
+        TreeId GetTreeId(const std::string& name) const
+        {
+            const TreeTable* table = Snapshot();
+            auto             it    = table->ids.find(name);
+            return it != table->ids.end() ? it->second : kInvalidTreeId;
         }
 
+        // 관리용 조회 (shared_ptr 원자적 읽기는 구현에 따라 락을 잡는다, 틱 경로는 ExecuteTree나 TreeBinding을 쓴다)
+        std::shared_ptr<Tree> GetTree(TreeId id) const
+        {
+            const TreeSlot* slot = FindSlot(id);
+            return slot ? slot->Load() : nullptr;
+        }
+        std::shared_ptr<Tree> GetTree(const std::string& name) const { return GetTree(GetTreeId(name)); }
+
+        // 실행자가 핫 리로드를 따라가기 위해 연결할 슬롯 (IExecutor::BindTreeSlot)
+        std::shared_ptr<TreeSlot> GetTreeSlot(TreeId id) const
+        {
+            const TreeTable* table = Snapshot();
+            return id < table->slots.size() ? table->slots[id] : nullptr;
+        }
+        std::shared_ptr<TreeSlot> GetTreeSlot(const std::string& name) const { return GetTreeSlot(GetTreeId(name)); }
+
+        // 이름 등록만 해제 (슬롯에 연결된 실행자는 마지막 버전을 계속 실행한다, TreeId는 이름에 남는다)
         void UnregisterTree(const std::string& name)
         {
             std::lock_guard<std::mutex> lock(trees_mutex_);
-            trees_.erase(name);
+            const TreeTable*            current = Snapshot();
+            auto                        it      = current->ids.find(name);
+            if (it == current->ids.end())
+                return;
+
+            auto table = std::make_unique<TreeTable>(*current);
+            table->slots[it->second].reset();
+            table->ids.erase(name);
+            PublishTable(std::move(table));
+        }
+
+        // 트리 합성: 등록된 트리를 실행하는 SubTree 노드 생성
+        // 이미 등록된 트리면 바로 슬롯에 연결하고, 아니면 이름만 기억했다가 RegisterTree/LinkSubTrees에서 연결한다.
+        std::shared_ptr<SubTree> CreateSubTree(const std::string& node_name, TreeId id) const
+        {
+            return std::make_shared<SubTree>(node_name, GetTreeSlot(id));
+        }
+        std::shared_ptr<SubTree> CreateSubTree(const std::string& node_name, const std::string& tree_name) const
+        {
+            auto slot = GetTreeSlot(tree_name);
+            return slot ? std::make_shared<SubTree>(node_name, std::move(slot))
+                        : std::make_shared<SubTree>(node_name, tree_name);
+        }
+
+        // 링커: 등록된 모든 트리의 SubTree 참조를 이름으로 찾아 현재 슬롯에 연결하고 순환 참조를 검사한다.
+        // 같은 트리를 참조하는 SubTree는 모두 한 슬롯(한 벌의 그래프와 컴파일 결과)을 실행하므로 공통 동작이 메모리에
+        // 한 번만 존재한다. 등록되지 않은 트리를 참조하거나 순환이 있으면 TreeLinkError. 연결된 참조 수를 반환한다.
+        // 트리를 등록할 때도 이미 등록된 대상은 자동으로 연결되므로, 등록 순서와 관계없이 모두 등록한 뒤 한 번
+        // 호출한다.
+        // SubTree 노드를 수정하므로 틱 중이 아닐 때 호출한다.
+        size_t LinkSubTrees()
+        {
+            std::lock_guard<std::mutex> lock(trees_mutex_);
+            const TreeTable&            table  = *Snapshot();
+            size_t                      linked = 0;
+            for (const auto& [name, id] : table.ids)
+            {
+                auto tree = table.slots[id] ? table.slots[id]->Load() : nullptr;
+                if (!tree)
+                    continue;
+
+                std::vector<SubTree*> subtrees;
+                SubTree::Collect(tree->GetRoot().get(), subtrees);
+                for (SubTree* subtree : subtrees)
+                {
+                    auto target = table.ids.find(subtree->GetTreeName());
+                    if (target == table.ids.end())
+                        throw TreeLinkError(name + ": 등록되지 않은 하위 트리 '" + subtree->GetTreeName() + "'");
+                    if (Reaches(subtree->GetTreeName(), name, table))
+                        throw TreeLinkError(name + ": 하위 트리 '" + subtree->GetTreeName() + "'와 순환 참조");
+                    if (subtree->GetSlot() != table.slots[target->second])
+                    {
+                        subtree->Link(table.slots[target->second]); // 이미 연결된 참조는 건드리지 않는다
+                    }
+                    linked++;
+                }
+            }
+            return linked;
         }
 
         // 트리 실행
-        NodeStatus ExecuteTree(const std::string& name, Context& context)
+        // context가 마지막으로 실행한 슬롯 버전을 기억하므로, 같은 트리를 반복 실행하면 스냅샷과 버전 번호만 읽는다
+        // (핫 리로드로 버전이 바뀐 첫 실행에서만 트리 포인터를 다시 읽는다).
+        NodeStatus ExecuteTree(TreeId id, Context& context)
         {
-            auto tree = GetTree(name);
+            Tree* tree = AcquireTree(id, context);
             if (tree)
             {
                 return tree->Execute(context);
             }
             return NodeStatus::FAILURE;
         }
+        NodeStatus ExecuteTree(const std::string& name, Context& context) { return ExecuteTree(GetTreeId(name), context); }
+
+        // 노드 프로파일링: 등록된(이후 등록될) 모든 트리에 적용 (틱 중이 아닐 때 호출)
+        void SetProfilingEnabled(bool enabled)
+        {
+            std::lock_guard<std::mutex> lock(trees_mutex_);
+            profiling_ = enabled;
+            for (const auto& slot : Snapshot()->slots)
+            {
+                auto tree = slot ? slot->Load() : nullptr;
+                if (!tree)
+                    continue;
+                if (enabled && !tree->IsProfiling())
+                {
+                    tree->EnableProfiling();
+                }
+                else if (!enabled)
+                {
+                    tree->DisableProfiling();
+                }
+            }
+        }
+        bool IsProfilingEnabled() const { return profiling_; }
+
+        // 실행 추적 기록: 등록된(이후 등록될) 모든 트리에 연결, nullptr이면 해제 (틱 중이 아닐 때 호출)
+        void SetTraceRecorder(std::shared_ptr<TraceRecorder> recorder)
+        {
+            std::lock_guard<std::mutex> lock(trees_mutex_);
+            trace_recorder_ = std::move(recorder);
+            for (const auto& slot : Snapshot()->slots)
+            {
+                if (auto tree = slot ? slot->Load() : nullptr)
+                {
+                    tree->SetTraceRecorder(trace_recorder_);
+                }
+            }
+        }
+        std::shared_ptr<TraceRecorder> GetTraceRecorder() const
+        {
+            std::lock_guard<std::mutex> lock(trees_mutex_);
+            return trace_recorder_;
+        }
+
+        // 프로파일 내보내기: 트리별 JSON 배열 / 모든 트리의 collapsed-stack (flamegraph.pl 입력)
+        std::string ExportProfileJson(int indent = -1) const
+        {
+            nlohmann::json trees = nlohmann::json::array();
+            for (const auto& profiler : GetProfilers())
+            {
+                trees.push_back(profiler->ToJson());
+            }
+            return trees.dump(indent);
+        }
+
+        std::string ExportCollapsedStacks() const
+        {
+            std::string stacks;
+            for (const auto& profiler : GetProfilers())
+            {
+                stacks += profiler->ToCollapsedStacks();
+            }
+            return stacks;
+        }
+
+        // 이벤트 기반 스케줄링
+        // 매 프레임 scheduler.CollectReady(now)가 돌려준 에이전트만 틱하고, 틱 후 ParkIfIdle로 대기 여부를 결정한다.
+        Scheduler&       GetScheduler() { return scheduler_; }
+        const Scheduler& GetScheduler() const { return scheduler_; }
+
+        // 트리가 대기 상태(Delay 등)에서만 RUNNING이면 에이전트를 깨어날 시각/의존 이벤트까지 대기시킨다
+        bool ParkIfIdle(Scheduler::AgentId agent, const Tree& tree, const Context& context)
+        {
+            if (!tree.CanPark(context))
+                return false;
+
+            scheduler_.Park(agent, context.GetWakeTime(), tree.GetDependencies());
+            return scheduler_.IsParked(agent);
+        }
+
+        // 블랙보드 키 변경/게임 이벤트 알림 (해당 키에 의존하는 대기 에이전트를 깨움)
+        void NotifyEvent(const std::string& event) { scheduler_.Notify(event); }
+        void NotifyEvent(Scheduler::AgentId agent, const std::string& event) { scheduler_.Notify(agent, event); }
+
+        // 병렬 틱 설정 (0이면 호출 스레드에서 순차 실행)
+        void SetThreadCount(size_t thread_count)
+        {
+            pool_ = thread_count > 0 ? std::make_unique<WorkStealingPool>(thread_count) : nullptr;
+        }
+        size_t GetThreadCount() const { return pool_ ? pool_->GetThreadCount() : 0; }
+        void   SetTickGrain(size_t grain) { tick_grain_ = grain > 0 ? grain : 1; }
+
+        // 비동기 작업 풀 (AsyncAction::OnPool에 넘긴다, 0이면 제거)
+        // 풀을 쓰는 트리가 실행 중이 아닐 때 바꾼다. 틱 배치용 스레드 풀과는 별개다.
+        void SetJobThreadCount(size_t thread_count)
+        {
+            job_pool_ = thread_count > 0 ? std::make_unique<JobPool>(thread_count) : nullptr;
+        }
+        JobPool* GetJobPool() const { return job_pool_.get(); }
+
+        // 실행자 배치를 스레드 풀에 나눠 틱하고, 모두 끝나면(배리어) commit을 인덱스 순서로 순차 호출
+        //
+        // 병렬 단계 계약:
+        //  - 각 실행자는 한 프레임에 정확히 한 번, 한 스레드에서만 Update된다.
+        //  - Update는 자기 에이전트의 상태(Context, 소유한 몬스터 등)만 쓴다. 트리 정의와 월드 상태는 읽기 전용이다.
+        //  - 다른 에이전트나 월드에 대한 쓰기는 commit 단계로 미룬다. commit은 호출 스레드에서 배치 순서대로 실행되므로
+        //    결과가 스레드 수와 관계없이 결정적이다.
+        //  - 시간 기반 노드는 프레임 시작에 한 번 읽은 시각을 공유한다 (Context::SetFrameTime).
+        void TickAll(const std::vector<std::shared_ptr<IExecutor>>&  executors,
+                     float                                          delta_time,
+                     const std::function<void(size_t, IExecutor&)>& commit = nullptr)
+        {
+            TickAll(executors, delta_time, std::chrono::steady_clock::now(), commit);
+        }
+
+        // 프레임 시각을 호출자가 정하는 버전 (스케줄러의 CollectReady와 같은 시각을 쓸 때)
+        void TickAll(const std::vector<std::shared_ptr<IExecutor>>&  executors,
+                     float                                          delta_time,
+                     std::chrono::steady_clock::time_point          frame_time,
+                     const std::function<void(size_t, IExecutor&)>& commit = nullptr)
+        {
+            auto tick_range = [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    if (executors[i])
+                    {
+                        executors[i]->GetContext().SetFrameTime(frame_time);
+                        executors[i]->Update(delta_time);
+                    }
+                }
+            };
+
+            RunRange(executors.size(), tick_grain_, tick_range);
+
+            if (commit)
+            {
+                for (size_t i = 0; i < executors.size(); ++i)
+                {
+                    if (executors[i])
+                    {
+                        commit(i, *executors[i]);
+                    }
+                }
+            }
+        }
+
+        // 같은 트리를 실행하는 에이전트를 묶어 틱 (IExecutor::PrepareBatchTick, Tree::ExecuteBatch)
+        // 준비 단계는 TickAll과 같이 실행자별로 나눠 실행하고, 실행 단계는 트리별 에이전트 목록을 batch_grain 단위로
+        // 나눠 스레드 풀에 넘긴다. 병렬 단계 계약과 commit 순서는 TickAll과 같다.
+        // 실행자 목록과 묶음 작업 공간을 엔진이 보관하므로 한 번에 한 스레드에서만 호출한다.
+        void TickAllBatched(const std::vector<std::shared_ptr<IExecutor>>&  executors,
+                            float                                          delta_time,
+                            std::chrono::steady_clock::time_point          frame_time,
+                            const std::function<void(size_t, IExecutor&)>& commit = nullptr)
+        {
+            prepared_.assign(executors.size(), nullptr);
+            auto prepare_range = [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    if (executors[i])
+                    {
+                        executors[i]->GetContext().SetFrameTime(frame_time);
+                        prepared_[i] = executors[i]->PrepareBatchTick(delta_time);
+                    }
+                }
+            };
+            RunRange(executors.size(), tick_grain_, prepare_range);
+
+            // 트리별로 모은다 (트리 종류는 적으므로 선형 탐색, 목록은 프레임마다 재사용)
+            for (auto& group : batch_groups_)
+            {
+                group.tree = nullptr;
+                group.contexts.clear();
+            }
+            for (size_t i = 0; i < executors.size(); ++i)
+            {
+                if (Tree* tree = prepared_[i])
+                {
+                    FindBatchGroup(tree).contexts.push_back(&executors[i]->GetContext());
+                }
+            }
+
+            batch_chunks_.clear();
+            for (auto& group : batch_groups_)
+            {
+                group.statuses.resize(group.contexts.size());
+                for (size_t begin = 0; begin < group.contexts.size(); begin += batch_grain_)
+                {
+                    batch_chunks_.push_back({&group, begin, std::min(begin + batch_grain_, group.contexts.size())});
+                }
+            }
+            auto execute_range = [&](size_t begin, size_t end)
+            {
+                static thread_local CompiledTree::BatchScratch scratch;
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const BatchChunk& chunk = batch_chunks_[i];
+                    chunk.group->tree->ExecuteBatch(chunk.group->contexts.data() + chunk.begin,
+                                                    chunk.end - chunk.begin,
+                                                    chunk.group->statuses.data() + chunk.begin,
+                                                    scratch);
+                }
+            };
+            RunRange(batch_chunks_.size(), 1, execute_range);
+
+            if (commit)
+            {
+                for (size_t i = 0; i < executors.size(); ++i)
+                {
+                    if (executors[i])
+                    {
+                        commit(i, *executors[i]);
+                    }
+                }
+            }
+        }
+
+        // 배치 틱에서 스레드 하나가 한 번에 실행할 에이전트 수
+        void SetBatchGrain(size_t grain) { batch_grain_ = grain > 0 ? grain : 1; }
+
+        // 교체된 트리 테이블 스냅샷 해제 (해제한 수 반환)
+        // 스냅샷은 새 이름을 등록하거나 이름을 해제할 때만 쌓이며(같은 이름의 핫 리로드는 쌓이지 않는다), 이 호출
+        // 전까지 남는다. 다른 스레드가 엔진을 조회하지 않을 때(틱 사이 등) 호출한다.
+        size_t ReclaimTables()
+        {
+            std::lock_guard<std::mutex> lock(trees_mutex_);
+            const size_t                released = tables_.size() - 1;
+            tables_.erase(tables_.begin(), tables_.end() - 1);
+            return released;
+        }
 
         // 통계
-        size_t GetRegisteredTrees() const { return trees_.size(); }
+        size_t GetRegisteredTrees() const { return Snapshot()->ids.size(); }
+        size_t GetRetainedTables() const
+        {
+            std::lock_guard<std::mutex> lock(trees_mutex_);
+            return tables_.size();
+        }
 
     private:
-        std::unordered_map<std::string, std::shared_ptr<Tree>> trees_;
-        mutable std::mutex                                     trees_mutex_;
+        // 읽기 전용 트리 테이블 (게시 후에는 바뀌지 않는다)
+        struct TreeTable
+        {
+            std::vector<std::shared_ptr<TreeSlot>>  slots; // TreeId로 인덱싱 (해제된 id는 nullptr)
+            std::unordered_map<std::string, TreeId> ids;   // 등록된 이름만
+        };
+
+        const TreeTable* Snapshot() const { return table_.load(std::memory_order_acquire); }
+
+        // 배치 틱의 트리별 에이전트 목록
+        struct BatchGroup
+        {
+            Tree*                   tree = nullptr;
+            std::vector<Context*>   contexts;
+            std::vector<NodeStatus> statuses;
+        };
+
+        // 스레드 하나가 실행할 목록 구간
+        struct BatchChunk
+        {
+            BatchGroup* group;
+            size_t      begin;
+            size_t      end;
+        };
+
+        BatchGroup& FindBatchGroup(Tree* tree)
+        {
+            for (auto& group : batch_groups_)
+            {
+                if (group.tree == tree || !group.tree)
+                {
+                    group.tree = tree;
+                    return group;
+                }
+            }
+            batch_groups_.emplace_back();
+            batch_groups_.back().tree = tree;
+            return batch_groups_.back();
+        }
+
+        // 풀이 있고 작업이 grain보다 많으면 나눠 실행, 아니면 호출 스레드에서 실행
+        void RunRange(size_t count, size_t grain, const WorkStealingPool::RangeFunction& function)
+        {
+            if (pool_ && count > grain)
+            {
+                pool_->ParallelFor(count, grain, function);
+            }
+            else
+            {
+                function(0, count);
+            }
+        }
+
+        // 새로 등록하는 트리의 SubTree 중 대상이 이미 등록되어 있고 순환을 만들지 않는 참조만 연결
+        // (trees_mutex_를 잡고 호출)
+        // 나머지는 연결하지 않은 채 두며 실행 시 FAILURE, LinkSubTrees가 오류로 보고한다.
+        void LinkAvailable(const std::string& name, Tree& tree, const TreeTable& table)
+        {
+            std::vector<SubTree*> subtrees;
+            SubTree::Collect(tree.GetRoot().get(), subtrees);
+            for (SubTree* subtree : subtrees)
+            {
+                auto target = table.ids.find(subtree->GetTreeName());
+                if (target != table.ids.end() && !Reaches(subtree->GetTreeName(), name, table))
+                {
+                    subtree->Link(table.slots[target->second]);
+                }
+            }
+        }
+
+        // from 트리에서 SubTree 참조를 따라가 to 트리에 도달하는지 (from == to 포함)
+        static bool Reaches(const std::string& from, const std::string& to, const TreeTable& table)
+        {
+            std::vector<std::string>        stack = {from};
+            std::unordered_set<std::string> visited;
+            while (!stack.empty())
+            {
+                std::string name = std::move(stack.back());
+                stack.pop_back();
+                if (name == to)
+                    return true;
+                if (!visited.insert(name).second)
+                    continue;
+
+                auto it   = table.ids.find(name);
+                auto tree = (it != table.ids.end() && table.slots[it->second]) ? table.slots[it->second]->Load()
+                                                                                : nullptr;
+                if (!tree)
+                    continue;
+                std::vector<SubTree*> subtrees;
+                SubTree::Collect(tree->GetRoot().get(), subtrees);
+                for (SubTree* subtree : subtrees)
+                {
+                    stack.push_back(subtree->GetTreeName());
+                }
+            }
+            return false;
+        }
+
+        const TreeSlot* FindSlot(TreeId id) const
+        {
+            const TreeTable* table = Snapshot();
+            return id < table->slots.size() ? table->slots[id].get() : nullptr;
+        }
+
+        // context의 캐시가 같은 슬롯의 같은 버전이면 그대로, 아니면 슬롯에서 현재 버전을 읽어 캐시를 갱신
+        // 같은 슬롯의 새 버전이면 TreeBinding::Acquire와 같이 실행 상태를 이전한다 (구조가 다르면 처음부터 실행).
+        static Tree* AcquireTree(TreeId id, Context& context, const TreeTable& table)
+        {
+            if (id >= table.slots.size() || !table.slots[id])
+                return nullptr;
+
+            const std::shared_ptr<TreeSlot>& slot    = table.slots[id];
+            Context::TreeCache&              cache   = context.GetTreeCache();
+            const uint64_t                   version = slot->GetVersion();
+            if (cache.slot != slot || cache.version != version)
+            {
+                std::shared_ptr<Tree> next = slot->Load();
+                if (cache.slot == slot && cache.tree && next && next != cache.tree)
+                {
+                    next->AdoptState(*cache.tree, context);
+                }
+                cache.slot    = slot;
+                cache.version = version;
+                cache.tree    = std::move(next);
+            }
+            return cache.tree.get();
+        }
+        Tree* AcquireTree(TreeId id, Context& context) const { return AcquireTree(id, context, *Snapshot()); }
+
+        // 새 스냅샷 게시 (trees_mutex_를 잡고 호출)
+        // 이전 스냅샷은 읽는 중인 스레드가 있을 수 있으므로 ReclaimTables나 엔진 소멸 때 해제한다. 덕분에 읽기 쪽은
+        // 참조 카운트나 에포크 표시 없이 포인터 하나만 읽는다. 보관량은 (이름 등록/해제 횟수) x (테이블 크기)이다.
+        void PublishTable(std::unique_ptr<TreeTable> table)
+        {
+            table_.store(table.get(), std::memory_order_release);
+            tables_.push_back(std::move(table));
+        }
+
+        // 프로파일링 중인 트리의 프로파일러 (이름 순, 출력이 실행마다 같은 순서가 되도록)
+        std::vector<std::shared_ptr<Profiler>> GetProfilers() const
+        {
+            std::vector<std::shared_ptr<Profiler>> profilers;
+            std::lock_guard<std::mutex>            lock(trees_mutex_);
+            for (const auto& slot : Snapshot()->slots)
+            {
+                auto tree = slot ? slot->Load() : nullptr;
+                if (tree && tree->GetProfiler())
+                {
+                    profilers.push_back(tree->GetProfiler());
+                }
+            }
+            std::sort(profilers.begin(),
+                      profilers.end(),
+                      [](const auto& a, const auto& b) { return a->GetTreeName() < b->GetTreeName(); });
+            return profilers;
+        }
+
+        std::atomic<const TreeTable*>           table_{nullptr}; // 현재 스냅샷
+        std::vector<std::unique_ptr<TreeTable>> tables_;         // 게시한 모든 스냅샷 (쓰기 쪽, trees_mutex_)
+        std::unordered_map<std::string, TreeId> ids_;            // 한 번이라도 등록된 이름의 id (쓰기 쪽)
+        mutable std::mutex                      trees_mutex_;    // 등록/해제/프로파일링 설정 직렬화
+        Scheduler                               scheduler_;
+        std::unique_ptr<WorkStealingPool>       pool_;
+        std::unique_ptr<JobPool>                job_pool_;
+        size_t                                  tick_grain_  = 16;
+        size_t                                  batch_grain_ = 256;
+        bool                                    profiling_   = false;
+        std::shared_ptr<TraceRecorder>          trace_recorder_; // 실행 추적 (trees_mutex_)
+        std::vector<Tree*>                      prepared_;     // 배치 틱: 실행자별 준비된 트리
+        std::vector<BatchGroup>                 batch_groups_; // 배치 틱: 트리별 에이전트 목록 (재사용)
+        std::vector<BatchChunk>                 batch_chunks_;
     };
 
 } // namespace bt
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace bt
+{
+
+    // 에이전트별 코루틴 프레임 할당기 (CoAction)
+    // 크기 구간(64바이트 단위)별 해제 목록을 두고, 새 블록은 4KB 청크에서 잘라 쓴다. 해제된 프레임은 같은 구간의
+    // 다음 할당에 재사용되므로 같은 행동을 반복하는 에이전트는 정상 상태에서 전역 힙을 쓰지 않는다.
+    // 블록 앞의 헤더에 소속 아레나를 기록하므로 해제할 때 아레나를 몰라도 된다. 아레나는 모든 프레임보다 오래 살아야 한다.
+    // 청크는 upstream에서 받는다 (에이전트 아레나를 넘기면 프레임도 에이전트 메모리에 모인다).
+    class FrameArena
+    {
+    public:
+        static constexpr size_t kGranule    = 64;
+        static constexpr size_t kClassCount = 32; // 구간 최대 2KB, 그보다 큰 프레임은 전역 힙
+        static constexpr size_t kChunkSize  = 4096;
+
+        explicit FrameArena(std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+            : upstream_(upstream), chunks_(upstream)
+        {
+        }
+        ~FrameArena()
+        {
+            for (std::byte* chunk : chunks_)
+            {
+                upstream_->deallocate(chunk, kChunkSize, alignof(std::max_align_t));
+            }
+        }
+
+        FrameArena(const FrameArena&)            = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        // arena가 nullptr이면 전역 힙에서 할당
+        static void* Allocate(FrameArena* arena, size_t size)
+        {
+            size_t   total      = size + kHeaderSize;
+            uint32_t size_class = static_cast<uint32_t>((total + kGranule - 1) / kGranule - 1);
+            void*    raw        = nullptr;
+            if (arena && size_class < kClassCount)
+            {
+                raw = arena->Take(size_class);
+            }
+            else
+            {
+                arena      = nullptr;
+                size_class = kClassCount;
+                raw        = ::operator new(total);
+            }
+
+            auto* header       = static_cast<Header*>(raw);
+            header->arena      = arena;
+            header->size_class = size_class;
+            return static_cast<std::byte*>(raw) + kHeaderSize;
+        }
+
+        static void Deallocate(void* ptr)
+        {
+            if (!ptr)
+                return;
+
+            auto* header = reinterpret_cast<Header*>(static_cast<std::byte*>(ptr) - kHeaderSize);
+            if (header->arena)
+            {
+                header->arena->Give(header->size_class, header);
+            }
+            else
+            {
+                ::operator delete(header);
+            }
+        }
+
+        size_t GetChunkCount() const { return chunks_.size(); }
+
+        // 이 스레드에서 지금 할당에 쓸 아레나 (Scope로 지정, 코루틴 promise의 operator new가 사용)
+        static FrameArena*& Current()
+        {
+            static thread_local FrameArena* current = nullptr;
+            return current;
+        }
+
+        class Scope
+        {
+        public:
+            explicit Scope(FrameArena* arena) : previous_(Current()) { Current() = arena; }
+            ~Scope() { Current() = previous_; }
+
+            Scope(const Scope&)            = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            FrameArena* previous_;
+        };
+
+    private:
+        struct Header
+        {
+            FrameArena* arena;
+            uint32_t    size_class;
+        };
+        static constexpr size_t kHeaderSize = alignof(std::max_align_t) > sizeof(Header) ? alignof(std::max_align_t)
+                                                                                         : sizeof(Header);
+
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        void* Take(uint32_t size_class)
+        {
+            if (FreeBlock* block = free_[size_class])
+            {
+                free_[size_class] = block->next;
+                return block;
+            }
+
+            size_t block_size = (size_class + 1) * kGranule;
+            if (remaining_ < block_size)
+            {
+                chunks_.push_back(static_cast<std::byte*>(upstream_->allocate(kChunkSize, alignof(std::max_align_t))));
+                cursor_    = chunks_.back();
+                remaining_ = kChunkSize; // 남은 자투리는 버린다
+            }
+            void* block = cursor_;
+            cursor_ += block_size;
+            remaining_ -= block_size;
+            return block;
+        }
+
+        void Give(uint32_t size_class, void* raw)
+        {
+            auto* block       = static_cast<FreeBlock*>(raw);
+            block->next       = free_[size_class];
+            free_[size_class] = block;
+        }
+
+        std::pmr::memory_resource*   upstream_;
+        FreeBlock*                   free_[kClassCount] = {};
+        std::pmr::vector<std::byte*> chunks_;
+        std::byte*                   cursor_    = nullptr;
+        size_t                       remaining_ = 0;
+    };
+
+} // namespace bt
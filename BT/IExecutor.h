@@ -3,12 +3,13 @@
 #include <memory>
 #include <string>
 
+#include "TreeSlot.h"
+
 namespace bt
 {
 
     // 전방 선언
     class Context;
-    class Tree;
 
     // Behavior Tree 실행자 인터페이스
     class IExecutor
@@ -19,10 +20,23 @@ namespace bt
         // AI 업데이트
         virtual void Update(float delta_time) = 0;
 
+        // 배치 틱 준비 (Engine::TickAllBatched)
+        // 트리 실행 직전까지 Update와 같은 준비(에이전트 설정 등)를 하고 이번 틱에 실행할 트리를 반환하면, 엔진이
+        // 같은 트리를 실행하는 에이전트를 묶어 실행한다. 실행할 것이 없으면 nullptr을 반환한다.
+        // 기본 구현은 배치를 지원하지 않는 실행자용으로 Update를 바로 호출한다.
+        virtual Tree* PrepareBatchTick(float delta_time)
+        {
+            Update(delta_time);
+            return nullptr;
+        }
+
         // Behavior Tree 설정
         virtual void                  SetBehaviorTree(std::shared_ptr<Tree> tree) = 0;
         virtual std::shared_ptr<Tree> GetBehaviorTree() const                     = 0;
 
+        // 엔진 슬롯 연결 (핫 리로드를 따라가려면 재정의, 기본 구현은 현재 버전을 고정으로 설정)
+        virtual void BindTreeSlot(std::shared_ptr<TreeSlot> slot) { SetBehaviorTree(slot ? slot->Load() : nullptr); }
+
         // 컨텍스트 접근
         virtual Context&       GetContext()       = 0;
         virtual const Context& GetContext() const = 0;
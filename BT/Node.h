@@ -1,20 +1,30 @@
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include <cstdint>
+
 namespace bt
 {
 
     // Behavior Tree 노드 상태
-    enum class NodeStatus
+    enum class NodeStatus : uint8_t
     {
         SUCCESS,
         FAILURE,
         RUNNING
     };
 
+    // 트리 실행 모드
+    enum class ExecutionMode : uint8_t
+    {
+        REACTIVE, // 매 틱 루트부터 다시 평가 (기본)
+        MEMORY    // Sequence/Selector가 실행 중인 자식부터 재개 (가드 조건은 재확인)
+    };
+
     // Behavior Tree 노드 타입
     enum class NodeType
     {
@@ -28,7 +38,9 @@ namespace bt
         INVERT,
         DELAY,
         TIMEOUT,
-        BLACKBOARD
+        COOLDOWN,
+        BLACKBOARD,
+        SUBTREE
     };
 
     // 전방 선언
@@ -44,15 +56,23 @@ namespace bt
         // 노드 실행
         virtual NodeStatus Execute(Context& context) = 0;
 
+        // 자식 실행 진입점 (Execute 호출 후 에이전트별 상태 기록, Context.h에 정의)
+        // 복합/데코레이터 노드는 자식에 대해 Execute 대신 Tick을 호출한다.
+        NodeStatus Tick(Context& context);
+
         // 노드 정보
         const std::string& GetName() const { return name_; }
         NodeType           GetType() const { return type_; }
 
+        // 트리 내 노드 id (에이전트별 상태 블록 인덱스, Tree::SetRoot에서 부여)
+        uint32_t GetId() const { return id_; }
+        void     SetId(uint32_t id) { id_ = id; }
+
         // 자식 노드 관리
         void                                      AddChild(std::shared_ptr<Node> child) { children_.push_back(child); }
         const std::vector<std::shared_ptr<Node>>& GetChildren() const { return children_; }
 
-        // 노드 상태
+        // 노드 상태 (노드 자체에 기록하는 값 - 트리를 공유할 때는 Context의 NodeState를 사용)
         NodeStatus GetLastStatus() const { return last_status_; }
         void       SetLastStatus(NodeStatus status) { last_status_ = status; }
 
@@ -60,18 +80,67 @@ namespace bt
         bool IsRunning() const { return is_running_; }
         void SetRunning(bool running) { is_running_ = running; }
 
-        // 노드 초기화 (새로운 실행 시작 시)
-        virtual void Initialize() { is_running_ = false; }
+        // 노드 초기화 (노드 자체 상태를 쓰는 사용자 노드용, 중단된 노드에만 호출되어 다음 실행을 처음부터 시작)
+        // 공유 트리를 여러 스레드가 실행할 수 있으므로 값이 바뀔 때만 쓴다.
+        virtual void Initialize()
+        {
+            if (is_running_)
+                is_running_ = false;
+        }
+
+        // 노드 정리 (RUNNING이던 노드가 중단될 때)
+        virtual void Cleanup()
+        {
+            if (is_running_)
+                is_running_ = false;
+        }
+
+        // 에이전트의 실행이 끝나기 전에 중단될 때 호출 (진행 중인 비동기 작업 취소 등, 기본은 할 일 없음)
+        virtual void Halt(Context& /* context */) {}
 
-        // 노드 정리 (실행 완료 시)
-        virtual void Cleanup() { is_running_ = false; }
+        // 이 노드에서 시작하는 실행 중 경로를 중단 (Context.h에 정의)
+        // 에이전트 상태가 RUNNING인 노드만 따라 내려가 자식부터 Halt/Cleanup/Initialize를 호출하고 상태를 리셋한다.
+        // RUNNING이 아닌 노드에서는 바로 반환하므로 비용은 중단되는 경로의 길이에 비례한다.
+        void HaltSubtree(Context& context);
+
+        // 가드 조건 노드인지 (메모리 모드에서 매 틱 재평가 대상)
+        bool IsGuard() const { return type_ == NodeType::CONDITION; }
+
+        // 조건도 Sequence도 아닌 노드를 메모리 Selector가 선점 가드로 확인할 때 (기본은 가드 없음)
+        // 다른 트리를 감싸는 노드(SubTree)가 그 트리 루트의 가드로 위임한다.
+        virtual bool PassesGuard(Context& /* context */) { return false; }
+
+        // 틱 단위 순수 노드 선언 (Context.h에 정의, 트리를 공유하기 전에 호출)
+        // 같은 틱 안에서는 결과가 바뀌지 않는 조건의 결과를 에이전트 상태에 캐시하고, 같은 memo_key를 선언한 노드는
+        // 그 틱의 나머지 동안 Execute 없이 결과를 재사용한다 (서로 다른 Sequence에 있는 HasTarget 등).
+        // invalidate_on의 블랙보드 키가 에이전트 계층에 쓰이면 캐시된 결과를 버린다.
+        void DeclarePure(const std::string& memo_key, const std::vector<std::string>& invalidate_on = {});
+        bool IsPure() const { return memo_id_ != kNoMemo; }
+
+        // Execute 호출 (순수 노드는 이번 틱에 캐시된 결과가 있으면 재사용, Context.h에 정의)
+        NodeStatus Evaluate(Context& context);
+
+        // 순수 노드의 이번 틱 캐시 조회/기록 (Evaluate 없이 결과를 직접 계산하는 배치 실행용, Context.h에 정의)
+        bool RecallMemo(Context& context, NodeStatus& status) const;
+        void StoreMemo(Context& context, NodeStatus status) const;
 
     protected:
+        // 반응형 Sequence/Selector: 이번 틱이 index 자식에서 status로 끝났을 때 호출 (Context.h에 정의)
+        // 직전 틱에 더 뒤의 자식이 실행 중이었으면 그 경로를 중단하고, 실행 중인 자식 위치를 child_index에 기록한다.
+        NodeStatus SwitchRunningChild(Context& context, size_t index, NodeStatus status);
+
         std::string                        name_;
         NodeType                           type_;
         std::vector<std::shared_ptr<Node>> children_;
         NodeStatus                         last_status_ = NodeStatus::FAILURE;
         bool                               is_running_  = false;
+        uint32_t                           id_          = 0;
+
+    private:
+        static constexpr uint32_t kNoMemo = std::numeric_limits<uint32_t>::max();
+
+        uint32_t              memo_id_ = kNoMemo; // 순수 노드 결과 캐시 id
+        std::vector<uint32_t> memo_deps_;         // 캐시를 무효화하는 블랙보드 키 id
     };
 
 } // namespace bt
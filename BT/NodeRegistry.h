@@ -0,0 +1,346 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+#include <cstdlib>
+#include <variant>
+
+#include "Blackboard.h"
+#include "Control/Parallel.h"
+#include "Control/Random.h"
+#include "Control/Selector.h"
+#include "Control/Sequence.h"
+#include "Control/WeightedRandomSelector.h"
+#include "Decorator/Cooldown.h"
+#include "Decorator/Delay.h"
+#include "Decorator/Invert.h"
+#include "Decorator/Repeat.h"
+#include "Decorator/Timeout.h"
+#include "Node.h"
+#include "SubTree.h"
+
+namespace bt
+{
+
+    // 데이터 기반 노드 파라미터 타입
+    enum class ParamType : uint8_t
+    {
+        INT,
+        FLOAT,
+        BOOL,
+        STRING,
+        KEY // 블랙보드 키 이름 (값 타입은 ParamSpec::key_type)
+    };
+
+    inline const char* ParamTypeName(ParamType type)
+    {
+        switch (type)
+        {
+            case ParamType::INT:
+                return "int";
+            case ParamType::FLOAT:
+                return "float";
+            case ParamType::BOOL:
+                return "bool";
+            case ParamType::STRING:
+                return "string";
+            default:
+                return "key";
+        }
+    }
+
+    // 이름 → 타입 (블랙보드 스키마 선언용, KEY는 허용하지 않음)
+    inline bool ParseValueType(const std::string& name, ParamType& type)
+    {
+        for (ParamType candidate : {ParamType::INT, ParamType::FLOAT, ParamType::BOOL, ParamType::STRING})
+        {
+            if (name == ParamTypeName(candidate))
+            {
+                type = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // 파라미터 값 (KEY는 키 이름 문자열로 저장)
+    using ParamValue = std::variant<int64_t, double, bool, std::string>;
+
+    // 노드 타입이 받는 파라미터 하나의 선언
+    struct ParamSpec
+    {
+        std::string              name;
+        ParamType                type     = ParamType::INT;
+        ParamType                key_type = ParamType::INT; // type이 KEY일 때 키가 담는 값 타입
+        bool                     required = true;
+        ParamValue               default_value;
+        std::vector<std::string> choices; // STRING 허용 값 (비어 있으면 제한 없음)
+    };
+
+    // 검증을 마친 노드 파라미터 (선택 파라미터의 기본값이 채워져 있다)
+    class NodeParams
+    {
+    public:
+        void Set(const std::string& name, ParamValue value)
+        {
+            for (auto& entry : values_)
+            {
+                if (entry.first == name)
+                {
+                    entry.second = std::move(value);
+                    return;
+                }
+            }
+            values_.emplace_back(name, std::move(value));
+        }
+
+        bool Has(const std::string& name) const { return Find(name) != nullptr; }
+
+        int64_t GetInt(const std::string& name) const { return std::get<int64_t>(Get(name)); }
+        bool    GetBool(const std::string& name) const { return std::get<bool>(Get(name)); }
+
+        double GetFloat(const std::string& name) const
+        {
+            const ParamValue& value = Get(name);
+            return std::holds_alternative<int64_t>(value) ? static_cast<double>(std::get<int64_t>(value))
+                                                          : std::get<double>(value);
+        }
+
+        const std::string& GetString(const std::string& name) const { return std::get<std::string>(Get(name)); }
+
+        // KEY 파라미터를 타입 키로 변환 (타입 일치는 로드 시 검증됨)
+        template <typename T>
+        BlackboardKey<T> GetKey(const std::string& name) const
+        {
+            return BlackboardKey<T>(GetString(name));
+        }
+
+    private:
+        const ParamValue* Find(const std::string& name) const
+        {
+            for (const auto& entry : values_)
+            {
+                if (entry.first == name)
+                    return &entry.second;
+            }
+            return nullptr;
+        }
+
+        const ParamValue& Get(const std::string& name) const
+        {
+            const ParamValue* value = Find(name);
+            if (!value)
+            {
+                throw std::out_of_range("정의되지 않은 노드 파라미터: " + name);
+            }
+            return *value;
+        }
+
+        std::vector<std::pair<std::string, ParamValue>> values_;
+    };
+
+    // 노드 타입 하나의 등록 정보 (생성 함수 + 파라미터/자식 수 제약)
+    struct NodeTypeInfo
+    {
+        using Factory = std::function<std::shared_ptr<Node>(const std::string& name, const NodeParams& params)>;
+
+        std::string            type;
+        Factory                factory;
+        std::vector<ParamSpec> params;
+        size_t                 min_children = 0;
+        size_t                 max_children = 0;
+
+        // 구성 도우미 (등록 시 연쇄 호출)
+        NodeTypeInfo& Children(size_t min, size_t max = std::numeric_limits<size_t>::max())
+        {
+            min_children = min;
+            max_children = max;
+            return *this;
+        }
+
+        NodeTypeInfo& Param(const std::string& name, ParamType param_type)
+        {
+            params.push_back({name, param_type, ParamType::INT, true, ParamValue(), {}});
+            return *this;
+        }
+
+        NodeTypeInfo& Param(const std::string& name, ParamType param_type, ParamValue default_value)
+        {
+            params.push_back({name, param_type, ParamType::INT, false, std::move(default_value), {}});
+            return *this;
+        }
+
+        NodeTypeInfo& KeyParam(const std::string& name, ParamType value_type)
+        {
+            params.push_back({name, ParamType::KEY, value_type, true, ParamValue(), {}});
+            return *this;
+        }
+
+        NodeTypeInfo& Choices(std::vector<std::string> values)
+        {
+            params.back().choices = std::move(values);
+            return *this;
+        }
+
+        const ParamSpec* FindParam(const std::string& name) const
+        {
+            for (const auto& spec : params)
+            {
+                if (spec.name == name)
+                    return &spec;
+            }
+            return nullptr;
+        }
+    };
+
+    // 노드 타입 이름 → 생성 함수 등록부 (데이터 기반 트리 로딩용)
+    // 기본 제어/데코레이터 노드는 생성 시 등록되며, 게임 쪽 리프 노드는 RegisterLeaf 등으로 추가한다.
+    // 로딩 중에는 읽기만 하므로 등록을 마친 뒤에는 여러 스레드에서 함께 사용해도 된다.
+    class NodeRegistry
+    {
+    public:
+        NodeRegistry() { RegisterBuiltins(); }
+
+        // 노드 타입 등록 (같은 이름은 덮어쓴다). 반환값으로 파라미터/자식 수 제약을 이어서 선언한다.
+        NodeTypeInfo& Register(const std::string& type, NodeTypeInfo::Factory factory)
+        {
+            NodeTypeInfo& info = types_[type];
+            info               = NodeTypeInfo();
+            info.type          = type;
+            info.factory       = std::move(factory);
+            return info;
+        }
+
+        // (name) 생성자를 갖는 리프 노드 등록
+        template <typename TNode>
+        NodeTypeInfo& RegisterLeaf(const std::string& type)
+        {
+            static_assert(std::is_base_of<Node, TNode>::value, "TNode는 Node를 상속해야 합니다");
+            return Register(type,
+                            [](const std::string& name, const NodeParams&) { return std::make_shared<TNode>(name); });
+        }
+
+        const NodeTypeInfo* Find(const std::string& type) const
+        {
+            auto it = types_.find(type);
+            return it != types_.end() ? &it->second : nullptr;
+        }
+
+        bool   Has(const std::string& type) const { return types_.count(type) > 0; }
+        size_t Size() const { return types_.size(); }
+
+    private:
+        void RegisterBuiltins()
+        {
+            Register("Sequence", [](const std::string& name, const NodeParams& params)
+                     { return std::make_shared<Sequence>(name, params.GetBool("memory")); })
+                .Children(1)
+                .Param("memory", ParamType::BOOL, false);
+            Register("Selector", [](const std::string& name, const NodeParams& params)
+                     { return std::make_shared<Selector>(name, params.GetBool("memory")); })
+                .Children(1)
+                .Param("memory", ParamType::BOOL, false);
+            Register("MemorySequence", [](const std::string& name, const NodeParams&)
+                     { return std::make_shared<MemorySequence>(name); })
+                .Children(1);
+            Register("MemorySelector", [](const std::string& name, const NodeParams&)
+                     { return std::make_shared<MemorySelector>(name); })
+                .Children(1);
+            Register("Parallel", [](const std::string& name, const NodeParams& params)
+                     {
+                         return std::make_shared<Parallel>(
+                             name, ParsePolicy(params.GetString("policy")), params.GetBool("concurrent"));
+                     })
+                .Children(1)
+                .Param("policy", ParamType::STRING, std::string("SUCCEED_ON_ONE"))
+                .Choices({"SUCCEED_ON_ONE", "SUCCEED_ON_ALL", "FAIL_ON_ONE"})
+                .Param("concurrent", ParamType::BOOL, false);
+            Register("Random", [](const std::string& name, const NodeParams&)
+                     { return std::make_shared<Random>(name); })
+                .Children(1);
+            Register("WeightedRandomSelector", [](const std::string& name, const NodeParams& params)
+                     {
+                         std::vector<float> weights;
+                         if (!ParseWeights(params.GetString("weights"), weights))
+                             return std::shared_ptr<WeightedRandomSelector>(); // 잘못된 가중치 목록
+                         return std::make_shared<WeightedRandomSelector>(name, std::move(weights));
+                     })
+                .Children(1)
+                .Param("weights", ParamType::STRING, std::string()); // "3,1,1" (비우면 모두 1)
+
+            Register("Invert", [](const std::string& name, const NodeParams&)
+                     { return std::make_shared<Invert>(name); })
+                .Children(1, 1);
+            Register("Repeat", [](const std::string& name, const NodeParams& params)
+                     { return std::make_shared<Repeat>(name, static_cast<int>(params.GetInt("count"))); })
+                .Children(1, 1)
+                .Param("count", ParamType::INT, int64_t(-1));
+            Register("Delay", [](const std::string& name, const NodeParams& params)
+                     { return std::make_shared<Delay>(name, std::chrono::milliseconds(params.GetInt("ms"))); })
+                .Children(0, 1) // 자식이 없으면 지연 후 성공
+                .Param("ms", ParamType::INT);
+            Register("Timeout", [](const std::string& name, const NodeParams& params)
+                     { return std::make_shared<Timeout>(name, std::chrono::milliseconds(params.GetInt("ms"))); })
+                .Children(1, 1)
+                .Param("ms", ParamType::INT);
+            Register("Cooldown", [](const std::string& name, const NodeParams& params)
+                     { return std::make_shared<Cooldown>(name, std::chrono::milliseconds(params.GetInt("ms"))); })
+                .Children(0, 1) // 자식이 없으면 대기시간마다 한 번 성공
+                .Param("ms", ParamType::INT);
+
+            // 엔진에 등록된 다른 트리 실행 (Engine::RegisterTree/LinkSubTrees가 이름으로 연결)
+            Register("SubTree", [](const std::string& name, const NodeParams& params)
+                     { return std::make_shared<SubTree>(name, params.GetString("tree")); })
+                .Param("tree", ParamType::STRING);
+        }
+
+        static Parallel::Policy ParsePolicy(const std::string& policy)
+        {
+            if (policy == "SUCCEED_ON_ALL")
+                return Parallel::Policy::SUCCEED_ON_ALL;
+            if (policy == "FAIL_ON_ONE")
+                return Parallel::Policy::FAIL_ON_ONE;
+            return Parallel::Policy::SUCCEED_ON_ONE;
+        }
+
+        // 쉼표로 구분한 가중치 목록 (빈 문자열이면 빈 목록)
+        static bool ParseWeights(const std::string& text, std::vector<float>& weights)
+        {
+            const char* cursor = text.c_str();
+            while (*cursor == ' ')
+                ++cursor;
+            if (*cursor == '\0')
+                return true;
+
+            for (;;)
+            {
+                char* end    = nullptr;
+                float weight = std::strtof(cursor, &end);
+                if (end == cursor || weight < 0.0f)
+                    return false;
+                weights.push_back(weight);
+                cursor = end;
+                while (*cursor == ' ')
+                    ++cursor;
+                if (*cursor == '\0')
+                    return true;
+                if (*cursor != ',')
+                    return false;
+                ++cursor;
+            }
+        }
+
+        std::unordered_map<std::string, NodeTypeInfo> types_;
+    };
+
+} // namespace bt
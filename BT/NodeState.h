@@ -0,0 +1,248 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+
+#include "FrameArena.h"
+#include "Node.h"
+#include "Rng.h"
+
+namespace bt
+{
+
+    // 노드 하나의 에이전트별 런타임 상태
+    // 트리 정의(Node)는 불변으로 공유하고, 실행 중 바뀌는 값은 모두 여기에 둔다.
+    struct NodeState
+    {
+        std::chrono::steady_clock::time_point deadline;                          // Delay/Timeout/Cooldown 만료 시각
+        int32_t                               counter     = 0;                   // Repeat 횟수 등 범용 카운터
+        uint32_t                              child_index = 0;                   // 메모리 복합 노드의 실행 중 자식 (컴파일 실행 시 레코드 인덱스)
+        NodeStatus                            last_status = NodeStatus::FAILURE; // 마지막 실행 결과
+        bool                                  is_running  = false;               // RUNNING 여부
+        bool                                  started     = false;               // deadline이 유효한지
+
+        void Reset() { *this = NodeState(); }
+    };
+
+    // 비동기 작업 취소 표시 (작업 쪽에서 주기적으로 확인, 기본 생성된 토큰은 취소되지 않음)
+    class CancelToken
+    {
+    public:
+        CancelToken() = default;
+        explicit CancelToken(std::shared_ptr<std::atomic<bool>> flag) : flag_(std::move(flag)) {}
+
+        bool IsCancelled() const { return flag_ && flag_->load(std::memory_order_relaxed); }
+        void Cancel() const
+        {
+            if (flag_)
+            {
+                flag_->store(true, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        std::shared_ptr<std::atomic<bool>> flag_;
+    };
+
+    // 노드가 에이전트별로 소유하는 런타임 객체 (비동기 작업, 코루틴 프레임 등)
+    // 노드가 끝나거나 Halt될 때, 또는 에이전트의 트리 상태가 초기화될 때 소멸한다.
+    struct NodeResource
+    {
+        virtual ~NodeResource() = default;
+    };
+
+    // 노드 하나가 에이전트를 위해 진행 중인 비동기 작업 (AsyncAction)
+    // 작업이 끝나기 전에 버려지면 취소를 표시한다. future는 소멸 시 대기하지 않는 것(promise/packaged_task)이어야 한다.
+    struct AsyncTask : NodeResource
+    {
+        std::future<NodeStatus> result;
+        CancelToken             token;
+
+        ~AsyncTask() override { token.Cancel(); }
+    };
+
+    // 순수 노드 결과 캐시 키 이름 → 정수 id 전역 등록부 (노드 구성 시에만 호출)
+    class MemoKeyRegistry
+    {
+    public:
+        static uint32_t Intern(const std::string& name)
+        {
+            static std::mutex                                mutex;
+            static std::unordered_map<std::string, uint32_t> ids;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            return ids.emplace(name, static_cast<uint32_t>(ids.size())).first->second;
+        }
+    };
+
+    // 순수 노드의 캐시된 결과 (tick 틱에 계산, version은 계산 시점의 블랙보드 쓰기 버전)
+    struct MemoEntry
+    {
+        uint32_t   tick    = 0;
+        uint32_t   version = 0;
+        NodeStatus status  = NodeStatus::FAILURE;
+    };
+
+    // 에이전트 하나가 트리 하나를 실행하기 위한 상태 블록 (노드 id로 인덱싱)
+    class TreeState
+    {
+    public:
+        // resource: 상태 블록, 결과 캐시, 리소스 목록, 코루틴 프레임 청크를 할당할 곳 (에이전트 아레나 등)
+        explicit TreeState(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : resource_(resource), states_(resource), memos_(resource), resources_(resource)
+        {
+        }
+
+        // 노드 상태 접근 (범위를 벗어나면 확장)
+        NodeState& Get(uint32_t id)
+        {
+            if (id >= states_.size())
+            {
+                states_.resize(id + 1);
+            }
+            return states_[id];
+        }
+
+        // 트리가 바뀌면 상태 블록을 새로 준비
+        void Bind(const void* tree, size_t node_count)
+        {
+            if (tree_ != tree)
+            {
+                tree_   = tree;
+                status_ = NodeStatus::FAILURE;
+                states_.assign(node_count, NodeState());
+                memos_.clear();
+                ReleaseResources();
+            }
+            else if (states_.size() < node_count)
+            {
+                states_.resize(node_count);
+            }
+        }
+
+        // 상태 블록을 유지한 채 소속 트리만 교체 (구조가 같은 새 버전으로 핫 리로드할 때)
+        void Rebind(const void* tree, size_t node_count)
+        {
+            tree_ = tree;
+            if (states_.size() < node_count)
+            {
+                states_.resize(node_count);
+            }
+        }
+
+        // 모든 노드 상태 초기화
+        void ResetNodes()
+        {
+            for (auto& state : states_)
+            {
+                state.Reset();
+            }
+            memos_.clear();
+            ReleaseResources();
+        }
+
+        // 노드별 런타임 객체 (노드 id별, 보통 몇 개뿐이라 선형 탐색, 타입은 소유 노드가 안다)
+        template <typename T>
+        T* FindResource(uint32_t id)
+        {
+            for (auto& [resource_id, resource] : resources_)
+            {
+                if (resource_id == id)
+                    return static_cast<T*>(resource.get());
+            }
+            return nullptr;
+        }
+
+        template <typename T>
+        T& AttachResource(uint32_t id, std::unique_ptr<T> resource)
+        {
+            ReleaseResource(id);
+            T& attached = *resource;
+            resources_.emplace_back(id, std::move(resource));
+            return attached;
+        }
+
+        void ReleaseResource(uint32_t id)
+        {
+            for (size_t i = 0; i < resources_.size(); ++i)
+            {
+                if (resources_[i].first == id)
+                {
+                    // 목록에서 먼저 뺀 뒤 해제 (소멸자가 이 상태에 다시 접근해도 안전하도록)
+                    std::unique_ptr<NodeResource> released = std::move(resources_[i].second);
+                    resources_[i]                          = std::move(resources_.back());
+                    resources_.pop_back();
+                    return;
+                }
+            }
+        }
+
+        size_t GetResourceCount() const { return resources_.size(); }
+
+        // 코루틴 프레임 할당기 (처음 쓸 때 만든다)
+        FrameArena& GetFrameArena()
+        {
+            if (!arena_)
+            {
+                arena_ = std::make_unique<FrameArena>(resource_);
+            }
+            return *arena_;
+        }
+
+        // 순수 노드 결과 캐시 (memo id로 인덱싱, 범위를 벗어나면 확장)
+        MemoEntry& GetMemo(uint32_t memo_id)
+        {
+            if (memo_id >= memos_.size())
+            {
+                memos_.resize(memo_id + 1);
+            }
+            return memos_[memo_id];
+        }
+
+        // 에이전트의 난수 생성기 (트리 교체나 상태 초기화와 무관하게 유지, 재현하려면 Seed로 지정)
+        Rng& GetRng() { return rng_; }
+
+        // 실행 횟수 (Tree::Execute마다 증가, 노드가 직전 틱에도 실행되었는지 판단하는 데 사용)
+        void     BeginTick() { tick_++; }
+        uint32_t GetTick() const { return tick_; }
+
+        // 바깥 트리의 실행 횟수를 따른다 (SubTree의 하위 트리 상태 블록, 같은 틱 안의 재실행/결과 캐시 판단을 맞춘다)
+        void SyncTick(uint32_t tick) { tick_ = tick; }
+
+        // 이 상태가 할당하는 곳 (하위 트리 상태 블록도 같은 아레나에 둔다)
+        std::pmr::memory_resource* GetMemoryResource() const { return resource_; }
+
+        const void* GetTree() const { return tree_; }
+        NodeStatus  GetStatus() const { return status_; }
+        void        SetStatus(NodeStatus status) { status_ = status; }
+        size_t      Size() const { return states_.size(); }
+
+    private:
+        void ReleaseResources()
+        {
+            auto released = std::move(resources_);
+            resources_.clear();
+        }
+
+        std::pmr::memory_resource*  resource_;
+        const void*                 tree_   = nullptr; // 상태가 속한 트리
+        NodeStatus                  status_ = NodeStatus::FAILURE;
+        std::pmr::vector<NodeState> states_;
+        uint32_t                    tick_ = 0;
+        std::pmr::vector<MemoEntry> memos_;
+        Rng                         rng_;
+        std::unique_ptr<FrameArena> arena_; // resources_보다 먼저 선언 (프레임이 먼저 해제되도록)
+        std::pmr::vector<std::pair<uint32_t, std::unique_ptr<NodeResource>>> resources_;
+    };
+
+} // namespace bt
@@ -0,0 +1,312 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <cstdint>
+
+#include <nlohmann/json.hpp>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define BT_PROFILER_HAS_RDTSC 1
+#endif
+
+#include "Node.h"
+
+namespace bt
+{
+
+    // 프로파일러용 저비용 시계 (x86은 TSC 사이클, 그 외에는 steady_clock 나노초)
+    struct CycleClock
+    {
+        static uint64_t Now()
+        {
+#ifdef BT_PROFILER_HAS_RDTSC
+            return __rdtsc();
+#else
+            return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+        }
+    };
+
+    // 노드 하나의 누적 측정값
+    struct NodeProfile
+    {
+        uint64_t calls            = 0;
+        uint64_t status_counts[3] = {0, 0, 0}; // NodeStatus별 횟수 (SUCCESS, FAILURE, RUNNING)
+        uint64_t total_cycles     = 0;         // 자손 포함 시간
+        uint64_t child_cycles     = 0;         // 자식 Tick에 쓴 시간 (self = total - child)
+
+        void Merge(const NodeProfile& other)
+        {
+            calls += other.calls;
+            for (int i = 0; i < 3; ++i)
+            {
+                status_counts[i] += other.status_counts[i];
+            }
+            total_cycles += other.total_cycles;
+            child_cycles += other.child_cycles;
+        }
+    };
+
+    // 트리 하나의 노드별 실행 프로파일러
+    // 측정은 스레드별 버퍼에 잠금 없이 기록하고, 내보낼 때 합친다.
+    // 내보내기/Reset은 이 트리를 실행 중인 스레드가 없을 때(프레임 사이) 호출해야 한다.
+    // BT_DISABLE_PROFILING을 정의하면 Tick의 측정 분기 자체가 컴파일되지 않는다.
+    class Profiler
+    {
+    public:
+        // 노드 id가 부여된 트리의 노드 이름/부모 정보를 수집
+        Profiler(const std::string& tree_name, const Node* root)
+            : tree_name_(tree_name), serial_(NextSerial()), start_cycles_(CycleClock::Now()),
+              start_time_(std::chrono::steady_clock::now())
+        {
+            if (root)
+            {
+                CollectNodes(root, -1);
+            }
+        }
+
+        Profiler(const Profiler&)            = delete;
+        Profiler& operator=(const Profiler&) = delete;
+
+        // node_id 노드의 실행을 측정 (예외가 나면 측정 프레임만 정리하고 다시 던진다)
+        template <typename F>
+        NodeStatus Measure(uint32_t node_id, F&& tick)
+        {
+            ThreadBuffer& buffer = GetThreadBuffer();
+            buffer.stack.push_back({CycleClock::Now(), 0});
+
+            NodeStatus status;
+            try
+            {
+                status = tick();
+            }
+            catch (...)
+            {
+                buffer.stack.pop_back();
+                throw;
+            }
+
+            Frame frame = buffer.stack.back();
+            buffer.stack.pop_back();
+            uint64_t elapsed = CycleClock::Now() - frame.start;
+            if (!buffer.stack.empty())
+            {
+                buffer.stack.back().child_cycles += elapsed;
+            }
+
+            if (node_id >= buffer.nodes.size())
+            {
+                buffer.nodes.resize(node_id + 1);
+            }
+            NodeProfile& profile = buffer.nodes[node_id];
+            profile.calls++;
+            profile.status_counts[static_cast<size_t>(status)]++;
+            profile.total_cycles += elapsed;
+            profile.child_cycles += frame.child_cycles;
+            return status;
+        }
+
+        // 모든 스레드 버퍼를 합친 노드별 측정값 (노드 id로 인덱싱)
+        std::vector<NodeProfile> Collect() const
+        {
+            std::vector<NodeProfile>    merged(nodes_.size());
+            std::lock_guard<std::mutex> lock(buffers_mutex_);
+            for (const auto& buffer : buffers_)
+            {
+                if (buffer->nodes.size() > merged.size())
+                {
+                    merged.resize(buffer->nodes.size());
+                }
+                for (size_t id = 0; id < buffer->nodes.size(); ++id)
+                {
+                    merged[id].Merge(buffer->nodes[id]);
+                }
+            }
+            return merged;
+        }
+
+        void Reset()
+        {
+            std::lock_guard<std::mutex> lock(buffers_mutex_);
+            for (auto& buffer : buffers_)
+            {
+                std::fill(buffer->nodes.begin(), buffer->nodes.end(), NodeProfile());
+            }
+        }
+
+        // 사이클 → 나노초 환산 비율 (프로파일러 생성 이후 경과 시간으로 보정)
+        double GetNanosecondsPerCycle() const
+        {
+#ifdef BT_PROFILER_HAS_RDTSC
+            uint64_t cycles  = CycleClock::Now() - start_cycles_;
+            auto     elapsed = std::chrono::steady_clock::now() - start_time_;
+            double   nanos   = std::chrono::duration<double, std::nano>(elapsed).count();
+            return cycles > 0 && nanos > 0.0 ? nanos / static_cast<double>(cycles) : 1.0;
+#else
+            return 1.0;
+#endif
+        }
+
+        // JSON 내보내기 (시간 단위: 나노초)
+        nlohmann::json ToJson() const
+        {
+            std::vector<NodeProfile> profiles = Collect();
+            double                   ns       = GetNanosecondsPerCycle();
+
+            nlohmann::json nodes = nlohmann::json::array();
+            for (size_t id = 0; id < nodes_.size(); ++id)
+            {
+                const NodeProfile& profile = profiles[id];
+                nodes.push_back({{"id", id},
+                                 {"name", nodes_[id].name},
+                                 {"parent", nodes_[id].parent},
+                                 {"calls", profile.calls},
+                                 {"success", profile.status_counts[0]},
+                                 {"failure", profile.status_counts[1]},
+                                 {"running", profile.status_counts[2]},
+                                 {"total_ns", static_cast<uint64_t>(profile.total_cycles * ns)},
+                                 {"self_ns", static_cast<uint64_t>(SelfCycles(profile) * ns)}});
+            }
+            return {{"tree", tree_name_}, {"nodes", nodes}};
+        }
+
+        // flamegraph.pl 호환 collapsed-stack 내보내기 ("트리;부모;노드 self_ns" 한 줄씩)
+        std::string ToCollapsedStacks() const
+        {
+            std::vector<NodeProfile> profiles = Collect();
+            double                   ns       = GetNanosecondsPerCycle();
+
+            std::ostringstream out;
+            for (size_t id = 0; id < nodes_.size(); ++id)
+            {
+                uint64_t self_ns = static_cast<uint64_t>(SelfCycles(profiles[id]) * ns);
+                if (profiles[id].calls == 0 || self_ns == 0)
+                    continue;
+                out << StackPath(static_cast<int32_t>(id)) << " " << self_ns << "\n";
+            }
+            return out.str();
+        }
+
+        const std::string& GetTreeName() const { return tree_name_; }
+        size_t             GetNodeCount() const { return nodes_.size(); }
+        const std::string& GetNodeName(uint32_t id) const { return nodes_[id].name; }
+
+    private:
+        struct NodeInfo
+        {
+            std::string name;
+            int32_t     parent = -1;
+        };
+
+        struct Frame
+        {
+            uint64_t start;
+            uint64_t child_cycles;
+        };
+
+        struct ThreadBuffer
+        {
+            std::vector<NodeProfile> nodes; // 노드 id로 인덱싱
+            std::vector<Frame>       stack; // 측정 중인 노드 (self 시간 계산용)
+        };
+
+        static uint64_t NextSerial()
+        {
+            static std::atomic<uint64_t> serial{0};
+            return ++serial;
+        }
+
+        // 스레드별 버퍼 (처음 실행하는 스레드만 잠금을 거쳐 등록)
+        ThreadBuffer& GetThreadBuffer()
+        {
+            struct CacheEntry
+            {
+                uint64_t      serial;
+                ThreadBuffer* buffer;
+            };
+            thread_local std::vector<CacheEntry> cache;
+
+            for (const auto& entry : cache)
+            {
+                if (entry.serial == serial_)
+                {
+                    return *entry.buffer;
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(buffers_mutex_);
+            buffers_.push_back(std::make_unique<ThreadBuffer>());
+            buffers_.back()->nodes.resize(nodes_.size());
+            cache.push_back({serial_, buffers_.back().get()});
+            return *buffers_.back();
+        }
+
+        void CollectNodes(const Node* node, int32_t parent)
+        {
+            if (node->GetId() >= nodes_.size())
+            {
+                nodes_.resize(node->GetId() + 1);
+            }
+            nodes_[node->GetId()] = {node->GetName(), parent};
+            for (const auto& child : node->GetChildren())
+            {
+                if (child)
+                {
+                    CollectNodes(child.get(), static_cast<int32_t>(node->GetId()));
+                }
+            }
+        }
+
+        static uint64_t SelfCycles(const NodeProfile& profile)
+        {
+            return profile.total_cycles > profile.child_cycles ? profile.total_cycles - profile.child_cycles : 0;
+        }
+
+        std::string StackPath(int32_t id) const
+        {
+            std::vector<int32_t> path;
+            for (int32_t node = id; node >= 0; node = nodes_[node].parent)
+            {
+                path.push_back(node);
+            }
+
+            std::string stack = FrameName(tree_name_);
+            for (auto it = path.rbegin(); it != path.rend(); ++it)
+            {
+                stack += ';';
+                stack += FrameName(nodes_[*it].name);
+            }
+            return stack;
+        }
+
+        // collapsed-stack 형식의 구분자(';', 공백)를 피한 프레임 이름
+        static std::string FrameName(std::string name)
+        {
+            std::replace(name.begin(), name.end(), ';', '_');
+            std::replace(name.begin(), name.end(), ' ', '_');
+            return name;
+        }
+
+        std::string                                tree_name_;
+        std::vector<NodeInfo>                      nodes_; // 노드 id로 인덱싱
+        uint64_t                                   serial_; // 스레드 캐시 식별자 (주소 재사용과 구분)
+        uint64_t                                   start_cycles_;
+        std::chrono::steady_clock::time_point      start_time_;
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+        mutable std::mutex                         buffers_mutex_;
+    };
+
+} // namespace bt
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+
+#include <cstdint>
+
+namespace bt
+{
+
+    // 에이전트별 의사 난수 생성기 (PCG32, XSH-RR)
+    // 상태 16바이트, 생성당 곱셈 한 번으로 std::mt19937보다 작고 빠르며, 같은 시드면 같은 수열을 낸다.
+    // random_device를 읽지 않으므로 틱 경로에서 시스템 호출이 없고, 시드만 기록하면 AI 결정을 재현할 수 있다.
+    class Rng
+    {
+    public:
+        // 기본 시드는 생성 순서로 정해진다 (에이전트마다 다르되 실행마다 같음, 재현이 필요하면 Seed로 지정)
+        Rng() { Seed(NextDefaultSeed()); }
+        explicit Rng(uint64_t seed, uint64_t stream = 0) { Seed(seed, stream); }
+
+        void Seed(uint64_t seed, uint64_t stream = 0)
+        {
+            seed_  = seed;
+            state_ = 0;
+            inc_   = (stream << 1u) | 1u;
+            Next();
+            state_ += SplitMix(seed);
+            Next();
+        }
+
+        uint64_t GetSeed() const { return seed_; }
+
+        // 현재 위치 저장/복원 (실행 추적 재생용, 복원하면 저장 시점부터 같은 수열이 이어진다)
+        uint64_t GetState() const { return state_; }
+        uint64_t GetIncrement() const { return inc_; }
+        void     Restore(uint64_t state, uint64_t increment)
+        {
+            state_ = state;
+            inc_   = increment | 1u;
+        }
+
+        uint32_t Next()
+        {
+            uint64_t old = state_;
+            state_       = old * 6364136223846793005ULL + inc_;
+            uint32_t xorshifted = static_cast<uint32_t>(((old >> 18u) ^ old) >> 27u);
+            uint32_t rot        = static_cast<uint32_t>(old >> 59u);
+            return (xorshifted >> rot) | (xorshifted << ((32u - rot) & 31u));
+        }
+
+        // [0, bound) 균등 분포 (Lemire 방식, 나눗셈은 드문 거절 구간에서만)
+        uint32_t NextBelow(uint32_t bound)
+        {
+            if (bound == 0)
+                return 0;
+            uint64_t product = static_cast<uint64_t>(Next()) * bound;
+            uint32_t low     = static_cast<uint32_t>(product);
+            if (low < bound)
+            {
+                uint32_t threshold = static_cast<uint32_t>(-bound) % bound;
+                while (low < threshold)
+                {
+                    product = static_cast<uint64_t>(Next()) * bound;
+                    low     = static_cast<uint32_t>(product);
+                }
+            }
+            return static_cast<uint32_t>(product >> 32u);
+        }
+
+        // [0, 1) 균등 분포 (상위 24비트 사용)
+        float NextFloat() { return static_cast<float>(Next() >> 8u) * (1.0f / 16777216.0f); }
+
+        // 시드 분산 (연속된 id를 시드로 써도 수열이 겹치지 않도록)
+        static uint64_t SplitMix(uint64_t x)
+        {
+            x += 0x9E3779B97F4A7C15ULL;
+            x = (x ^ (x >> 30u)) * 0xBF58476D1CE4E5B9ULL;
+            x = (x ^ (x >> 27u)) * 0x94D049BB133111EBULL;
+            return x ^ (x >> 31u);
+        }
+
+    private:
+        static uint64_t NextDefaultSeed()
+        {
+            static std::atomic<uint64_t> counter{0};
+            return SplitMix(counter.fetch_add(1, std::memory_order_relaxed));
+        }
+
+        uint64_t seed_  = 0;
+        uint64_t state_ = 0;
+        uint64_t inc_   = 1;
+    };
+
+} // namespace bt
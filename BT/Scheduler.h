@@ -0,0 +1,324 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <cstdint>
+
+namespace bt
+{
+
+    // 이벤트 기반 에이전트 스케줄러
+    // 대기 중인 에이전트(Delay 등)를 타이머 휠 또는 이벤트 대기 목록에 보관(park)하고,
+    // 깨어날 시각이 되거나 트리가 의존하는 이벤트가 발생했을 때만 다시 틱 대상에 넣는다.
+    class Scheduler
+    {
+    public:
+        using AgentId   = uint32_t;
+        using Clock     = std::chrono::steady_clock;
+        using TimePoint = Clock::time_point;
+
+        explicit Scheduler(std::chrono::milliseconds resolution = std::chrono::milliseconds(16),
+                           size_t                    slot_count = 256)
+            : resolution_(resolution), origin_(Clock::now()), slots_(RoundUpPow2(slot_count))
+        {
+            mask_ = slots_.size() - 1;
+        }
+
+        // 에이전트 등록/해제 (등록 직후에는 틱 대상)
+        void Add(AgentId id)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto&                       agent = agents_[id];
+            if (agent.parked)
+            {
+                agent.parked = false;
+                parked_count_--;
+            }
+            agent.generation = ++generation_counter_;
+            PushActiveLocked(id, agent);
+        }
+
+        void Remove(AgentId id)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto                        it = agents_.find(id);
+            if (it == agents_.end())
+                return;
+            if (it->second.parked)
+            {
+                parked_count_--;
+                DropWaitersLocked(id, it->second);
+            }
+            agents_.erase(it); // 타이머 휠의 항목은 만료 시 세대 비교로 버린다 (세대는 스케줄러 전체에서 유일)
+        }
+
+        // 에이전트 대기: wake_at에 깨우거나 events 중 하나가 발생하면 깨운다
+        // wake_at이 TimePoint::max()이면 이벤트로만 깨운다.
+        void Park(AgentId id, TimePoint wake_at, const std::vector<std::string>& events = {})
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto                        it = agents_.find(id);
+            if (it == agents_.end() || it->second.parked)
+                return;
+
+            // 이미 깨어날 시각이 지났으면 계속 틱 대상으로 둔다
+            uint64_t tick = 0;
+            if (wake_at != TimePoint::max())
+            {
+                tick = ToTick(wake_at);
+                if (origin_ + resolution_ * tick < wake_at)
+                {
+                    tick++; // 올림 (일찍 깨우지 않도록)
+                }
+                if (tick <= current_tick_)
+                    return;
+            }
+            else if (events.empty())
+            {
+                return; // 깨울 방법이 없으면 대기하지 않음
+            }
+
+            AgentEntry& agent = it->second;
+            agent.parked      = true;
+            agent.generation = ++generation_counter_;
+            agent.events = events;
+            parked_count_++;
+
+            if (wake_at != TimePoint::max())
+            {
+                slots_[tick & mask_].push_back({id, agent.generation, tick});
+            }
+            for (const auto& event : events)
+            {
+                waiters_[event].push_back({id, agent.generation, 0});
+            }
+        }
+
+        // 이벤트 발생: 해당 이벤트를 기다리는 모든 에이전트를 깨운다
+        void Notify(const std::string& event)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto                        it = waiters_.find(event);
+            if (it == waiters_.end())
+                return;
+
+            // 깨어난 에이전트가 다른 이벤트 목록에서 자신을 지우므로 이 목록은 먼저 떼어 낸다
+            std::vector<WaitEntry> waiters = std::move(it->second);
+            waiters_.erase(it);
+            for (const auto& waiter : waiters)
+            {
+                WakeLocked(waiter.id, waiter.generation);
+            }
+        }
+
+        // 특정 에이전트에게 이벤트 전달 (에이전트가 그 이벤트에 의존할 때만 깨움)
+        void Notify(AgentId id, const std::string& event)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto                        it = agents_.find(id);
+            if (it == agents_.end() || !it->second.parked)
+                return;
+
+            const auto& events = it->second.events;
+            if (std::find(events.begin(), events.end(), event) != events.end())
+            {
+                WakeLocked(id, it->second.generation);
+            }
+        }
+
+        // 조건 없이 깨우기
+        void Wake(AgentId id)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto                        it = agents_.find(id);
+            if (it != agents_.end())
+            {
+                WakeLocked(id, it->second.generation);
+            }
+        }
+
+        // 타이머 휠을 now까지 진행하고 이번 프레임에 틱할 에이전트 목록을 반환 (등록 순서 유지)
+        // 반환된 참조는 다음 CollectReady 호출 전까지 유효하다.
+        const std::vector<AgentId>& CollectReady(TimePoint now)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            AdvanceLocked(ToTick(now));
+
+            ready_.clear();
+            collect_serial_++;
+            auto out = active_.begin();
+            for (AgentId id : active_)
+            {
+                auto it = agents_.find(id);
+                if (it == agents_.end())
+                    continue; // 제거된 에이전트
+                AgentEntry& agent = it->second;
+                if (agent.parked)
+                {
+                    agent.in_active = false; // 대기 중인 에이전트는 활성 목록에서 뺀다
+                    continue;
+                }
+                if (agent.collect_serial == collect_serial_)
+                    continue; // 제거 후 같은 id로 다시 등록된 경우의 중복
+                agent.collect_serial = collect_serial_;
+                *out++               = id;
+                ready_.push_back(id);
+            }
+            active_.erase(out, active_.end());
+            return ready_;
+        }
+
+        // 통계
+        bool IsParked(AgentId id) const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto                        it = agents_.find(id);
+            return it != agents_.end() && it->second.parked;
+        }
+        size_t GetAgentCount() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return agents_.size();
+        }
+        size_t GetParkedCount() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return parked_count_;
+        }
+        size_t GetWaiterCount() const // 이벤트 대기 목록 항목 수
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            size_t                      count = 0;
+            for (const auto& [event, waiters] : waiters_)
+            {
+                count += waiters.size();
+            }
+            return count;
+        }
+
+    private:
+        struct AgentEntry
+        {
+            bool                     parked         = false;
+            bool                     in_active      = false; // active_에 들어 있는지
+            uint64_t                 generation     = 0;     // 바뀔 때마다 새 값 (오래된 타이머/대기 항목 무효화)
+            uint64_t                 collect_serial = 0;     // 마지막으로 틱 대상에 포함된 CollectReady 회차
+            std::vector<std::string> events;
+        };
+
+        struct WaitEntry
+        {
+            AgentId  id;
+            uint64_t generation;
+            uint64_t tick; // 타이머 항목의 만료 틱
+        };
+
+        static size_t RoundUpPow2(size_t value)
+        {
+            size_t result = 1;
+            while (result < value)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        uint64_t ToTick(TimePoint time) const
+        {
+            if (time <= origin_)
+                return 0;
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(time - origin_);
+            return static_cast<uint64_t>(elapsed / resolution_);
+        }
+
+        // 현재 틱부터 target까지의 슬롯을 순회하며 만료된 에이전트를 깨운다
+        void AdvanceLocked(uint64_t target)
+        {
+            if (target <= current_tick_)
+                return;
+
+            // 한 바퀴 이상 지났으면 모든 슬롯을 한 번만 본다
+            uint64_t steps = std::min<uint64_t>(target - current_tick_, slots_.size());
+            for (uint64_t step = 1; step <= steps; ++step)
+            {
+                auto& slot = slots_[(current_tick_ + step) & mask_];
+                auto  keep = slot.begin();
+                for (const auto& entry : slot)
+                {
+                    if (entry.tick > target)
+                    {
+                        *keep++ = entry; // 다음 바퀴에 만료
+                        continue;
+                    }
+                    WakeLocked(entry.id, entry.generation);
+                }
+                slot.erase(keep, slot.end());
+            }
+            current_tick_ = target;
+        }
+
+        void WakeLocked(AgentId id, uint64_t generation)
+        {
+            auto it = agents_.find(id);
+            if (it == agents_.end() || !it->second.parked || it->second.generation != generation)
+                return;
+
+            DropWaitersLocked(id, it->second);
+            it->second.parked = false;
+            it->second.generation = ++generation_counter_;
+            it->second.events.clear();
+            parked_count_--;
+            PushActiveLocked(id, it->second);
+        }
+
+        // 대기를 끝내는 에이전트의 이벤트 대기 항목 제거 (깨운 경로와 관계없이 목록이 쌓이지 않도록)
+        void DropWaitersLocked(AgentId id, const AgentEntry& agent)
+        {
+            for (const auto& event : agent.events)
+            {
+                auto it = waiters_.find(event);
+                if (it == waiters_.end())
+                    continue;
+                auto& waiters = it->second;
+                waiters.erase(std::remove_if(waiters.begin(),
+                                             waiters.end(),
+                                             [&](const WaitEntry& waiter)
+                                             { return waiter.id == id && waiter.generation == agent.generation; }),
+                              waiters.end());
+                if (waiters.empty())
+                {
+                    waiters_.erase(it);
+                }
+            }
+        }
+
+        void PushActiveLocked(AgentId id, AgentEntry& agent)
+        {
+            if (!agent.in_active)
+            {
+                agent.in_active = true;
+                active_.push_back(id);
+            }
+        }
+
+        std::chrono::milliseconds                               resolution_;
+        TimePoint                                               origin_;
+        uint64_t                                                current_tick_ = 0;
+        std::vector<std::vector<WaitEntry>>                     slots_; // 타이머 휠
+        size_t                                                  mask_ = 0;
+        std::unordered_map<std::string, std::vector<WaitEntry>> waiters_; // 이벤트별 대기 목록
+        std::unordered_map<AgentId, AgentEntry>                 agents_;
+        std::vector<AgentId>                                    active_; // 틱 대상 (등록/깨어난 순서)
+        std::vector<AgentId>                                    ready_;
+        uint64_t                                                collect_serial_     = 0;
+        uint64_t                                                generation_counter_ = 0; // 스케줄러 전체에서 증가
+        size_t                                                  parked_count_       = 0;
+        mutable std::mutex                                      mutex_;
+    };
+
+} // namespace bt
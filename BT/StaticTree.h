@@ -0,0 +1,162 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "Context.h"
+#include "Node.h"
+
+namespace bt
+{
+
+    // 컴파일 타임 트리 구성 DSL
+    // 트리 모양이 타입에 그대로 들어가므로 가상 호출/std::function 없이 전체가 인라인된다.
+    // 정적 노드는 에이전트별 상태를 갖지 않는 반응형(REACTIVE) 노드다: 매 틱 첫 자식부터 평가하며,
+    // 실행 중인 자식에서 재개하거나 Delay 같은 시간 상태가 필요한 부분은 일반 노드로 구성해야 한다.
+    //
+    //   auto root = dsl::Selector(dsl::Sequence(dsl::Condition(has_target), dsl::Action(attack)), dsl::Action(patrol));
+    //   tree->SetRoot(MakeStaticNode("goblin_root", std::move(root)));
+    namespace dsl
+    {
+
+        template <typename F>
+        struct ActionNode
+        {
+            F func;
+
+            NodeStatus Tick(Context& context) { return func(context); }
+        };
+
+        template <typename F>
+        struct ConditionNode
+        {
+            F func;
+
+            NodeStatus Tick(Context& context) { return func(context) ? NodeStatus::SUCCESS : NodeStatus::FAILURE; }
+        };
+
+        // 기존 Node 클래스를 정적 트리의 리프로 사용 (가상 호출 없이 TNode::Execute를 직접 호출)
+        template <typename TNode>
+        struct LeafNode
+        {
+            TNode node;
+
+            NodeStatus Tick(Context& context) { return node.TNode::Execute(context); }
+        };
+
+        template <typename... Children>
+        struct SequenceNode
+        {
+            std::tuple<Children...> children;
+
+            // SUCCESS인 동안 다음 자식으로 진행
+            NodeStatus Tick(Context& context)
+            {
+                NodeStatus status = NodeStatus::SUCCESS;
+                std::apply([&](auto&... child) { (((status = child.Tick(context)) == NodeStatus::SUCCESS) && ...); },
+                           children);
+                return status;
+            }
+        };
+
+        template <typename... Children>
+        struct SelectorNode
+        {
+            std::tuple<Children...> children;
+
+            // FAILURE인 동안 다음 자식으로 진행
+            NodeStatus Tick(Context& context)
+            {
+                NodeStatus status = NodeStatus::FAILURE;
+                std::apply([&](auto&... child) { (((status = child.Tick(context)) == NodeStatus::FAILURE) && ...); },
+                           children);
+                return status;
+            }
+        };
+
+        template <typename Child>
+        struct InvertNode
+        {
+            Child child;
+
+            NodeStatus Tick(Context& context)
+            {
+                switch (child.Tick(context))
+                {
+                    case NodeStatus::SUCCESS:
+                        return NodeStatus::FAILURE;
+                    case NodeStatus::FAILURE:
+                        return NodeStatus::SUCCESS;
+                    default:
+                        return NodeStatus::RUNNING;
+                }
+            }
+        };
+
+        // 구성 함수
+        template <typename F>
+        ActionNode<std::decay_t<F>> Action(F&& func)
+        {
+            return {std::forward<F>(func)};
+        }
+
+        template <typename F>
+        ConditionNode<std::decay_t<F>> Condition(F&& func)
+        {
+            return {std::forward<F>(func)};
+        }
+
+        template <typename TNode, typename... Args>
+        LeafNode<TNode> Leaf(Args&&... args)
+        {
+            return {TNode(std::forward<Args>(args)...)};
+        }
+
+        template <typename... Children>
+        SequenceNode<std::decay_t<Children>...> Sequence(Children&&... children)
+        {
+            static_assert(sizeof...(Children) > 0, "dsl::Sequence에는 자식이 필요합니다");
+            return {std::make_tuple(std::forward<Children>(children)...)};
+        }
+
+        template <typename... Children>
+        SelectorNode<std::decay_t<Children>...> Selector(Children&&... children)
+        {
+            static_assert(sizeof...(Children) > 0, "dsl::Selector에는 자식이 필요합니다");
+            return {std::make_tuple(std::forward<Children>(children)...)};
+        }
+
+        template <typename Child>
+        InvertNode<std::decay_t<Child>> Invert(Child&& child)
+        {
+            return {std::forward<Child>(child)};
+        }
+
+    } // namespace dsl
+
+    // 정적 트리를 일반 트리에 넣기 위한 어댑터 (트리 전체가 불투명 리프 하나로 보인다)
+    template <typename Root>
+    class StaticNode final : public Node
+    {
+    public:
+        StaticNode(const std::string& name, Root root) : Node(name, NodeType::ACTION), root_(std::move(root)) {}
+
+        NodeStatus Execute(Context& context) override { return root_.Tick(context); }
+
+        // 가상 호출 없이 정적 트리를 직접 실행
+        NodeStatus TickStatic(Context& context) { return root_.Tick(context); }
+
+    private:
+        Root root_;
+    };
+
+    template <typename Root>
+    std::shared_ptr<StaticNode<std::decay_t<Root>>> MakeStaticNode(const std::string& name, Root&& root)
+    {
+        return std::make_shared<StaticNode<std::decay_t<Root>>>(name, std::forward<Root>(root));
+    }
+
+} // namespace bt
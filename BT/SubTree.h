@@ -0,0 +1,270 @@
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "BatchNode.h"
+#include "CompiledTree.h"
+#include "Context.h"
+#include "Node.h"
+#include "NodeState.h"
+#include "Tree.h"
+#include "TreeSlot.h"
+
+namespace bt
+{
+
+    // 하위 트리 참조를 연결할 수 없음 (등록되지 않은 트리, 순환 참조)
+    class TreeLinkError : public std::runtime_error
+    {
+    public:
+        explicit TreeLinkError(const std::string& message) : std::runtime_error(message) {}
+    };
+
+    // 엔진에 등록된 다른 트리를 실행하는 노드 (트리 합성)
+    // 참조하는 트리를 그래프에 복사하지 않고 엔진의 TreeSlot을 통해 실행하므로, 여러 트리가 같은 하위 트리를 써도
+    // 노드와 컴파일된 레코드는 한 벌뿐이다 (바깥 트리의 컴파일 결과에는 이 노드의 LEAF 레코드 하나만 남는다).
+    // 하위 트리를 다시 등록하면 이를 쓰는 모든 트리가 다음 틱부터 새 버전을 실행한다 (TreeBinding과 같이 구조가 같으면
+    // 실행 중인 상태를 이어받고, 다르면 처음부터 실행한다).
+    //
+    // 하위 트리의 노드 상태는 에이전트마다 이 노드에 딸린 별도 상태 블록에 두므로 노드 id가 바깥 트리와 겹치지 않는다.
+    // 블랙보드, 난수, 프레임 시각, 스케줄링 힌트는 바깥 틱과 공유한다. 바깥 메모리 Selector의 선점 가드는 하위 트리의
+    // 루트 가드(조건 노드, 또는 조건으로 시작하는 Sequence)로 확인한다.
+    //
+    // 이름으로 만든 참조는 Engine::RegisterTree/LinkSubTrees가 슬롯에 연결하며, 연결되지 않은 참조는 FAILURE.
+    class SubTree : public Node, public IBatchLeaf
+    {
+    public:
+        // 트리 이름으로 참조 (엔진 링커가 연결, 데이터 기반 트리의 "SubTree" 노드)
+        SubTree(const std::string& name, const std::string& tree_name)
+            : Node(name, NodeType::SUBTREE), tree_name_(tree_name)
+        {
+        }
+
+        // 엔진 슬롯에 바로 연결 (Engine::CreateSubTree)
+        SubTree(const std::string& name, std::shared_ptr<TreeSlot> slot)
+            : Node(name, NodeType::SUBTREE), tree_name_(slot ? slot->GetName() : std::string()), slot_(std::move(slot))
+        {
+        }
+
+        const std::string&               GetTreeName() const { return tree_name_; }
+        const std::shared_ptr<TreeSlot>& GetSlot() const { return slot_; }
+        bool                             IsLinked() const { return slot_ != nullptr; }
+
+        // 링커 전용 (이 노드가 속한 트리를 실행 중인 스레드가 없을 때 호출)
+        void Link(std::shared_ptr<TreeSlot> slot) { slot_ = std::move(slot); }
+
+        NodeStatus Execute(Context& context) override
+        {
+            TreeState* outer = nullptr;
+            Tree*      tree  = Enter(context, outer);
+            NodeStatus status = tree ? tree->ExecuteNested(context) : NodeStatus::FAILURE;
+            Leave(context, outer);
+            return status;
+        }
+
+        // 같은 버전의 하위 트리를 실행하는 에이전트를 모아 한 번에 실행
+        // (핫 리로드 직후처럼 버전이 섞이면 나머지는 한 명씩)
+        void ExecuteBatch(Context* const* contexts, const uint32_t* slots, size_t count, NodeStatus* statuses) override
+        {
+            RunBatch(contexts,
+                     slots,
+                     count,
+                     statuses,
+                     [](Tree& tree, Context& context) { return tree.ExecuteNested(context); },
+                     [](Tree& tree, Context* const* batch, size_t size, NodeStatus* results, auto& scratch)
+                     { tree.ExecuteNestedBatch(batch, size, results, scratch); });
+        }
+
+        bool PassesGuard(Context& context) override
+        {
+            TreeState* outer  = nullptr;
+            Tree*      tree   = Enter(context, outer);
+            bool       passed = tree && tree->NestedGuardPasses(context);
+            Leave(context, outer);
+            return passed;
+        }
+
+        void PassesGuardBatch(Context* const* contexts,
+                              const uint32_t* slots,
+                              size_t          count,
+                              NodeStatus*     statuses) override
+        {
+            RunBatch(contexts,
+                     slots,
+                     count,
+                     statuses,
+                     [](Tree& tree, Context& context)
+                     { return tree.NestedGuardPasses(context) ? NodeStatus::SUCCESS : NodeStatus::FAILURE; },
+                     [](Tree& tree, Context* const* batch, size_t size, NodeStatus* results, auto& scratch)
+                     { tree.NestedGuardPassesBatch(batch, size, results, scratch); });
+        }
+
+        // 실행 중인 하위 트리 경로 중단 (상태 블록은 다음 실행을 위해 남겨 둔다)
+        void Halt(Context& context) override
+        {
+            Frame* frame = context.GetTreeState().FindResource<Frame>(id_);
+            if (!frame || !frame->binding.GetTree())
+                return;
+
+            TreeState* outer = context.EnterTreeState(&frame->state);
+            frame->binding.GetTree()->Halt(context);
+            context.LeaveTreeState(outer);
+        }
+
+        // root 아래의 SubTree 노드 (링커가 참조를 찾을 때 사용)
+        static void Collect(Node* node, std::vector<SubTree*>& out)
+        {
+            if (!node)
+                return;
+            if (node->GetType() == NodeType::SUBTREE)
+            {
+                if (auto* subtree = dynamic_cast<SubTree*>(node))
+                {
+                    out.push_back(subtree);
+                }
+            }
+            for (const auto& child : node->GetChildren())
+            {
+                Collect(child.get(), out);
+            }
+        }
+
+    private:
+        // 에이전트별 하위 트리 실행 상태 (바깥 상태 블록에 이 노드의 리소스로 붙는다, 바깥 상태가 초기화되면 함께 해제)
+        struct Frame : NodeResource
+        {
+            Frame(std::pmr::memory_resource* resource, std::shared_ptr<TreeSlot> slot)
+                : state(resource), binding(std::move(slot))
+            {
+            }
+
+            TreeState   state;
+            TreeBinding binding; // 에이전트가 실행 중인 하위 트리 버전
+        };
+
+        // 배치 실행 작업 공간 (스레드별, 하위 트리 안의 SubTree가 다시 배치 실행할 수 있으므로 중첩 깊이마다 하나)
+        struct BatchFrame
+        {
+            std::vector<Context*>      contexts;
+            std::vector<uint32_t>      slots;
+            std::vector<TreeState*>    outers;
+            std::vector<NodeStatus>    statuses;
+            CompiledTree::BatchScratch scratch;
+        };
+
+        static std::vector<std::unique_ptr<BatchFrame>>& BatchFrames()
+        {
+            static thread_local std::vector<std::unique_ptr<BatchFrame>> frames;
+            return frames;
+        }
+        static size_t& BatchDepth()
+        {
+            static thread_local size_t depth = 0;
+            return depth;
+        }
+        static BatchFrame& AcquireBatchFrame()
+        {
+            auto&   frames = BatchFrames();
+            size_t& depth  = BatchDepth();
+            if (frames.size() <= depth)
+            {
+                frames.push_back(std::make_unique<BatchFrame>());
+            }
+            return *frames[depth++];
+        }
+        static void ReleaseBatchFrame() { BatchDepth()--; }
+
+        // 이 에이전트의 하위 트리 상태 블록으로 전환하고 실행할 트리 버전을 가져온다 (연결되지 않았으면 nullptr)
+        // 반환값과 관계없이 Leave(context, outer)로 되돌린다.
+        Tree* Enter(Context& context, TreeState*& outer)
+        {
+            outer = nullptr;
+            if (!slot_)
+                return nullptr;
+
+            TreeState& state = context.GetTreeState();
+            Frame*     frame = state.FindResource<Frame>(id_);
+            if (!frame)
+            {
+                frame = &state.AttachResource(id_, std::make_unique<Frame>(state.GetMemoryResource(), slot_));
+            }
+            else if (frame->binding.GetSlot() != slot_)
+            {
+                frame->binding.Bind(slot_); // 바깥 트리가 다른 참조로 교체됨
+            }
+            frame->state.SyncTick(state.GetTick());
+
+            outer = context.EnterTreeState(&frame->state);
+            return frame->binding.Acquire(context).get();
+        }
+
+        void Leave(Context& context, TreeState* outer) const
+        {
+            if (slot_)
+            {
+                context.LeaveTreeState(outer);
+            }
+        }
+
+        // 에이전트마다 하위 트리 상태로 전환한 뒤, 첫 에이전트와 같은 버전을 실행하는 에이전트는 run_batch로 한 번에,
+        // 나머지는 run_single로 실행하고 되돌린다 (연결되지 않았으면 FAILURE)
+        template <typename Single, typename Batched>
+        void RunBatch(Context* const* contexts,
+                      const uint32_t* slots,
+                      size_t          count,
+                      NodeStatus*     statuses,
+                      Single&&        run_single,
+                      Batched&&       run_batch)
+        {
+            BatchFrame& batch = AcquireBatchFrame();
+            batch.contexts.clear();
+            batch.slots.clear();
+            batch.outers.clear();
+
+            Tree* batch_tree = nullptr;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint32_t slot    = slots[i];
+                Context&       context = *contexts[slot];
+                TreeState*     outer   = nullptr;
+                Tree*          tree    = Enter(context, outer);
+                if (tree && !batch_tree)
+                {
+                    batch_tree = tree;
+                }
+                if (!tree || tree != batch_tree)
+                {
+                    statuses[slot] = tree ? run_single(*tree, context) : NodeStatus::FAILURE;
+                    Leave(context, outer);
+                    continue;
+                }
+                batch.contexts.push_back(&context);
+                batch.slots.push_back(slot);
+                batch.outers.push_back(outer);
+            }
+
+            if (batch_tree)
+            {
+                batch.statuses.resize(batch.contexts.size());
+                run_batch(
+                    *batch_tree, batch.contexts.data(), batch.contexts.size(), batch.statuses.data(), batch.scratch);
+            }
+            for (size_t i = 0; i < batch.contexts.size(); ++i)
+            {
+                statuses[batch.slots[i]] = batch.statuses[i];
+                Leave(*batch.contexts[i], batch.outers[i]);
+            }
+            ReleaseBatchFrame();
+        }
+
+        std::string               tree_name_;
+        std::shared_ptr<TreeSlot> slot_;
+    };
+
+} // namespace bt
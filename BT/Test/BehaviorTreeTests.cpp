@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <thread>
@@ -6,6 +7,10 @@
 
 #include "BehaviorTreeTests.h"
 
+#ifdef BT_TEST_SPATIAL_GRID
+#include "../../server/World/SpatialGrid.h"
+#endif
+
 namespace bt
 {
     namespace test
@@ -35,8 +40,73 @@ namespace bt
             results.push_back(TestContextManagement());
             results.push_back(TestEngineRegistration());
             results.push_back(TestBlackboardFunctionality());
+            results.push_back(TestTypedBlackboard());
+            results.push_back(TestLayeredBlackboard());
             results.push_back(TestEnvironmentInfoFunctionality());
 
+            // 컴파일된 트리 테스트
+            results.push_back(TestCompiledTree());
+
+            // 트리 공유 테스트
+            results.push_back(TestSharedTreeState());
+
+            // 템플릿 노드/정적 트리 테스트
+            results.push_back(TestStaticTree());
+
+            // 노드 프로파일러 테스트
+            results.push_back(TestProfiler());
+
+            // 데이터 기반 트리 로딩 테스트
+            results.push_back(TestTreeLoader());
+
+            // 트리 핫 리로드 테스트
+            results.push_back(TestHotReload());
+
+            // 메모리 실행 모드 테스트
+            results.push_back(TestMemoryExecution());
+
+            // 이벤트 기반 스케줄링 테스트
+            results.push_back(TestEventScheduling());
+
+            // 병렬 배치 틱 테스트
+            results.push_back(TestParallelTickAll());
+
+            // 동시 실행 Parallel/비동기 리프 테스트
+            results.push_back(TestAsyncParallel());
+
+            // 코루틴 Action 테스트
+            results.push_back(TestCoroutineAction());
+
+            // 실행 중 경로 중단 테스트
+            results.push_back(TestHaltPropagation());
+
+            // 순수 조건 결과 캐시 테스트
+            results.push_back(TestConditionMemo());
+
+            // 타입 지정 에이전트 참조 테스트
+            results.push_back(TestTypedAgent());
+
+            // 시드 난수 / 가중치 / 유틸리티 Selector 테스트
+            results.push_back(TestSeededSelectors());
+
+            // 프레임 시각 기반 Delay/Timeout/Cooldown 테스트
+            results.push_back(TestTimeDecorators());
+
+            // 에이전트 아레나 테스트
+            results.push_back(TestAgentArena());
+
+            // 배치 실행 테스트
+            results.push_back(TestBatchExecution());
+
+            // 실행 추적 기록/재생 테스트
+            results.push_back(TestTraceReplay());
+
+            // 하위 트리 참조 테스트
+            results.push_back(TestSubTree());
+
+            // 공간 격자 테스트
+            results.push_back(TestSpatialGrid());
+
             return results;
         }
 
@@ -504,6 +574,69 @@ namespace bt
                 if (!AssertEqual("등록 해제 후 트리 수", 1, static_cast<int>(engine.GetRegisteredTrees())))
                     return TestResult("TestEngineRegistration", false, "등록 해제 후 트리 수 실패");
 
+                // TreeId 핸들: 이름당 고정, 해제 후 조회는 실패하고 재등록하면 같은 id
+                TreeId id1 = engine.GetTreeId("tree1");
+                TreeId id2 = engine.GetTreeId("tree2");
+                if (!AssertTrue("해제된 이름의 id", id1 == kInvalidTreeId) ||
+                    !AssertTrue("등록된 이름의 id", engine.GetTree(id2) == tree2))
+                    return TestResult("TestEngineRegistration", false, "TreeId 조회 실패");
+
+                engine.RegisterTree("tree1", tree1);
+                id1 = engine.GetTreeId("tree1");
+                if (!AssertEqual("재등록 id", 0, static_cast<int>(id1)) ||
+                    !AssertEqual("id로 실행", NodeStatus::SUCCESS, engine.ExecuteTree(id1, context)) ||
+                    !AssertEqual("잘못된 id로 실행", NodeStatus::FAILURE, engine.ExecuteTree(kInvalidTreeId, context)))
+                    return TestResult("TestEngineRegistration", false, "TreeId 재등록 실패");
+
+                // 등록/교체가 진행되는 동안 다른 스레드가 id로 조회 (락 없는 스냅샷 읽기)
+                tree2->SetRoot(std::make_shared<TestSuccessAction>("engine_test_action2"));
+                std::atomic<bool> stop{false};
+                std::atomic<int>  missing{0};
+                std::thread       reader(
+                    [&]()
+                    {
+                        Context reader_context;
+                        while (!stop.load())
+                        {
+                            if (engine.ExecuteTree(id2, reader_context) != NodeStatus::SUCCESS)
+                                missing++;
+                        }
+                    });
+                for (int i = 0; i < 200; ++i)
+                {
+                    engine.RegisterTree("extra_" + std::to_string(i), CreateSimpleTree());
+                    auto replacement = std::make_shared<Tree>("test_tree_2");
+                    replacement->SetRoot(std::make_shared<TestSuccessAction>("engine_test_action2"));
+                    engine.RegisterTree("tree2", replacement);
+                }
+                stop.store(true);
+                reader.join();
+                if (!AssertEqual("동시 조회 실패 수", 0, missing.load()) ||
+                    !AssertEqual("동시 등록 후 트리 수", 202, static_cast<int>(engine.GetRegisteredTrees())) ||
+                    !AssertTrue("id 유지", engine.GetTreeId("tree2") == id2))
+                    return TestResult("TestEngineRegistration", false, "동시 조회 실패");
+
+                // id 실행은 context에 버전을 캐시하므로 교체된 버전도 다음 실행에서 따라간다
+                auto failing = std::make_shared<Tree>("test_tree_2");
+                failing->SetRoot(std::make_shared<TestFailureAction>("engine_test_fail"));
+                if (!AssertEqual("교체 전 실행", NodeStatus::SUCCESS, engine.ExecuteTree(id2, context)) ||
+                    !AssertTrue("실행 트리 캐시", context.GetTreeCache().tree == engine.GetTree(id2)))
+                    return TestResult("TestEngineRegistration", false, "트리 캐시 실패");
+                engine.RegisterTree("tree2", failing);
+                if (!AssertEqual("교체 후 실행", NodeStatus::FAILURE, engine.ExecuteTree(id2, context)) ||
+                    !AssertTrue("캐시 갱신", context.GetTreeCache().tree == failing))
+                    return TestResult("TestEngineRegistration", false, "트리 캐시 갱신 실패");
+
+                // 이름 등록/해제로 쌓인 스냅샷은 ReclaimTables로 현재 것만 남긴다 (같은 이름 교체는 쌓이지 않음)
+                const size_t retained = engine.GetRetainedTables();
+                engine.RegisterTree("tree2", CreateSimpleTree());
+                if (!AssertEqual("교체는 스냅샷을 늘리지 않음", retained, engine.GetRetainedTables()) ||
+                    !AssertEqual("해제한 스냅샷 수", retained - 1, engine.ReclaimTables()) ||
+                    !AssertEqual("남은 스냅샷", size_t(1), engine.GetRetainedTables()) ||
+                    !AssertTrue("해제 후 조회", engine.GetTreeId("extra_199") != kInvalidTreeId) ||
+                    !AssertEqual("해제 후 트리 수", 202, static_cast<int>(engine.GetRegisteredTrees())))
+                    return TestResult("TestEngineRegistration", false, "스냅샷 해제 실패");
+
                 std::cout << "  ✓ Engine 등록 테스트 통과\n";
                 return TestResult("TestEngineRegistration", true);
             }
@@ -746,6 +879,157 @@ namespace bt
             }
         }
 
+        TestResult BehaviorTreeTestSuite::TestTypedBlackboard()
+        {
+            std::cout << "테스트: 타입 키 Blackboard\n";
+
+            try
+            {
+                struct Vec3
+                {
+                    float x, y, z;
+                };
+
+                // 같은 이름은 같은 슬롯 id로 등록
+                BlackboardKey<int>         hp_key("typed_hp");
+                BlackboardKey<int>         hp_key_again("typed_hp");
+                BlackboardKey<Vec3>        target_key("typed_target");
+                BlackboardKey<std::string> name_key("typed_name");
+                if (!AssertEqual("키 id 공유", static_cast<int>(hp_key.GetId()), static_cast<int>(hp_key_again.GetId())) ||
+                    !AssertEqual("키 이름", std::string("typed_hp"), hp_key.GetName()))
+                    return TestResult("TestTypedBlackboard", false, "키 등록 실패");
+
+                if (!AssertTrue("int 인라인 저장", Blackboard::IsInline<int>) ||
+                    !AssertTrue("Vec3 인라인 저장", Blackboard::IsInline<Vec3>) ||
+                    !AssertFalse("string 인라인 저장", Blackboard::IsInline<std::string>))
+                    return TestResult("TestTypedBlackboard", false, "인라인 판정 오류");
+
+                Blackboard bb;
+                if (!AssertEqual("없는 키 기본값", -1, bb.Get(hp_key, -1)) || !AssertTrue("없는 키 포인터", !bb.GetPtr(hp_key)))
+                    return TestResult("TestTypedBlackboard", false, "빈 슬롯 조회 오류");
+
+                bb.Set(hp_key, 75);
+                bb.Set(target_key, Vec3{1.0f, 2.0f, 3.0f});
+                bb.Set(name_key, std::string("goblin"));
+                const Vec3* target = bb.GetPtr(target_key);
+                if (!AssertEqual("타입 키 int", 75, bb.Get(hp_key)) || !AssertTrue("타입 키 Vec3", target != nullptr) ||
+                    !AssertEqual("Vec3 값", 3.0f, target ? target->z : 0.0f) ||
+                    !AssertEqual("타입 키 string", std::string("goblin"), bb.Get(name_key)) ||
+                    !AssertEqual("개수", size_t(3), bb.Size()))
+                    return TestResult("TestTypedBlackboard", false, "타입 키 조회 실패");
+
+                // 문자열 API와 같은 슬롯을 공유
+                if (!AssertEqual("문자열로 읽기", 75, bb.GetDataAs<int>("typed_hp")) ||
+                    !AssertEqual("any로 읽기", 75, std::any_cast<int>(bb.GetData("typed_hp"))) ||
+                    !AssertEqual("문자열 타입 불일치", 0.0f, bb.GetDataAs<float>("typed_hp")))
+                    return TestResult("TestTypedBlackboard", false, "문자열 호환 계층 실패");
+
+                bb.SetData("typed_hp", std::any(30));
+                bb.SetData("typed_name", std::string("orc"));
+                if (!AssertEqual("any 저장값 타입 키로 읽기", 30, bb.Get(hp_key)) ||
+                    !AssertEqual("문자열 저장값 타입 키로 읽기", std::string("orc"), bb.Get(name_key)) ||
+                    !AssertEqual("덮어쓴 뒤 개수", size_t(3), bb.Size()))
+                    return TestResult("TestTypedBlackboard", false, "문자열 API 저장값 조회 실패");
+
+                // 다른 타입 키로 읽으면 기본값
+                BlackboardKey<float> hp_as_float("typed_hp");
+                if (!AssertEqual("타입 불일치 기본값", 0.5f, bb.Get(hp_as_float, 0.5f)))
+                    return TestResult("TestTypedBlackboard", false, "타입 불일치 처리 오류");
+
+                // 복사는 독립적인 값
+                Blackboard copy = bb;
+                copy.Set(hp_key, 1);
+                bb.Remove(target_key);
+                if (!AssertEqual("원본 유지", 30, bb.Get(hp_key)) || !AssertEqual("복사본 값", 1, copy.Get(hp_key)) ||
+                    !AssertTrue("복사본 Vec3 유지", copy.Has(target_key)) || !AssertFalse("삭제", bb.Has(target_key)) ||
+                    !AssertEqual("삭제 후 개수", size_t(2), bb.Size()))
+                    return TestResult("TestTypedBlackboard", false, "복사/삭제 오류");
+
+                // Context 위임
+                Context context;
+                context.Set(hp_key, 9);
+                if (!AssertEqual("Context 타입 키", 9, context.Get(hp_key)) ||
+                    !AssertEqual("Context 문자열 키", 9, context.GetDataAs<int>("typed_hp")))
+                    return TestResult("TestTypedBlackboard", false, "Context 위임 실패");
+
+                std::cout << "  ✓ 타입 키 Blackboard 테스트 통과\n";
+                return TestResult("TestTypedBlackboard", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestTypedBlackboard", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestLayeredBlackboard()
+        {
+            std::cout << "테스트: 계층형 Blackboard\n";
+
+            try
+            {
+                BlackboardKey<float>       speed_key("layered_speed");
+                BlackboardKey<int>         squad_target_key("layered_squad_target");
+                BlackboardKey<std::string> role_key("layered_role");
+
+                // 설정(타입별) → 분대 → 에이전트 계층
+                auto config = std::make_shared<Blackboard>();
+                config->Set(speed_key, 2.0f);
+                config->Set(role_key, std::string("melee"));
+                auto squad = std::make_shared<Blackboard>(config);
+                squad->Set(squad_target_key, 42);
+
+                Context agent_a;
+                Context agent_b;
+                agent_a.SetSharedBlackboard(squad);
+                agent_b.SetSharedBlackboard(squad);
+                if (!AssertEqual("설정 계층 조회", 2.0f, agent_a.Get(speed_key)) ||
+                    !AssertEqual("분대 계층 조회", 42, agent_a.Get(squad_target_key)) ||
+                    !AssertEqual("문자열 API 조회", std::string("melee"), agent_a.GetDataAs<std::string>("layered_role")) ||
+                    !AssertTrue("HasData 계층 조회", agent_a.HasData("layered_speed")) ||
+                    !AssertTrue("공유 계층 연결", agent_a.GetSharedBlackboard() == squad) ||
+                    !AssertEqual("빈 에이전트 계층", size_t(0), agent_a.GetDataSize()))
+                    return TestResult("TestLayeredBlackboard", false, "계층 조회 실패");
+
+                // 쓰기는 에이전트 계층에만 (부모 값을 가림)
+                agent_a.Set(speed_key, 3.5f);
+                if (!AssertEqual("가린 값", 3.5f, agent_a.Get(speed_key)) ||
+                    !AssertEqual("다른 에이전트 유지", 2.0f, agent_b.Get(speed_key)) ||
+                    !AssertEqual("설정 계층 유지", 2.0f, config->Get(speed_key)) ||
+                    !AssertTrue("로컬 보유", agent_a.GetBlackboard().HasLocal(speed_key)) ||
+                    !AssertEqual("달라진 값만 저장", size_t(1), agent_a.GetDataSize()))
+                    return TestResult("TestLayeredBlackboard", false, "copy-on-write 쓰기 실패");
+
+                // 로컬 값을 지우면 부모 값이 다시 보임
+                agent_a.RemoveData("layered_speed");
+                if (!AssertEqual("삭제 후 부모 값", 2.0f, agent_a.Get(speed_key)) ||
+                    !AssertEqual("삭제 후 개수", size_t(0), agent_a.GetDataSize()))
+                    return TestResult("TestLayeredBlackboard", false, "로컬 삭제 실패");
+
+                // 가장 가까운 계층이 결정 (타입이 다르면 부모로 넘어가지 않음)
+                agent_b.SetData("layered_squad_target", std::string("boss"));
+                if (!AssertEqual("타입 다른 로컬 값", -1, agent_b.Get(squad_target_key, -1)))
+                    return TestResult("TestLayeredBlackboard", false, "계층 타입 처리 오류");
+
+                // 설정 교체는 복사본을 고쳐 새로 연결 (기존 스냅샷은 그대로)
+                auto new_config = std::make_shared<Blackboard>(*config);
+                new_config->Set(speed_key, 4.0f);
+                auto new_squad = std::make_shared<Blackboard>(*squad);
+                new_squad->SetParent(new_config);
+                agent_a.SetSharedBlackboard(new_squad);
+                if (!AssertEqual("새 설정 조회", 4.0f, agent_a.Get(speed_key)) ||
+                    !AssertEqual("분대 값 유지", 42, agent_a.Get(squad_target_key)) ||
+                    !AssertEqual("기존 스냅샷 유지", 2.0f, agent_b.Get(speed_key)))
+                    return TestResult("TestLayeredBlackboard", false, "설정 교체 실패");
+
+                std::cout << "  ✓ 계층형 Blackboard 테스트 통과\n";
+                return TestResult("TestLayeredBlackboard", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestLayeredBlackboard", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
         TestResult BehaviorTreeTestSuite::TestEnvironmentInfoFunctionality()
         {
             std::cout << "테스트: EnvironmentInfo 기능\n";
@@ -859,12 +1143,2576 @@ namespace bt
             }
         }
 
-        // 메인 테스트 실행 함수
-        void RunBehaviorTreeTests()
+        TestResult BehaviorTreeTestSuite::TestCompiledTree()
         {
-            BehaviorTreeTestSuite test_suite;
-            auto                  results = test_suite.RunAllTests();
-            test_suite.PrintTestResults(results);
+            std::cout << "테스트: 컴파일된 트리\n";
+
+            try
+            {
+                // 동일한 구조의 트리를 두 벌 만들어 그래프 실행과 컴파일 실행 결과를 비교
+                auto build = [](const std::string& name)
+                {
+                    auto tree = std::make_shared<Tree>(name);
+                    auto root = std::make_shared<Selector>("root");
+
+                    auto attack = std::make_shared<Sequence>("attack");
+                    attack->AddChild(std::make_shared<TestHasTargetCondition>("has_target"));
+                    attack->AddChild(std::make_shared<TestInRangeCondition>("in_range", 5.0f));
+                    attack->AddChild(std::make_shared<TestAttackAction>("attack"));
+
+                    auto move = std::make_shared<Sequence>("move");
+                    move->AddChild(std::make_shared<TestHasTargetCondition>("has_target2"));
+                    auto invert = std::make_shared<Invert>("not_in_range");
+                    invert->AddChild(std::make_shared<TestInRangeCondition>("in_range2", 5.0f));
+                    move->AddChild(invert);
+                    auto repeat = std::make_shared<Repeat>("repeat_move", 2);
+                    repeat->AddChild(std::make_shared<TestMoveAction>("move_to_target", 2));
+                    move->AddChild(repeat);
+
+                    auto parallel = std::make_shared<Parallel>("idle", Parallel::Policy::SUCCEED_ON_ALL);
+                    parallel->AddChild(std::make_shared<TestSuccessAction>("look_around"));
+                    parallel->AddChild(std::make_shared<TestRunningAction>("wait", 2));
+
+                    root->AddChild(attack);
+                    root->AddChild(move);
+                    root->AddChild(parallel);
+                    tree->SetRoot(root);
+                    return tree;
+                };
+
+                auto graph_tree    = build("graph_tree");
+                auto compiled_tree = build("compiled_tree");
+                auto compiled      = compiled_tree->Compile();
+
+                if (!AssertTrue("컴파일 여부", compiled_tree->IsCompiled()))
+                    return TestResult("TestCompiledTree", false, "컴파일 실패");
+
+                if (!AssertEqual("노드 수", size_t(14), compiled->GetNodeCount()))
+                    return TestResult("TestCompiledTree", false, "노드 수 불일치");
+
+                if (!AssertEqual("리프 수", size_t(8), compiled->GetLeafCount()))
+                    return TestResult("TestCompiledTree", false, "리프 수 불일치");
+
+                // 전위 순서 및 서브트리 범위 확인
+                const auto& nodes = compiled->GetNodes();
+                if (!AssertTrue("루트 서브트리 범위", nodes[0].subtree_end == nodes.size()) ||
+                    !AssertTrue("루트 타입", nodes[0].op == OpCode::SELECTOR) ||
+                    !AssertTrue("첫 자식 서브트리 범위", nodes[1].subtree_end == 5))
+                    return TestResult("TestCompiledTree", false, "평탄화 구조 불일치");
+
+                auto    graph_ai    = CreateMockAI("GraphAI");
+                auto    compiled_ai = CreateMockAI("CompiledAI");
+                Context graph_context;
+                Context compiled_context;
+                graph_context.SetAI(graph_ai);
+                compiled_context.SetAI(compiled_ai);
+
+                // 상황을 바꿔가며 두 실행 결과가 같은지 확인
+                for (int tick = 0; tick < 24; ++tick)
+                {
+                    bool     has_target = (tick / 6) % 2 == 0;
+                    float    distance   = (tick % 3 == 0) ? 3.0f : 10.0f;
+                    uint32_t target     = has_target ? 7 : 0;
+
+                    for (auto& ai : {graph_ai, compiled_ai})
+                    {
+                        ai->SetTarget(target);
+                        ai->SetDistanceToTarget(distance);
+                    }
+
+                    NodeStatus graph_status    = graph_tree->Execute(graph_context);
+                    NodeStatus compiled_status = compiled_tree->Execute(compiled_context);
+                    if (!AssertEqual("틱 " + std::to_string(tick) + " 결과", graph_status, compiled_status))
+                        return TestResult("TestCompiledTree", false, "그래프/컴파일 실행 결과 불일치");
+                }
+
+                if (!AssertEqual("액션 실행 횟수", graph_ai->action_count_.load(), compiled_ai->action_count_.load()))
+                    return TestResult("TestCompiledTree", false, "액션 실행 횟수 불일치");
+
+                if (!AssertEqual(
+                        "조건 실행 횟수", graph_ai->condition_count_.load(), compiled_ai->condition_count_.load()))
+                    return TestResult("TestCompiledTree", false, "조건 실행 횟수 불일치");
+
+                // 그래프 변경 시 컴파일 결과 무효화
+                compiled_tree->SetRoot(std::make_shared<TestSuccessAction>("new_root"));
+                if (!AssertFalse("SetRoot 후 컴파일 무효화", compiled_tree->IsCompiled()))
+                    return TestResult("TestCompiledTree", false, "컴파일 무효화 실패");
+
+                std::cout << "  ✓ 컴파일된 트리 테스트 통과\n";
+                return TestResult("TestCompiledTree", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestCompiledTree", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestSharedTreeState()
+        {
+            std::cout << "테스트: 공유 트리의 에이전트별 상태\n";
+
+            try
+            {
+                for (bool compiled : {false, true})
+                {
+                    const std::string mode = compiled ? "컴파일 " : "그래프 ";
+
+                    // 하나의 트리를 두 에이전트가 공유
+                    auto tree   = std::make_shared<Tree>("shared_tree");
+                    auto root   = std::make_shared<Parallel>("root", Parallel::Policy::SUCCEED_ON_ALL);
+                    auto repeat = std::make_shared<Repeat>("repeat", 3);
+                    auto delay  = std::make_shared<Delay>("wait", std::chrono::milliseconds(30));
+                    repeat->AddChild(std::make_shared<TestSuccessAction>("step"));
+                    root->AddChild(repeat);
+                    root->AddChild(delay);
+                    tree->SetRoot(root);
+                    if (compiled)
+                    {
+                        tree->Compile();
+                    }
+
+                    if (!AssertEqual(mode + "노드 수", size_t(4), tree->GetNodeCount()) ||
+                        !AssertEqual(mode + "Delay id", 3, static_cast<int>(delay->GetId())))
+                        return TestResult("TestSharedTreeState", false, "노드 id 불일치");
+
+                    Context agent_a;
+                    Context agent_b;
+                    agent_a.SetAI(CreateMockAI("AgentA"));
+                    agent_b.SetAI(CreateMockAI("AgentB"));
+
+                    // A가 먼저 시작하고 Delay가 만료될 만큼 기다린 뒤 B 시작
+                    tree->Execute(agent_a);
+                    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+
+                    if (!AssertEqual(mode + "B 첫 실행", NodeStatus::RUNNING, tree->Execute(agent_b)))
+                        return TestResult("TestSharedTreeState", false, "B 첫 실행 실패");
+
+                    // A의 두 번째 실행: A의 Delay만 만료되어야 함
+                    tree->Execute(agent_a);
+
+                    const NodeState& a_delay = agent_a.GetNodeState(delay->GetId());
+                    const NodeState& b_delay = agent_b.GetNodeState(delay->GetId());
+                    if (!AssertEqual(mode + "A Delay 완료", NodeStatus::SUCCESS, a_delay.last_status) ||
+                        !AssertFalse(mode + "A Delay 리셋", a_delay.started) ||
+                        !AssertTrue(mode + "B Delay 진행 중", b_delay.started) ||
+                        !AssertEqual(mode + "B Delay 상태", NodeStatus::RUNNING, b_delay.last_status))
+                        return TestResult("TestSharedTreeState", false, "Delay 상태 공유됨");
+
+                    // 반복 횟수도 에이전트별로 유지
+                    if (!AssertEqual(mode + "A 반복 횟수", 2, agent_a.GetNodeState(repeat->GetId()).counter) ||
+                        !AssertEqual(mode + "B 반복 횟수", 1, agent_b.GetNodeState(repeat->GetId()).counter))
+                        return TestResult("TestSharedTreeState", false, "반복 횟수 공유됨");
+
+                    if (!AssertTrue(mode + "A 트리 실행 중", tree->IsRunning(agent_a)) ||
+                        !AssertTrue(mode + "B 트리 실행 중", tree->IsRunning(agent_b)))
+                        return TestResult("TestSharedTreeState", false, "트리 상태 불일치");
+
+                    // 다른 트리에 바인딩되지 않은 컨텍스트는 실행 중이 아님
+                    Context idle;
+                    if (!AssertFalse(mode + "미실행 에이전트", tree->IsRunning(idle)))
+                        return TestResult("TestSharedTreeState", false, "미실행 에이전트 상태 불일치");
+                }
+
+                std::cout << "  ✓ 공유 트리 상태 테스트 통과\n";
+                return TestResult("TestSharedTreeState", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestSharedTreeState", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestStaticTree()
+        {
+            std::cout << "테스트: 템플릿 노드/정적 트리\n";
+
+            try
+            {
+                BlackboardKey<int> target_key("static_target");
+                BlackboardKey<int> attack_key("static_attacks");
+                BlackboardKey<int> patrol_key("static_patrols");
+
+                auto has_target = [&](Context& context) { return context.Get(target_key) != 0; };
+                auto attack     = [&](Context& context)
+                {
+                    context.Set(attack_key, context.Get(attack_key) + 1);
+                    return NodeStatus::SUCCESS;
+                };
+                auto patrol = [&](Context& context)
+                {
+                    context.Set(patrol_key, context.Get(patrol_key) + 1);
+                    return NodeStatus::RUNNING;
+                };
+
+                // 템플릿 리프는 일반 트리(그래프/컴파일)에서 그대로 동작
+                auto tree     = std::make_shared<Tree>("template_leaf_tree");
+                auto root     = std::make_shared<Selector>("root");
+                auto sequence = std::make_shared<Sequence>("attack_sequence");
+                sequence->AddChild(MakeCondition("has_target", has_target));
+                sequence->AddChild(MakeAction("attack", attack));
+                root->AddChild(sequence);
+                root->AddChild(MakeAction("patrol", patrol));
+                tree->SetRoot(root);
+
+                Context context;
+                if (!AssertEqual("타겟 없음 → 순찰", NodeStatus::RUNNING, tree->Execute(context)) ||
+                    !AssertEqual("순찰 횟수", 1, context.Get(patrol_key)) ||
+                    !AssertTrue("조건 노드 타입", sequence->GetChildren()[0]->IsGuard()))
+                    return TestResult("TestStaticTree", false, "템플릿 리프 실행 실패");
+
+                tree->Compile();
+                context.Set(target_key, 1);
+                if (!AssertEqual("타겟 있음 → 공격", NodeStatus::SUCCESS, tree->Execute(context)) ||
+                    !AssertEqual("공격 횟수", 1, context.Get(attack_key)))
+                    return TestResult("TestStaticTree", false, "컴파일된 템플릿 리프 실행 실패");
+
+                // 같은 모양의 정적 트리
+                auto static_root = dsl::Selector(dsl::Sequence(dsl::Condition(has_target), dsl::Action(attack)),
+                                                 dsl::Action(patrol));
+                Context static_context;
+                if (!AssertEqual("정적: 타겟 없음", NodeStatus::RUNNING, static_root.Tick(static_context)) ||
+                    !AssertEqual("정적: 순찰 횟수", 1, static_context.Get(patrol_key)))
+                    return TestResult("TestStaticTree", false, "정적 Selector 실행 실패");
+
+                static_context.Set(target_key, 1);
+                if (!AssertEqual("정적: 타겟 있음", NodeStatus::SUCCESS, static_root.Tick(static_context)) ||
+                    !AssertEqual("정적: 공격 횟수", 1, static_context.Get(attack_key)) ||
+                    !AssertEqual("정적: 순찰 안 함", 1, static_context.Get(patrol_key)))
+                    return TestResult("TestStaticTree", false, "정적 Sequence 실행 실패");
+
+                // Sequence는 첫 실패에서 멈추고, Invert는 결과를 뒤집는다
+                int  visited  = 0;
+                auto counting = [&](Context&)
+                {
+                    visited++;
+                    return NodeStatus::SUCCESS;
+                };
+                auto short_circuit =
+                    dsl::Sequence(dsl::Action(counting), dsl::Invert(dsl::Action(counting)), dsl::Action(counting));
+                if (!AssertEqual("정적: Invert 실패", NodeStatus::FAILURE, short_circuit.Tick(static_context)) ||
+                    !AssertEqual("정적: 단락 평가", 2, visited))
+                    return TestResult("TestStaticTree", false, "정적 단락 평가 실패");
+
+                // 기존 노드 클래스를 리프로 사용하고, 어댑터로 일반 트리에 넣기
+                auto static_tree = std::make_shared<Tree>("static_tree");
+                static_tree->SetRoot(MakeStaticNode(
+                    "static_root", dsl::Sequence(dsl::Leaf<TestSuccessAction>("success"), dsl::Action(patrol))));
+                Context adapter_context;
+                if (!AssertEqual("어댑터 실행", NodeStatus::RUNNING, static_tree->Execute(adapter_context)) ||
+                    !AssertEqual("어댑터 순찰 횟수", 1, adapter_context.Get(patrol_key)) ||
+                    !AssertFalse("RUNNING이면 대기 불가", adapter_context.CanSleep()))
+                    return TestResult("TestStaticTree", false, "정적 트리 어댑터 실패");
+
+                std::cout << "  ✓ 템플릿 노드/정적 트리 테스트 통과\n";
+                return TestResult("TestStaticTree", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestStaticTree", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestProfiler()
+        {
+            std::cout << "테스트: 노드 프로파일러\n";
+#ifdef BT_DISABLE_PROFILING
+            std::cout << "  - BT_DISABLE_PROFILING으로 빌드되어 건너뜀\n";
+            return TestResult("TestProfiler", true);
+#endif
+
+            try
+            {
+                // root(Selector) → [fail_sequence(Sequence) → fail, success]
+                auto tree          = std::make_shared<Tree>("profiled tree");
+                auto root          = std::make_shared<Selector>("root");
+                auto fail_sequence = std::make_shared<Sequence>("fail;sequence");
+                fail_sequence->AddChild(std::make_shared<TestFailureAction>("fail"));
+                root->AddChild(fail_sequence);
+                root->AddChild(std::make_shared<TestSuccessAction>("success"));
+                tree->SetRoot(root);
+
+                Context context;
+                context.SetAI(CreateMockAI());
+                tree->Execute(context);
+                if (!AssertTrue("기본값은 비활성", !tree->GetProfiler()) || !AssertTrue("Context 미설정", !context.GetProfiler()))
+                    return TestResult("TestProfiler", false, "비활성 상태 오류");
+
+                Engine engine;
+                engine.RegisterTree("profiled", tree);
+                engine.SetProfilingEnabled(true);
+                const int ticks = 10;
+                for (int i = 0; i < ticks; ++i)
+                {
+                    tree->Execute(context);
+                }
+                tree->Compile(); // 컴파일된 실행도 같은 노드 id로 측정
+                for (int i = 0; i < ticks; ++i)
+                {
+                    tree->Execute(context);
+                }
+
+                auto profiler = tree->GetProfiler();
+                auto profiles = profiler ? profiler->Collect() : std::vector<NodeProfile>();
+                if (!AssertTrue("프로파일러 생성", profiler != nullptr) ||
+                    !AssertEqual("노드 수", size_t(4), profiler ? profiler->GetNodeCount() : 0) ||
+                    !AssertEqual("루트 호출 수", 2 * ticks, static_cast<int>(profiles[0].calls)) ||
+                    !AssertEqual("루트 성공 횟수", 2 * ticks, static_cast<int>(profiles[0].status_counts[0])) ||
+                    !AssertEqual("실패 노드 실패 횟수", 2 * ticks, static_cast<int>(profiles[2].status_counts[1])) ||
+                    !AssertEqual("성공 노드 이름", std::string("success"), profiler->GetNodeName(3)))
+                    return TestResult("TestProfiler", false, "호출 수/상태 집계 오류");
+
+                // self 시간은 자식 시간을 뺀 값
+                if (!AssertTrue("루트 전체 ≥ 자식 시간", profiles[0].total_cycles >= profiles[0].child_cycles) ||
+                    !AssertTrue("리프는 자식 시간 없음", profiles[3].child_cycles == 0) ||
+                    !AssertTrue("루트 자식 시간 ≥ 자식 전체",
+                                profiles[0].child_cycles >= profiles[1].total_cycles + profiles[3].total_cycles))
+                    return TestResult("TestProfiler", false, "self 시간 계산 오류");
+
+                // 다른 스레드의 측정도 합쳐진다
+                std::thread worker(
+                    [&]()
+                    {
+                        Context worker_context;
+                        tree->Execute(worker_context);
+                    });
+                worker.join();
+                if (!AssertEqual("스레드 합산", 2 * ticks + 1, static_cast<int>(profiler->Collect()[0].calls)))
+                    return TestResult("TestProfiler", false, "스레드별 버퍼 합산 오류");
+
+                // 내보내기
+                auto        json   = nlohmann::json::parse(engine.ExportProfileJson());
+                const auto& nodes  = json[0]["nodes"];
+                std::string stacks = engine.ExportCollapsedStacks();
+                if (!AssertEqual("JSON 트리 이름", std::string("profiled tree"), json[0]["tree"].get<std::string>()) ||
+                    !AssertEqual("JSON 노드 이름", std::string("fail;sequence"), nodes[1]["name"].get<std::string>()) ||
+                    !AssertEqual("JSON 호출 수", 2 * ticks + 1, nodes[0]["calls"].get<int>()) ||
+                    !AssertTrue("collapsed-stack 경로",
+                                stacks.find("profiled_tree;root;fail_sequence;fail ") != std::string::npos))
+                    return TestResult("TestProfiler", false, "내보내기 오류");
+
+                // 끄면 측정하지 않음
+                engine.SetProfilingEnabled(false);
+                tree->Execute(context);
+                if (!AssertTrue("비활성화", !tree->IsProfiling()) || !AssertTrue("Context 해제", !context.GetProfiler()))
+                    return TestResult("TestProfiler", false, "비활성화 오류");
+
+                std::cout << "  ✓ 노드 프로파일러 테스트 통과\n";
+                return TestResult("TestProfiler", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestProfiler", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestTreeLoader()
+        {
+            std::cout << "테스트: 데이터 기반 트리 로딩\n";
+
+            try
+            {
+                // 게임 쪽 리프 등록 (KEY 파라미터는 블랙보드 스키마와 타입을 대조한다)
+                NodeRegistry registry;
+                registry.RegisterLeaf<TestSuccessAction>("Succeed");
+                registry.RegisterLeaf<TestFailureAction>("Fail");
+                registry
+                    .Register("IsFlagSet",
+                              [](const std::string& name, const NodeParams& params)
+                              {
+                                  auto key = params.GetKey<bool>("key");
+                                  return MakeCondition(name, [key](Context& context) { return context.Get(key); });
+                              })
+                    .KeyParam("key", ParamType::BOOL);
+                registry
+                    .Register("SetCounter",
+                              [](const std::string& name, const NodeParams& params)
+                              {
+                                  auto key   = params.GetKey<int>("key");
+                                  int  value = static_cast<int>(params.GetInt("value"));
+                                  return MakeAction(name,
+                                                    [key, value](Context& context)
+                                                    {
+                                                        context.Set(key, value);
+                                                        return NodeStatus::SUCCESS;
+                                                    });
+                              })
+                    .KeyParam("key", ParamType::INT)
+                    .Param("value", ParamType::INT, int64_t(1));
+
+                // root(Selector) → [attack(Sequence) → check_flag, set_counter], Invert → fail
+                auto definition = nlohmann::json::parse(R"({
+                    "name": "loaded_bt",
+                    "execution_mode": "MEMORY",
+                    "dependencies": ["loader_flag"],
+                    "blackboard": {"loader_flag": "bool", "loader_counter": "int"},
+                    "root": {
+                        "type": "Selector", "name": "root",
+                        "children": [
+                            {"type": "Sequence", "name": "attack", "children": [
+                                {"type": "IsFlagSet", "name": "check_flag", "params": {"key": "loader_flag"}},
+                                {"type": "SetCounter", "name": "set_counter",
+                                 "params": {"key": "loader_counter", "value": 7}}
+                            ]},
+                            {"type": "Invert", "children": [{"type": "Fail", "name": "fail"}]}
+                        ]
+                    }
+                })");
+
+                TreeLoader loader(registry);
+                auto       tree = loader.LoadJson(definition);
+                if (!AssertEqual("트리 이름", std::string("loaded_bt"), tree->GetName()) ||
+                    !AssertTrue("실행 모드", tree->GetExecutionMode() == ExecutionMode::MEMORY) ||
+                    !AssertEqual("의존성", size_t(1), tree->GetDependencies().size()) ||
+                    !AssertTrue("컴파일됨", tree->IsCompiled()) ||
+                    !AssertEqual("노드 수", size_t(6), tree->GetNodeCount()) ||
+                    !AssertEqual("이름 기본값", std::string("Invert"), tree->GetRoot()->GetChildren()[1]->GetName()))
+                    return TestResult("TestTreeLoader", false, "JSON 로드 결과 오류");
+
+                BlackboardKey<bool> flag_key("loader_flag");
+                BlackboardKey<int>  counter_key("loader_counter");
+
+                // 트리 실행: 플래그가 없으면 Invert 분기, 있으면 카운터 설정
+                auto run = [&](const std::shared_ptr<Tree>& loaded, bool flag)
+                {
+                    Context context;
+                    context.Set(flag_key, flag);
+                    NodeStatus status = loaded->Execute(context);
+                    return std::make_pair(status, context.Get(counter_key));
+                };
+                if (!AssertEqual("플래그 없음", NodeStatus::SUCCESS, run(tree, false).first) ||
+                    !AssertEqual("카운터 미설정", 0, run(tree, false).second) ||
+                    !AssertEqual("카운터 설정", 7, run(tree, true).second))
+                    return TestResult("TestTreeLoader", false, "로드한 트리 실행 오류");
+
+                // 바이너리 왕복: 같은 트리, 같은 바이트
+                std::vector<uint8_t> binary = loader.Precompile(definition);
+                auto                 loaded = loader.LoadBinary(binary);
+                if (!AssertTrue("바이너리 매직", TreeLoader::IsBinary(binary)) ||
+                    !AssertTrue("JSON보다 작음", binary.size() < definition.dump().size()) ||
+                    !AssertTrue("재직렬화 동일", TreeLoader::ToBinary(TreeLoader::ParseBinary(binary)) == binary) ||
+                    !AssertEqual("바이너리 노드 수", size_t(6), loaded->GetNodeCount()) ||
+                    !AssertTrue("바이너리 실행 모드", loaded->GetExecutionMode() == ExecutionMode::MEMORY) ||
+                    !AssertEqual("바이너리 파라미터", 7, run(loaded, true).second))
+                    return TestResult("TestTreeLoader", false, "바이너리 왕복 오류");
+
+                // 잘린 바이너리는 거부
+                std::vector<uint8_t> truncated(binary.begin(), binary.begin() + binary.size() / 2);
+                bool                 truncated_rejected = false;
+                try
+                {
+                    loader.LoadBinary(truncated);
+                }
+                catch (const TreeLoadError&)
+                {
+                    truncated_rejected = true;
+                }
+                if (!AssertTrue("잘린 바이너리 거부", truncated_rejected))
+                    return TestResult("TestTreeLoader", false, "손상된 바이너리 허용");
+
+                // 검증 실패: 메시지에 노드 경로와 원인이 들어간다
+                auto expect_error = [&](const std::string& label, nlohmann::json broken, const std::string& expected)
+                {
+                    try
+                    {
+                        loader.LoadJson(broken);
+                    }
+                    catch (const TreeLoadError& e)
+                    {
+                        std::string message = e.what();
+                        return AssertTrue(label + ": " + message, message.find(expected) != std::string::npos);
+                    }
+                    return AssertTrue(label + " 거부", false);
+                };
+
+                // check_flag: root[0]/attack[0], set_counter: root[0]/attack[1], fail: root[1]/Invert[0]
+                std::string flag_path = "loaded_bt/root[0]/attack[0]/check_flag";
+
+                auto unknown_type                                  = definition;
+                unknown_type["root"]["children"][1]["children"][0] = {{"type", "Jump"}, {"name", "jump"}};
+
+                auto bad_param                                                     = definition;
+                bad_param["root"]["children"][0]["children"][1]["params"]["value"] = "seven";
+
+                auto undeclared_key                                                     = definition;
+                undeclared_key["root"]["children"][0]["children"][0]["params"]["key"] = "missing_flag";
+
+                auto mistyped_key                                                     = definition;
+                mistyped_key["root"]["children"][0]["children"][0]["params"]["key"] = "loader_counter";
+
+                auto missing_param = definition;
+                missing_param["root"]["children"][0]["children"][0].erase("params");
+
+                auto child_count = definition;
+                child_count["root"]["children"][1]["children"].push_back({{"type", "Succeed"}});
+
+                auto bad_choice = definition;
+                bad_choice["root"]["type"]   = "Parallel";
+                bad_choice["root"]["params"] = {{"policy", "SOMETIMES"}};
+
+                if (!expect_error("알 수 없는 타입", unknown_type, "loaded_bt/root[1]/Invert[0]/jump") ||
+                    !expect_error("알 수 없는 타입 원인", unknown_type, "Jump") ||
+                    !expect_error("파라미터 타입", bad_param, "value는 int") ||
+                    !expect_error("선언되지 않은 키", undeclared_key, flag_path) ||
+                    !expect_error("선언되지 않은 키 원인", undeclared_key, "missing_flag") ||
+                    !expect_error("키 타입 불일치", mistyped_key, "loader_counter는 int") ||
+                    !expect_error("필수 파라미터", missing_param, "key") ||
+                    !expect_error("자식 수", child_count, "Invert의 자식 수") ||
+                    !expect_error("허용 값", bad_choice, "SOMETIMES"))
+                    return TestResult("TestTreeLoader", false, "로드 시 검증 오류");
+
+                std::cout << "  ✓ 데이터 기반 트리 로딩 테스트 통과\n";
+                return TestResult("TestTreeLoader", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestTreeLoader", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestHotReload()
+        {
+            std::cout << "테스트: 트리 핫 리로드\n";
+
+            try
+            {
+                // Repeat(3)[step]: RUNNING, RUNNING, SUCCESS (반복 횟수는 에이전트별 상태)
+                auto make_repeat_tree = []()
+                {
+                    auto tree   = std::make_shared<Tree>("hot_tree");
+                    auto repeat = std::make_shared<Repeat>("repeat", 3);
+                    repeat->AddChild(std::make_shared<TestSuccessAction>("step"));
+                    tree->SetRoot(repeat);
+                    return tree;
+                };
+
+                Engine engine;
+                auto   v1 = make_repeat_tree();
+                if (!AssertEqual("첫 게시 버전", 1, static_cast<int>(engine.RegisterTree("hot_tree", v1))))
+                    return TestResult("TestHotReload", false, "버전 번호 불일치");
+                if (!AssertFalse("미등록 리로드", engine.ReloadTree("missing_tree", make_repeat_tree())))
+                    return TestResult("TestHotReload", false, "미등록 이름이 리로드됨");
+
+                auto    mock_ai = CreateMockAI("HotReloadAI");
+                Context context;
+                context.SetAI(mock_ai);
+
+                TreeBinding binding(engine.GetTreeSlot("hot_tree"));
+                if (!AssertEqual("v1 첫 틱", NodeStatus::RUNNING, binding.Execute(context)) ||
+                    !AssertTrue("v1 사용", binding.GetTree() == v1))
+                    return TestResult("TestHotReload", false, "첫 버전을 가져오지 않음");
+
+                // 구조가 같은 새 버전: 다음 틱 경계에서 교체되고 실행 중인 상태를 이어받음
+                auto v2 = make_repeat_tree();
+                if (!AssertEqual("구조 해시 동일", true, v1->GetStructureHash() == v2->GetStructureHash()) ||
+                    !AssertTrue("리로드", engine.ReloadTree("hot_tree", v2)) ||
+                    !AssertTrue("틱 전에는 이전 버전", binding.GetTree() == v1))
+                    return TestResult("TestHotReload", false, "게시 실패");
+
+                std::weak_ptr<Tree> v1_weak = v1;
+                v1.reset();
+                if (!AssertFalse("실행 중인 이전 버전 유지", v1_weak.expired()))
+                    return TestResult("TestHotReload", false, "실행 중인 이전 버전이 해제됨");
+
+                if (!AssertEqual("v2 이어받은 틱", NodeStatus::RUNNING, binding.Execute(context)) ||
+                    !AssertTrue("v2 사용", binding.GetTree() == v2) ||
+                    !AssertEqual("반복 횟수 이전", 2, context.GetNodeState(v2->GetRoot()->GetId()).counter) ||
+                    !AssertEqual("v2 완료", NodeStatus::SUCCESS, binding.Execute(context)))
+                    return TestResult("TestHotReload", false, "실행 상태가 이전되지 않음");
+                if (!AssertTrue("이전 버전 해제", v1_weak.expired()))
+                    return TestResult("TestHotReload", false, "이전 버전이 해제되지 않음");
+
+                // 구조가 다른 새 버전: 상태를 버리고 처음부터 실행
+                binding.Execute(context);
+                auto v3   = std::make_shared<Tree>("hot_tree");
+                auto root = std::make_shared<Sequence>("root");
+                root->AddChild(std::make_shared<TestSuccessAction>("step"));
+                root->AddChild(std::make_shared<TestSuccessAction>("step2"));
+                v3->SetRoot(root);
+                v3->Compile();
+                engine.RegisterTree("hot_tree", v3);
+                if (!AssertEqual("v3 새로 실행", NodeStatus::SUCCESS, binding.Execute(context)) ||
+                    !AssertTrue("v3 사용", binding.GetTree() == v3) ||
+                    !AssertEqual("리로드 횟수", 3, static_cast<int>(binding.GetReloadCount())))
+                    return TestResult("TestHotReload", false, "구조가 다른 버전으로 교체 실패");
+
+                // 실행자: BindTreeSlot으로 연결하면 Update에서 새 버전을 따라감 (기본 구현은 현재 버전 고정)
+                auto executor = CreateMockAI("PinnedAI");
+                executor->BindTreeSlot(engine.GetTreeSlot("hot_tree"));
+                engine.RegisterTree("hot_tree", make_repeat_tree());
+                if (!AssertTrue("기본 구현은 고정", executor->GetBehaviorTree() == v3))
+                    return TestResult("TestHotReload", false, "기본 BindTreeSlot 동작 불일치");
+
+                // Engine::ExecuteTree(TreeId)도 실행자와 같이 새 버전에서 실행 상태를 이어받음
+                const TreeId id = engine.GetTreeId("hot_tree");
+                Context      id_context;
+                id_context.SetAI(mock_ai);
+                auto w1 = make_repeat_tree();
+                engine.RegisterTree("hot_tree", w1);
+                if (!AssertEqual("id 실행 첫 틱", NodeStatus::RUNNING, engine.ExecuteTree(id, id_context)))
+                    return TestResult("TestHotReload", false, "id 실행 실패");
+                auto w2 = make_repeat_tree();
+                engine.RegisterTree("hot_tree", w2);
+                if (!AssertEqual("id 실행 이어받은 틱", NodeStatus::RUNNING, engine.ExecuteTree(id, id_context)) ||
+                    !AssertEqual("id 반복 횟수 이전", 2, id_context.GetNodeState(w2->GetRoot()->GetId()).counter) ||
+                    !AssertEqual("id 실행 완료", NodeStatus::SUCCESS, engine.ExecuteTree(id, id_context)))
+                    return TestResult("TestHotReload", false, "id 실행에서 실행 상태가 이전되지 않음");
+
+                std::cout << "  ✓ 트리 핫 리로드 테스트 통과\n";
+                return TestResult("TestHotReload", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestHotReload", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestMemoryExecution()
+        {
+            std::cout << "테스트: 메모리 실행 모드\n";
+
+            try
+            {
+                for (bool compiled : {false, true})
+                {
+                    const std::string mode = compiled ? "컴파일 " : "그래프 ";
+
+                    // root: Selector[attack: Sequence[HasTarget, Attack(3틱)], patrol: Sequence[S1, S2, S3, Move(5틱)]]
+                    auto tree   = std::make_shared<Tree>("memory_tree");
+                    auto root   = std::make_shared<Selector>("root");
+                    auto attack = std::make_shared<Sequence>("attack");
+                    auto patrol = std::make_shared<Sequence>("patrol");
+                    auto strike = std::make_shared<TestRunningAction>("strike", 3);
+                    attack->AddChild(std::make_shared<TestHasTargetCondition>("has_target"));
+                    attack->AddChild(strike);
+                    patrol->AddChild(std::make_shared<TestSuccessAction>("s1"));
+                    patrol->AddChild(std::make_shared<TestSuccessAction>("s2"));
+                    patrol->AddChild(std::make_shared<TestSuccessAction>("s3"));
+                    patrol->AddChild(std::make_shared<TestRunningAction>("move", 5));
+                    root->AddChild(attack);
+                    root->AddChild(patrol);
+                    tree->SetRoot(root);
+                    tree->SetExecutionMode(ExecutionMode::MEMORY);
+                    if (compiled)
+                    {
+                        tree->Compile();
+                    }
+
+                    auto    mock_ai = CreateMockAI("MemoryAI");
+                    Context context;
+                    context.SetAI(mock_ai);
+
+                    // 첫 틱: 순찰 시퀀스를 처음부터 실행 (액션 4회, 조건 1회)
+                    if (!AssertEqual(mode + "첫 틱", NodeStatus::RUNNING, tree->Execute(context)) ||
+                        !AssertEqual(mode + "첫 틱 액션", 4, mock_ai->action_count_.load()) ||
+                        !AssertEqual(mode + "첫 틱 조건", 1, mock_ai->condition_count_.load()))
+                        return TestResult("TestMemoryExecution", false, "첫 틱 방문 수 불일치");
+
+                    // 두 번째 틱: 실행 중인 Move로 바로 재개, 공격 가드만 재확인
+                    tree->Execute(context);
+                    if (!AssertEqual(mode + "재개 액션", 5, mock_ai->action_count_.load()) ||
+                        !AssertEqual(mode + "가드 재확인", 2, mock_ai->condition_count_.load()))
+                        return TestResult("TestMemoryExecution", false, "실행 중 노드에서 재개하지 않음");
+
+                    // 타겟이 생기면 우선순위가 높은 공격 가드가 순찰을 선점
+                    mock_ai->SetTarget(1);
+                    if (!AssertEqual(mode + "선점 틱", NodeStatus::RUNNING, tree->Execute(context)) ||
+                        !AssertEqual(mode + "선점 액션", 6, mock_ai->action_count_.load()) ||
+                        !AssertFalse(mode + "순찰 상태 리셋", context.GetNodeState(patrol->GetId()).is_running) ||
+                        !AssertEqual(mode + "순찰 재개 위치 리셋", 0,
+                                     static_cast<int>(context.GetNodeState(patrol->GetId()).child_index)) ||
+                        !AssertTrue(mode + "공격 실행 중", context.GetNodeState(strike->GetId()).is_running))
+                        return TestResult("TestMemoryExecution", false, "가드 선점 실패");
+
+                    // 타겟을 잃으면 공격 시퀀스의 가드가 실패하고 순찰을 처음부터 다시 실행
+                    mock_ai->ClearTarget();
+                    int actions_before = mock_ai->action_count_.load();
+                    if (!AssertEqual(mode + "가드 실패 틱", NodeStatus::RUNNING, tree->Execute(context)) ||
+                        !AssertEqual(mode + "순찰 재시작 액션", actions_before + 4, mock_ai->action_count_.load()) ||
+                        !AssertFalse(mode + "공격 상태 리셋", context.GetNodeState(strike->GetId()).is_running))
+                        return TestResult("TestMemoryExecution", false, "가드 실패 처리 오류");
+                }
+
+                // 반응형 모드에서는 명시적 메모리 노드만 재개
+                auto    mock_ai = CreateMockAI("MemoryNodeAI");
+                Context context;
+                context.SetAI(mock_ai);
+
+                auto sequence = std::make_shared<MemorySequence>("memory_sequence");
+                sequence->AddChild(std::make_shared<TestSuccessAction>("s1"));
+                sequence->AddChild(std::make_shared<TestRunningAction>("move", 3));
+                sequence->Tick(context);
+                sequence->Tick(context);
+                if (!AssertEqual("메모리 노드 재개", 3, mock_ai->action_count_.load()) ||
+                    !AssertEqual("메모리 노드 완료", NodeStatus::SUCCESS, sequence->Tick(context)) ||
+                    !AssertEqual("메모리 노드 완료 후 액션", 4, mock_ai->action_count_.load()))
+                    return TestResult("TestMemoryExecution", false, "MemorySequence 재개 실패");
+
+                std::cout << "  ✓ 메모리 실행 모드 테스트 통과\n";
+                return TestResult("TestMemoryExecution", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestMemoryExecution", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestEventScheduling()
+        {
+            std::cout << "테스트: 이벤트 기반 스케줄링\n";
+
+            try
+            {
+                for (bool compiled : {false, true})
+                {
+                    const std::string mode = compiled ? "컴파일 " : "그래프 ";
+
+                    // 대기 트리: Sequence[Delay(40ms), 성공 액션], "alarm" 이벤트에 의존
+                    auto idle_tree = std::make_shared<Tree>("idle_tree");
+                    auto idle_root = std::make_shared<Sequence>("idle_root");
+                    idle_root->AddChild(std::make_shared<Delay>("wait", std::chrono::milliseconds(40)));
+                    idle_root->AddChild(std::make_shared<TestSuccessAction>("after_wait"));
+                    idle_tree->SetRoot(idle_root);
+                    idle_tree->AddDependency("alarm");
+
+                    // 바쁜 트리: Parallel[Delay, 계속 실행 중인 액션] - 대기시키면 안 됨
+                    auto busy_tree = std::make_shared<Tree>("busy_tree");
+                    auto busy_root = std::make_shared<Parallel>("busy_root", Parallel::Policy::SUCCEED_ON_ALL);
+                    busy_root->AddChild(std::make_shared<Delay>("wait", std::chrono::milliseconds(40)));
+                    busy_root->AddChild(std::make_shared<TestRunningAction>("move", 100));
+                    busy_tree->SetRoot(busy_root);
+
+                    // 반복 트리: Repeat은 자식이 성공해도 다음 틱이 필요
+                    auto repeat_tree = std::make_shared<Tree>("repeat_tree");
+                    auto repeat      = std::make_shared<Repeat>("repeat", 5);
+                    repeat->AddChild(std::make_shared<TestSuccessAction>("step"));
+                    repeat_tree->SetRoot(repeat);
+
+                    if (compiled)
+                    {
+                        idle_tree->Compile();
+                        busy_tree->Compile();
+                        repeat_tree->Compile();
+                    }
+
+                    Engine                                       engine;
+                    Scheduler&                                   scheduler = engine.GetScheduler();
+                    std::vector<std::shared_ptr<Tree>>           trees = {idle_tree, idle_tree, busy_tree, repeat_tree};
+                    std::vector<std::unique_ptr<Context>>        contexts;
+                    std::vector<std::shared_ptr<MockAIExecutor>> agents;
+                    for (uint32_t id = 0; id < trees.size(); ++id)
+                    {
+                        agents.push_back(CreateMockAI("Agent" + std::to_string(id)));
+                        contexts.push_back(std::make_unique<Context>());
+                        contexts.back()->SetAI(agents.back());
+                        scheduler.Add(id);
+                    }
+
+                    auto run_frame = [&](std::chrono::steady_clock::time_point now)
+                    {
+                        std::vector<uint32_t> ticked;
+                        for (uint32_t id : scheduler.CollectReady(now))
+                        {
+                            trees[id]->Execute(*contexts[id]);
+                            engine.ParkIfIdle(id, *trees[id], *contexts[id]);
+                            ticked.push_back(id);
+                        }
+                        return ticked;
+                    };
+
+                    auto start = std::chrono::steady_clock::now();
+                    if (!AssertEqual(mode + "첫 프레임 틱 수", size_t(4), run_frame(start).size()) ||
+                        !AssertEqual(mode + "대기 에이전트 수", size_t(2), scheduler.GetParkedCount()) ||
+                        !AssertEqual(mode + "이벤트 대기 항목 수", size_t(2), scheduler.GetWaiterCount()) ||
+                        !AssertFalse(mode + "바쁜 에이전트", scheduler.IsParked(2)) ||
+                        !AssertFalse(mode + "반복 에이전트", scheduler.IsParked(3)))
+                        return TestResult("TestEventScheduling", false, "대기 판정 오류");
+
+                    // Delay 만료 전 프레임에서는 대기 에이전트를 틱하지 않음
+                    auto ticked = run_frame(start + std::chrono::milliseconds(16));
+                    if (!AssertEqual(mode + "대기 중 틱 수", size_t(2), ticked.size()) ||
+                        !AssertEqual(mode + "대기 에이전트 액션", 0, agents[0]->action_count_.load()))
+                        return TestResult("TestEventScheduling", false, "대기 에이전트가 틱됨");
+
+                    // 의존 이벤트는 해당 에이전트만 깨움 (다른 이벤트는 무시)
+                    engine.NotifyEvent(1, "unrelated");
+                    engine.NotifyEvent(1, "alarm");
+                    ticked = run_frame(start + std::chrono::milliseconds(20));
+                    if (!AssertEqual(mode + "이벤트 후 틱 수", size_t(3), ticked.size()) ||
+                        !AssertTrue(mode + "이벤트 후 재대기", scheduler.IsParked(1)) ||
+                        !AssertTrue(mode + "다른 에이전트는 계속 대기", scheduler.IsParked(0)))
+                        return TestResult("TestEventScheduling", false, "이벤트 깨우기 오류");
+
+                    // 깨어날 시각이 지나면 타이머 휠이 깨움
+                    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                    ticked = run_frame(std::chrono::steady_clock::now() + std::chrono::milliseconds(20));
+                    if (!AssertEqual(mode + "만료 후 틱 수", size_t(4), ticked.size()) ||
+                        !AssertEqual(mode + "만료 후 액션", 1, agents[0]->action_count_.load()) ||
+                        !AssertEqual(
+                            mode + "만료 후 상태", NodeStatus::SUCCESS, idle_tree->GetLastStatus(*contexts[0])) ||
+                        !AssertEqual(mode + "대기 에이전트 없음", size_t(0), scheduler.GetParkedCount()) ||
+                        !AssertEqual(mode + "타이머로 깨운 뒤 대기 항목 없음", size_t(0), scheduler.GetWaiterCount()))
+                        return TestResult("TestEventScheduling", false, "타이머 깨우기 오류");
+
+                    // 제거된 에이전트는 더 이상 틱 대상이 아님
+                    scheduler.Remove(2);
+                    if (!AssertEqual(
+                            mode + "제거 후 틱 수", size_t(3), run_frame(std::chrono::steady_clock::now()).size()))
+                        return TestResult("TestEventScheduling", false, "제거 처리 오류");
+
+                    // 대기 중에 제거된 에이전트의 이벤트 대기 항목도 남지 않음 (다시 대기한 idle 에이전트 몫은 남음)
+                    const size_t waiters = scheduler.GetWaiterCount();
+                    scheduler.Add(10);
+                    scheduler.Park(10, Scheduler::TimePoint::max(), {"alarm", "noise"});
+                    scheduler.Remove(10);
+                    if (!AssertEqual(mode + "제거 후 대기 항목 복구", waiters, scheduler.GetWaiterCount()))
+                        return TestResult("TestEventScheduling", false, "대기 항목 누수");
+                }
+
+                // 제거 후 같은 id로 다시 등록해도 이전 대기의 타이머 항목이 새 대기를 일찍 깨우지 않음
+                {
+                    Scheduler scheduler;
+                    auto      start = std::chrono::steady_clock::now();
+                    scheduler.Add(5);
+                    scheduler.Park(5, start + std::chrono::milliseconds(50));
+                    scheduler.Remove(5);
+                    scheduler.Add(5);
+                    scheduler.CollectReady(start);
+                    scheduler.Park(5, start + std::chrono::seconds(10));
+                    scheduler.CollectReady(start + std::chrono::milliseconds(100));
+                    if (!AssertTrue("재등록 후 이전 타이머 무시", scheduler.IsParked(5)))
+                        return TestResult("TestEventScheduling", false, "재등록 세대 충돌");
+                }
+
+                std::cout << "  ✓ 이벤트 기반 스케줄링 테스트 통과\n";
+                return TestResult("TestEventScheduling", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestEventScheduling", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestParallelTickAll()
+        {
+            std::cout << "테스트: 병렬 배치 틱\n";
+
+            try
+            {
+                // 모든 에이전트가 공유하는 트리: Repeat(3)[성공 액션] -> RUNNING, RUNNING, SUCCESS 반복
+                auto tree   = std::make_shared<Tree>("batch_tree");
+                auto repeat = std::make_shared<Repeat>("repeat", 3);
+                repeat->AddChild(std::make_shared<TestSuccessAction>("step"));
+                tree->SetRoot(repeat);
+                tree->Compile();
+
+                const size_t                            agent_count = 257;
+                std::vector<std::shared_ptr<IExecutor>> executors;
+                for (size_t i = 0; i < agent_count; ++i)
+                {
+                    auto agent = CreateMockAI("BatchAgent" + std::to_string(i));
+                    agent->SetBehaviorTree(tree);
+                    executors.push_back(agent);
+                }
+
+                Engine engine;
+                engine.SetThreadCount(4);
+                engine.SetTickGrain(8);
+                if (!AssertEqual("워커 수", size_t(4), engine.GetThreadCount()))
+                    return TestResult("TestParallelTickAll", false, "스레드 풀 생성 실패");
+
+                const NodeStatus expected[] = {NodeStatus::RUNNING, NodeStatus::RUNNING, NodeStatus::SUCCESS};
+                for (int frame = 0; frame < 3; ++frame)
+                {
+                    std::vector<size_t> commit_order;
+                    engine.TickAll(executors,
+                                   0.016f,
+                                   [&](size_t index, IExecutor& executor)
+                                   {
+                                       commit_order.push_back(index);
+                                       if (tree->GetLastStatus(executor.GetContext()) != expected[frame])
+                                       {
+                                           throw std::runtime_error("에이전트 상태 불일치: " + executor.GetName());
+                                       }
+                                   });
+
+                    // 배리어 이후: 모든 에이전트가 이번 프레임에 정확히 한 번 틱됨
+                    for (const auto& executor : executors)
+                    {
+                        if (executor->GetContext().GetExecutionCount() != static_cast<uint64_t>(frame + 1))
+                            return TestResult("TestParallelTickAll", false, "틱 횟수 불일치: " + executor->GetName());
+                    }
+
+                    // commit 단계는 배치 순서대로 순차 실행
+                    bool ordered = commit_order.size() == agent_count;
+                    for (size_t i = 0; ordered && i < commit_order.size(); ++i)
+                    {
+                        ordered = commit_order[i] == i;
+                    }
+                    if (!AssertTrue("commit 순서 " + std::to_string(frame), ordered))
+                        return TestResult("TestParallelTickAll", false, "commit 순서 불일치");
+                }
+
+                // 작업에서 발생한 예외는 배리어 이후 호출 스레드로 전달
+                struct ThrowingExecutor : MockAIExecutor
+                {
+                    ThrowingExecutor() : MockAIExecutor("Throwing") {}
+                    void Update(float) override { throw std::runtime_error("update failed"); }
+                };
+                executors[100] = std::make_shared<ThrowingExecutor>();
+                bool thrown    = false;
+                try
+                {
+                    engine.TickAll(executors, 0.016f);
+                }
+                catch (const std::runtime_error&)
+                {
+                    thrown = true;
+                }
+                if (!AssertTrue("예외 전달", thrown))
+                    return TestResult("TestParallelTickAll", false, "예외가 전달되지 않음");
+
+                std::cout << "  ✓ 병렬 배치 틱 테스트 통과\n";
+                return TestResult("TestParallelTickAll", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestParallelTickAll", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestAsyncParallel()
+        {
+            std::cout << "테스트: 동시 실행 Parallel과 비동기 리프\n";
+
+            try
+            {
+                // 결과를 테스트에서 직접 정하는 비동기 리프 (시작 횟수와 마지막 취소 토큰 기록)
+                struct Job
+                {
+                    int                      launches = 0;
+                    std::promise<NodeStatus> promise;
+                    CancelToken              token;
+                };
+                auto make_leaf = [](const std::string& name, Job& job)
+                {
+                    return std::make_shared<AsyncAction>(name,
+                                                         [&job](Context&, const CancelToken& token)
+                                                         {
+                                                             job.launches++;
+                                                             job.promise = std::promise<NodeStatus>();
+                                                             job.token   = token;
+                                                             return job.promise.get_future();
+                                                         });
+                };
+
+                for (bool compiled : {false, true})
+                {
+                    const std::string mode = compiled ? "컴파일 " : "그래프 ";
+
+                    // SUCCEED_ON_ALL: 먼저 끝난 자식은 다시 시작하지 않고 결과를 유지
+                    Job  path;
+                    Job  sight;
+                    auto tree = std::make_shared<Tree>("async_all");
+                    auto root = std::make_shared<Parallel>("root", Parallel::Policy::SUCCEED_ON_ALL, true);
+                    root->AddChild(make_leaf("path", path));
+                    root->AddChild(make_leaf("sight", sight));
+                    tree->SetRoot(root);
+                    if (compiled)
+                    {
+                        tree->Compile();
+                    }
+
+                    Context context;
+                    if (!AssertEqual(mode + "작업 시작", NodeStatus::RUNNING, tree->Execute(context)) ||
+                        !AssertEqual(mode + "동시 시작", 2, path.launches + sight.launches) ||
+                        !AssertEqual(mode + "진행 중인 작업", size_t(2), context.GetTreeState().GetResourceCount()))
+                        return TestResult("TestAsyncParallel", false, "작업이 함께 시작되지 않음");
+
+                    path.promise.set_value(NodeStatus::SUCCESS);
+                    if (!AssertEqual(mode + "한쪽 완료", NodeStatus::RUNNING, tree->Execute(context)) ||
+                        !AssertEqual(mode + "완료된 작업 재시작 안 함", 1, path.launches))
+                        return TestResult("TestAsyncParallel", false, "완료된 자식을 다시 실행함");
+
+                    sight.promise.set_value(NodeStatus::SUCCESS);
+                    if (!AssertEqual(mode + "모두 완료", NodeStatus::SUCCESS, tree->Execute(context)) ||
+                        !AssertEqual(mode + "작업 정리", size_t(0), context.GetTreeState().GetResourceCount()))
+                        return TestResult("TestAsyncParallel", false, "모두 완료 처리 실패");
+
+                    // 다음 실행은 처음부터
+                    tree->Execute(context);
+                    if (!AssertEqual(mode + "새 실행 시작", 4, path.launches + sight.launches))
+                        return TestResult("TestAsyncParallel", false, "새 실행에서 작업을 시작하지 않음");
+
+                    // FAIL_ON_ONE: 실패가 나오면 즉시 결정하고 남은 작업을 중단
+                    Job  slow;
+                    Job  fast;
+                    auto fail_tree = std::make_shared<Tree>("async_fail");
+                    auto fail_root = std::make_shared<Parallel>("root", Parallel::Policy::FAIL_ON_ONE, true);
+                    fail_root->AddChild(make_leaf("slow", slow));
+                    fail_root->AddChild(make_leaf("fast", fast));
+                    fail_tree->SetRoot(fail_root);
+                    if (compiled)
+                    {
+                        fail_tree->Compile();
+                    }
+
+                    Context fail_context;
+                    fail_tree->Execute(fail_context);
+                    fast.promise.set_value(NodeStatus::FAILURE);
+                    if (!AssertEqual(mode + "실패 결정", NodeStatus::FAILURE, fail_tree->Execute(fail_context)) ||
+                        !AssertTrue(mode + "남은 작업 취소", slow.token.IsCancelled()) ||
+                        !AssertEqual(mode + "취소된 작업 정리", size_t(0), fail_context.GetTreeState().GetResourceCount()))
+                        return TestResult("TestAsyncParallel", false, "남은 자식을 중단하지 않음");
+                }
+
+                // 작업 풀에서 실행: 두 작업이 서로 다른 워커에서 겹쳐 실행된다
+                Engine engine;
+                engine.SetJobThreadCount(2);
+                std::atomic<int> entered{0};
+                auto             rendezvous = [&entered](Context&) -> AsyncAction::Job
+                {
+                    return [&entered](const CancelToken& token)
+                    {
+                        entered++;
+                        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+                        while (entered.load() < 2 && !token.IsCancelled() && std::chrono::steady_clock::now() < deadline)
+                        {
+                            std::this_thread::yield();
+                        }
+                        return entered.load() >= 2 ? NodeStatus::SUCCESS : NodeStatus::FAILURE;
+                    };
+                };
+                auto tree = std::make_shared<Tree>("async_pool");
+                auto root = std::make_shared<Parallel>("root", Parallel::Policy::SUCCEED_ON_ALL, true);
+                root->AddChild(AsyncAction::OnPool("a", *engine.GetJobPool(), rendezvous));
+                root->AddChild(AsyncAction::OnPool("b", *engine.GetJobPool(), rendezvous));
+                tree->SetRoot(root);
+
+                Context    context;
+                NodeStatus status = tree->Execute(context);
+                for (int i = 0; i < 5000 && status == NodeStatus::RUNNING; ++i)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    status = tree->Execute(context);
+                }
+                if (!AssertEqual("작업 풀 동시 실행", NodeStatus::SUCCESS, status))
+                    return TestResult("TestAsyncParallel", false, "작업이 겹쳐 실행되지 않음");
+
+                std::cout << "  ✓ 동시 실행 Parallel 테스트 통과\n";
+                return TestResult("TestAsyncParallel", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestAsyncParallel", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestCoroutineAction()
+        {
+            std::cout << "테스트: 코루틴 Action\n";
+
+#ifdef BT_HAS_COROUTINES
+            try
+            {
+                // 본체의 지역 객체 정리 확인용
+                struct Guard
+                {
+                    int& destroyed;
+                    ~Guard() { destroyed++; }
+                };
+
+                for (bool compiled : {false, true})
+                {
+                    const std::string mode = compiled ? "컴파일 " : "그래프 ";
+
+                    // 세 틱 동안 한 걸음씩 진행한 뒤 성공
+                    int  steps     = 0;
+                    int  destroyed = 0;
+                    auto walk      = std::make_shared<CoAction>("walk",
+                                                           [&](Context&) -> CoTask
+                                                           {
+                                                               Guard guard{destroyed};
+                                                               for (int i = 0; i < 3; ++i)
+                                                               {
+                                                                   steps++;
+                                                                   co_await NextTick();
+                                                               }
+                                                               co_return NodeStatus::SUCCESS;
+                                                           });
+                    auto tree = std::make_shared<Tree>("co_walk");
+                    tree->SetRoot(walk);
+                    if (compiled)
+                    {
+                        tree->Compile();
+                    }
+
+                    Context context;
+                    for (int tick = 1; tick <= 3; ++tick)
+                    {
+                        if (!AssertEqual(mode + "진행 중", NodeStatus::RUNNING, tree->Execute(context)) ||
+                            !AssertEqual(mode + "걸음 수", tick, steps))
+                            return TestResult("TestCoroutineAction", false, "틱마다 재개되지 않음");
+                    }
+                    if (!AssertEqual(mode + "완료", NodeStatus::SUCCESS, tree->Execute(context)) ||
+                        !AssertEqual(mode + "프레임 정리", 1, destroyed) ||
+                        !AssertEqual(mode + "리소스 해제", size_t(0), context.GetTreeState().GetResourceCount()))
+                        return TestResult("TestCoroutineAction", false, "완료 처리 실패");
+
+                    // 반복 실행해도 프레임은 에이전트 아레나에서 재사용
+                    for (int run = 0; run < 50; ++run)
+                    {
+                        while (tree->Execute(context) == NodeStatus::RUNNING)
+                        {
+                        }
+                    }
+                    if (!AssertEqual(mode + "아레나 청크 수", size_t(1), context.GetTreeState().GetFrameArena().GetChunkCount()))
+                        return TestResult("TestCoroutineAction", false, "프레임이 재사용되지 않음");
+
+                    // 동시 실행 Parallel이 실패로 결정되면 실행 중인 코루틴을 중단하고 지역 객체를 정리
+                    destroyed      = 0;
+                    auto halt_tree = std::make_shared<Tree>("co_halt");
+                    auto root      = std::make_shared<Parallel>("root", Parallel::Policy::FAIL_ON_ONE, true);
+                    root->AddChild(walk);
+                    root->AddChild(std::make_shared<TestFailureAction>("fail"));
+                    halt_tree->SetRoot(root);
+                    if (compiled)
+                    {
+                        halt_tree->Compile();
+                    }
+                    Context halt_context;
+                    if (!AssertEqual(mode + "중단 결과", NodeStatus::FAILURE, halt_tree->Execute(halt_context)) ||
+                        !AssertEqual(mode + "중단 시 정리", 1, destroyed) ||
+                        !AssertEqual(mode + "중단 리소스", size_t(0), halt_context.GetTreeState().GetResourceCount()))
+                        return TestResult("TestCoroutineAction", false, "중단된 코루틴이 정리되지 않음");
+                }
+
+                // Sleep: 대기 중에는 재개하지 않고 스케줄러가 재워둘 수 있음
+                auto nap = std::make_shared<CoAction>("nap",
+                                                      [](Context&) -> CoTask
+                                                      {
+                                                          co_await Sleep(std::chrono::milliseconds(30));
+                                                          co_return NodeStatus::SUCCESS;
+                                                      });
+                auto nap_tree = std::make_shared<Tree>("co_nap");
+                nap_tree->SetRoot(nap);
+                Context nap_context;
+                if (!AssertEqual("대기 시작", NodeStatus::RUNNING, nap_tree->Execute(nap_context)) ||
+                    !AssertTrue("대기 중 파킹 가능", nap_tree->CanPark(nap_context)) ||
+                    !AssertEqual("대기 중", NodeStatus::RUNNING, nap_tree->Execute(nap_context)))
+                    return TestResult("TestCoroutineAction", false, "Sleep 대기 실패");
+                std::this_thread::sleep_for(std::chrono::milliseconds(40));
+                if (!AssertEqual("대기 완료", NodeStatus::SUCCESS, nap_tree->Execute(nap_context)))
+                    return TestResult("TestCoroutineAction", false, "Sleep 후 재개 실패");
+
+                // future 대기: 준비될 때까지 RUNNING, 준비되면 값을 받아 계속
+                std::promise<int> path_length;
+                auto              query = std::make_shared<CoAction>(
+                    "query",
+                    [&](Context&) -> CoTask
+                    {
+                        int length = co_await path_length.get_future();
+                        co_return length == 7 ? NodeStatus::SUCCESS : NodeStatus::FAILURE;
+                    });
+                Context query_context;
+                query->SetId(0);
+                if (!AssertEqual("future 대기", NodeStatus::RUNNING, query->Tick(query_context)) ||
+                    !AssertEqual("future 계속 대기", NodeStatus::RUNNING, query->Tick(query_context)))
+                    return TestResult("TestCoroutineAction", false, "future 대기 실패");
+                path_length.set_value(7);
+                if (!AssertEqual("future 결과", NodeStatus::SUCCESS, query->Tick(query_context)))
+                    return TestResult("TestCoroutineAction", false, "future 결과 전달 실패");
+
+                std::cout << "  ✓ 코루틴 Action 테스트 통과\n";
+                return TestResult("TestCoroutineAction", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestCoroutineAction", false, std::string("예외 발생: ") + e.what());
+            }
+#else
+            std::cout << "  - C++20 코루틴을 지원하지 않는 빌드, 건너뜀\n";
+            return TestResult("TestCoroutineAction", true);
+#endif
+        }
+
+        TestResult BehaviorTreeTestSuite::TestHaltPropagation()
+        {
+            std::cout << "테스트: 실행 중 경로 중단\n";
+
+            try
+            {
+                for (bool compiled : {false, true})
+                {
+                    const std::string mode = compiled ? "컴파일 " : "그래프 ";
+
+                    // Selector[alert?, Sequence[ok?, patrol], idle]: alert가 통과하면 실행 중인 patrol만 중단
+                    bool alert  = false;
+                    auto patrol = std::make_shared<TestHaltingAction>("patrol");
+                    auto idle   = std::make_shared<TestHaltingAction>("idle");
+                    auto branch = std::make_shared<Sequence>("patrol_branch");
+                    branch->AddChild(MakeCondition("ok", [](Context&) { return true; }));
+                    branch->AddChild(patrol);
+                    auto root = std::make_shared<Selector>("root");
+                    root->AddChild(MakeCondition("alert", [&alert](Context&) { return alert; }));
+                    root->AddChild(branch);
+                    root->AddChild(idle);
+                    auto tree = std::make_shared<Tree>("halt_tree");
+                    tree->SetRoot(root);
+                    if (compiled)
+                    {
+                        tree->Compile();
+                    }
+
+                    Context context;
+                    tree->Execute(context);
+                    tree->Execute(context);
+                    if (!AssertEqual(mode + "patrol 실행", 2, patrol->GetExecuteCount()) ||
+                        !AssertEqual(mode + "실행 중에는 중단 안 함", 0, patrol->GetHaltCount()))
+                        return TestResult("TestHaltPropagation", false, "실행 중인 자식을 중단함");
+
+                    alert = true;
+                    if (!AssertEqual(mode + "우선 분기 성공", NodeStatus::SUCCESS, tree->Execute(context)) ||
+                        !AssertEqual(mode + "patrol 중단", 1, patrol->GetHaltCount()) ||
+                        !AssertFalse(mode + "patrol 상태 리셋",
+                                     context.GetNodeState(patrol->GetId()).is_running) ||
+                        !AssertEqual(mode + "실행하지 않은 노드는 중단 안 함", 0, idle->GetHaltCount()))
+                        return TestResult("TestHaltPropagation", false, "분기 전환 시 중단 실패");
+
+                    // 이미 중단된 경로는 다시 중단하지 않는다
+                    tree->Execute(context);
+                    if (!AssertEqual(mode + "중복 중단 없음", 1, patrol->GetHaltCount()))
+                        return TestResult("TestHaltPropagation", false, "중단이 반복됨");
+
+                    // Sequence의 앞선 조건이 실패하면 실행 중인 뒤쪽 자식 중단
+                    bool ready = true;
+                    auto work  = std::make_shared<TestHaltingAction>("work");
+                    auto seq   = std::make_shared<Sequence>("seq");
+                    seq->AddChild(MakeCondition("ready", [&ready](Context&) { return ready; }));
+                    seq->AddChild(work);
+                    auto seq_tree = std::make_shared<Tree>("halt_seq_tree");
+                    seq_tree->SetRoot(seq);
+                    if (compiled)
+                    {
+                        seq_tree->Compile();
+                    }
+
+                    Context seq_context;
+                    seq_tree->Execute(seq_context);
+                    ready = false;
+                    if (!AssertEqual(mode + "조건 실패", NodeStatus::FAILURE, seq_tree->Execute(seq_context)) ||
+                        !AssertEqual(mode + "work 중단", 1, work->GetHaltCount()))
+                        return TestResult("TestHaltPropagation", false, "Sequence 중단 실패");
+
+                    // Timeout 만료 시 실행 중인 자식 중단
+                    auto slow    = std::make_shared<TestHaltingAction>("slow");
+                    auto timeout = std::make_shared<Timeout>("timeout", std::chrono::milliseconds(20));
+                    timeout->AddChild(slow);
+                    auto timeout_tree = std::make_shared<Tree>("halt_timeout_tree");
+                    timeout_tree->SetRoot(timeout);
+                    if (compiled)
+                    {
+                        timeout_tree->Compile();
+                    }
+
+                    Context timeout_context;
+                    timeout_tree->Execute(timeout_context);
+                    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+                    if (!AssertEqual(mode + "시간 초과", NodeStatus::FAILURE, timeout_tree->Execute(timeout_context)) ||
+                        !AssertEqual(mode + "slow 중단", 1, slow->GetHaltCount()))
+                        return TestResult("TestHaltPropagation", false, "Timeout 중단 실패");
+
+                    // 트리 단위 중단 (실행 중인 에이전트를 외부에서 멈춤)
+                    timeout_tree->Execute(timeout_context);
+                    timeout_tree->Halt(timeout_context);
+                    if (!AssertEqual(mode + "트리 중단", 2, slow->GetHaltCount()) ||
+                        !AssertFalse(mode + "트리 상태", timeout_tree->IsRunning(timeout_context)))
+                        return TestResult("TestHaltPropagation", false, "트리 중단 실패");
+                }
+
+                std::cout << "  ✓ 실행 중 경로 중단 테스트 통과\n";
+                return TestResult("TestHaltPropagation", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestHaltPropagation", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestConditionMemo()
+        {
+            std::cout << "테스트: 순수 조건 결과 캐시\n";
+
+            try
+            {
+                for (bool compiled : {false, true})
+                {
+                    const std::string mode = compiled ? "컴파일 " : "그래프 ";
+
+                    // Selector[Sequence[has_target, fail], Sequence[has_target, retarget, has_target, ok]]
+                    int  checks       = 0;
+                    auto make_checker = [&checks](const std::string& name)
+                    {
+                        auto condition = MakeCondition(name,
+                                                       [&checks](Context& context)
+                                                       {
+                                                           checks++;
+                                                           return context.GetBlackboard().GetDataAs<int>("target") != 0;
+                                                       });
+                        condition->DeclarePure("test_has_target", {"target"});
+                        return condition;
+                    };
+                    bool retarget = false;
+                    auto attack   = std::make_shared<Sequence>("attack");
+                    attack->AddChild(make_checker("has_target_attack"));
+                    attack->AddChild(std::make_shared<TestFailureAction>("out_of_range"));
+                    auto chase = std::make_shared<Sequence>("chase");
+                    chase->AddChild(make_checker("has_target_chase"));
+                    chase->AddChild(MakeAction("retarget",
+                                               [&retarget](Context& context)
+                                               {
+                                                   if (retarget)
+                                                       context.GetBlackboard().SetData("target", 2);
+                                                   context.GetBlackboard().SetData("unrelated", 1);
+                                                   return NodeStatus::SUCCESS;
+                                               }));
+                    chase->AddChild(make_checker("has_target_recheck"));
+                    auto root = std::make_shared<Selector>("root");
+                    root->AddChild(attack);
+                    root->AddChild(chase);
+                    auto tree = std::make_shared<Tree>("memo_tree");
+                    tree->SetRoot(root);
+                    if (compiled)
+                    {
+                        tree->Compile();
+                    }
+
+                    Context context;
+                    context.GetBlackboard().SetData("target", 1);
+                    if (!AssertEqual(mode + "첫 틱", NodeStatus::SUCCESS, tree->Execute(context)) ||
+                        !AssertEqual(mode + "한 틱에 한 번 계산", 1, checks))
+                        return TestResult("TestConditionMemo", false, "같은 틱의 결과를 재사용하지 않음");
+
+                    tree->Execute(context);
+                    if (!AssertEqual(mode + "다음 틱 재계산", 2, checks))
+                        return TestResult("TestConditionMemo", false, "틱이 바뀌어도 캐시가 남음");
+
+                    // 선언한 키가 틱 중간에 쓰이면 다시 계산
+                    retarget = true;
+                    tree->Execute(context);
+                    if (!AssertEqual(mode + "키 쓰기 후 재계산", 4, checks))
+                        return TestResult("TestConditionMemo", false, "의존 키 쓰기로 무효화되지 않음");
+
+                    // 트리 밖에서 직접 실행하면 캐시하지 않음
+                    make_checker("direct")->Execute(context);
+                    if (!AssertEqual(mode + "직접 실행", 5, checks))
+                        return TestResult("TestConditionMemo", false, "직접 실행 결과가 캐시됨");
+                }
+
+                std::cout << "  ✓ 순수 조건 결과 캐시 테스트 통과\n";
+                return TestResult("TestConditionMemo", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestConditionMemo", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestTypedAgent()
+        {
+            std::cout << "테스트: 타입 지정 에이전트 참조\n";
+
+            try
+            {
+                struct Goblin
+                {
+                    int hits = 0;
+                };
+                struct Orc
+                {
+                    int hits = 0;
+                };
+                class Hit : public AgentNode<Goblin>
+                {
+                public:
+                    Hit() : AgentNode("hit", NodeType::ACTION) {}
+
+                protected:
+                    NodeStatus ExecuteAgent(Goblin& goblin, Context&) override
+                    {
+                        goblin.hits++;
+                        return NodeStatus::SUCCESS;
+                    }
+                };
+
+                auto    hit = std::make_shared<Hit>();
+                Context context;
+                if (!AssertEqual("에이전트 없음", NodeStatus::FAILURE, hit->Execute(context)))
+                    return TestResult("TestTypedAgent", false, "에이전트 없이 실행됨");
+
+                Goblin goblin;
+                context.SetAgent(&goblin);
+                if (!AssertEqual("에이전트 실행", NodeStatus::SUCCESS, hit->Execute(context)) ||
+                    !AssertEqual("에이전트 참조 전달", 1, goblin.hits) ||
+                    !AssertTrue("같은 타입 조회", context.GetAgent<Goblin>() == &goblin))
+                    return TestResult("TestTypedAgent", false, "에이전트 참조 전달 실패");
+
+                Orc orc;
+                context.SetAgent(&orc);
+                if (!AssertEqual("다른 타입 에이전트", NodeStatus::FAILURE, hit->Execute(context)) ||
+                    !AssertTrue("다른 타입 조회", context.GetAgent<Goblin>() == nullptr) ||
+                    !AssertEqual("다른 에이전트는 그대로", 1, goblin.hits))
+                    return TestResult("TestTypedAgent", false, "타입이 다른 에이전트가 전달됨");
+
+                std::cout << "  ✓ 타입 지정 에이전트 참조 테스트 통과\n";
+                return TestResult("TestTypedAgent", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestTypedAgent", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestSeededSelectors()
+        {
+            std::cout << "테스트: 시드 난수와 가중치/유틸리티 Selector\n";
+
+            try
+            {
+                Rng a(7), b(7), c(8);
+                bool same = true, differs = false, in_range = true;
+                for (int i = 0; i < 64; ++i)
+                {
+                    uint32_t x = a.Next();
+                    same       = same && x == b.Next();
+                    differs    = differs || x != c.Next();
+                    in_range   = in_range && a.NextBelow(3) < 3 && a.NextFloat() < 1.0f;
+                    b.NextBelow(3);
+                    b.NextFloat();
+                }
+                if (!AssertTrue("같은 시드 같은 수열", same) || !AssertTrue("다른 시드 다른 수열", differs) ||
+                    !AssertTrue("범위", in_range))
+                    return TestResult("TestSeededSelectors", false, "Rng 수열 오류");
+
+                // Random: 같은 시드면 그래프/컴파일 실행 모두 같은 선택 순서
+                for (bool compiled : {false, true})
+                {
+                    std::string mode = compiled ? "[컴파일] " : "[그래프] ";
+                    std::string picks;
+                    auto        random = std::make_shared<Random>("random");
+                    for (char label : {'a', 'b', 'c'})
+                    {
+                        random->AddChild(MakeAction(std::string(1, label),
+                                                    [&picks, label](Context&)
+                                                    {
+                                                        picks += label;
+                                                        return NodeStatus::SUCCESS;
+                                                    }));
+                    }
+                    auto tree = std::make_shared<Tree>("random_tree");
+                    tree->SetRoot(random);
+                    if (compiled)
+                    {
+                        tree->Compile();
+                    }
+
+                    auto run = [&](uint64_t seed)
+                    {
+                        picks.clear();
+                        Context context;
+                        context.SeedRandom(seed);
+                        for (int i = 0; i < 32; ++i)
+                        {
+                            tree->Execute(context);
+                        }
+                        return picks;
+                    };
+                    std::string first = run(42);
+                    if (!AssertEqual(mode + "재현", first, run(42)) ||
+                        !AssertTrue(mode + "시드별 차이", first != run(43)) ||
+                        !AssertTrue(mode + "모든 자식 선택", first.find('a') != std::string::npos &&
+                                                                first.find('b') != std::string::npos &&
+                                                                first.find('c') != std::string::npos))
+                        return TestResult("TestSeededSelectors", false, "Random 선택이 시드로 재현되지 않음");
+                }
+
+                // WeightedRandomSelector: 가중치 0은 뽑지 않고, 실패하면 남은 자식을 뽑는다
+                int  zero_runs = 0, fail_runs = 0, fallback_runs = 0;
+                auto weighted =
+                    std::make_shared<WeightedRandomSelector>("weighted", std::vector<float>{0.0f, 5.0f, 1.0f});
+                weighted->AddChild(MakeAction("zero",
+                                              [&zero_runs](Context&)
+                                              {
+                                                  zero_runs++;
+                                                  return NodeStatus::SUCCESS;
+                                              }));
+                weighted->AddChild(MakeAction("fail",
+                                              [&fail_runs](Context&)
+                                              {
+                                                  fail_runs++;
+                                                  return NodeStatus::FAILURE;
+                                              }));
+                weighted->AddChild(MakeAction("fallback",
+                                              [&fallback_runs](Context&)
+                                              {
+                                                  fallback_runs++;
+                                                  return NodeStatus::SUCCESS;
+                                              }));
+                Tree weighted_tree("weighted_tree");
+                weighted_tree.SetRoot(weighted);
+                Context weighted_context;
+                weighted_context.SeedRandom(1);
+                bool all_success = true;
+                for (int i = 0; i < 50; ++i)
+                {
+                    all_success = all_success && weighted_tree.Execute(weighted_context) == NodeStatus::SUCCESS;
+                }
+                if (!AssertTrue("남은 자식으로 성공", all_success) || !AssertEqual("가중치 0", 0, zero_runs) ||
+                    !AssertEqual("대체 자식 실행", 50, fallback_runs) ||
+                    !AssertTrue("가중치 높은 자식 먼저", fail_runs > 25))
+                    return TestResult("TestSeededSelectors", false, "가중치 선택 오류");
+
+                // 실행 중인 자식은 다시 뽑지 않고 재개
+                auto resumed = std::make_shared<WeightedRandomSelector>("resumed");
+                auto left    = std::make_shared<TestHaltingAction>("left");
+                auto right   = std::make_shared<TestHaltingAction>("right");
+                resumed->AddChild(left);
+                resumed->AddChild(right);
+                Tree resumed_tree("resumed_tree");
+                resumed_tree.SetRoot(resumed);
+                Context resumed_context;
+                for (int i = 0; i < 20; ++i)
+                {
+                    resumed_tree.Execute(resumed_context);
+                }
+                if (!AssertTrue("한 자식만 재개", (left->GetExecuteCount() == 20 && right->GetExecuteCount() == 0) ||
+                                                      (left->GetExecuteCount() == 0 && right->GetExecuteCount() == 20)))
+                    return TestResult("TestSeededSelectors", false, "실행 중인 자식을 재개하지 않음");
+
+                // UtilitySelector: 점수 순으로 시도, 선택이 바뀌면 실행 중이던 자식 중단
+                float scores[3]   = {1.0f, 3.0f, 0.0f};
+                int   scorer_runs = 0;
+                auto  utility     = std::make_shared<UtilitySelector>("utility",
+                                                                 [&](Context&, float* out, size_t count)
+                                                                 {
+                                                                     scorer_runs++;
+                                                                     for (size_t i = 0; i < count; ++i)
+                                                                         out[i] = scores[i];
+                                                                 });
+                auto flee         = std::make_shared<TestHaltingAction>("flee");
+                auto fight        = std::make_shared<TestFailureAction>("fight");
+                auto idle         = std::make_shared<TestSuccessAction>("idle");
+                utility->AddChild(flee);
+                utility->AddChild(fight);
+                utility->AddChild(idle);
+                Tree utility_tree("utility_tree");
+                utility_tree.SetRoot(utility);
+                Context utility_context;
+                if (!AssertEqual("점수 순 시도", NodeStatus::RUNNING, utility_tree.Execute(utility_context)) ||
+                    !AssertEqual("한 번에 점수 계산", 1, scorer_runs) ||
+                    !AssertEqual("도망 실행", 1, flee->GetExecuteCount()))
+                    return TestResult("TestSeededSelectors", false, "유틸리티 선택 오류");
+
+                scores[2] = 5.0f;
+                if (!AssertEqual("점수 변경", NodeStatus::SUCCESS, utility_tree.Execute(utility_context)) ||
+                    !AssertEqual("실행 중이던 자식 중단", 1, flee->GetHaltCount()) ||
+                    !AssertEqual("중단된 자식은 다시 실행하지 않음", 1, flee->GetExecuteCount()))
+                    return TestResult("TestSeededSelectors", false, "유틸리티 선점 오류");
+
+                scores[0] = scores[1] = scores[2] = 0.0f;
+                if (!AssertEqual("후보 없음", NodeStatus::FAILURE, utility_tree.Execute(utility_context)))
+                    return TestResult("TestSeededSelectors", false, "점수 0 이하 자식을 실행함");
+
+                // 데이터 기반 정의
+                NodeRegistry registry;
+                NodeParams   params;
+                params.Set("weights", std::string("3, 1,1"));
+                auto loaded = std::dynamic_pointer_cast<WeightedRandomSelector>(
+                    registry.Find("WeightedRandomSelector")->factory("loaded", params));
+                params.Set("weights", std::string("3,x"));
+                std::vector<float> expected_weights = {3.0f, 1.0f, 1.0f};
+                if (!AssertTrue("가중치 파싱", loaded && loaded->GetWeights() == expected_weights) ||
+                    !AssertTrue("잘못된 가중치 거부", !registry.Find("WeightedRandomSelector")->factory("bad", params)))
+                    return TestResult("TestSeededSelectors", false, "가중치 파라미터 오류");
+
+                std::cout << "  ✓ 시드 난수와 가중치/유틸리티 Selector 테스트 통과\n";
+                return TestResult("TestSeededSelectors", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestSeededSelectors", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestTimeDecorators()
+        {
+            std::cout << "테스트: 프레임 시각 기반 시간 노드\n";
+
+            try
+            {
+                for (bool compiled : {false, true})
+                {
+                    const std::string mode  = compiled ? "[컴파일] " : "[그래프] ";
+                    const auto        start = std::chrono::steady_clock::now();
+
+                    // 시각은 SetFrameTime으로만 진행 (실제 시간과 무관)
+                    auto run = [&](Tree& tree, Context& context, int ms)
+                    {
+                        context.SetFrameTime(start + std::chrono::milliseconds(ms));
+                        return tree.Execute(context);
+                    };
+                    auto make_tree = [&](const std::string& name, std::shared_ptr<Node> root)
+                    {
+                        auto tree = std::make_shared<Tree>(name);
+                        tree->SetRoot(std::move(root));
+                        if (compiled)
+                        {
+                            tree->Compile();
+                        }
+                        return tree;
+                    };
+
+                    // Delay: 만료 전에는 깨어날 시각만 알리고, 자식이 실행 중인 동안은 다시 지연하지 않는다
+                    auto delay = std::make_shared<Delay>("delay", std::chrono::milliseconds(30));
+                    auto walk  = std::make_shared<TestHaltingAction>("walk");
+                    delay->AddChild(walk);
+                    auto    delay_tree = make_tree("delay_tree", delay);
+                    Context delay_context;
+                    if (!AssertEqual(mode + "Delay 대기", NodeStatus::RUNNING, run(*delay_tree, delay_context, 0)) ||
+                        !AssertTrue(mode + "Delay 대기 중 재울 수 있음", delay_tree->CanPark(delay_context)) ||
+                        !AssertTrue(mode + "Delay 깨어날 시각",
+                                    delay_context.GetWakeTime() == start + std::chrono::milliseconds(30)))
+                        return TestResult("TestTimeDecorators", false, "Delay 대기 오류");
+                    run(*delay_tree, delay_context, 29);
+                    run(*delay_tree, delay_context, 30);
+                    run(*delay_tree, delay_context, 31);
+                    if (!AssertEqual(mode + "만료 후 자식 계속 실행", 2, walk->GetExecuteCount()) ||
+                        !AssertFalse(mode + "자식 실행 중에는 재우지 않음", delay_tree->CanPark(delay_context)))
+                        return TestResult("TestTimeDecorators", false, "Delay 만료 처리 오류");
+
+                    // Timeout: 생성 시점이 아니라 처음 실행한 프레임부터 잰다
+                    auto timeout = std::make_shared<Timeout>("timeout", std::chrono::milliseconds(20));
+                    auto dig     = std::make_shared<TestHaltingAction>("dig");
+                    timeout->AddChild(dig);
+                    auto    timeout_tree = make_tree("timeout_tree", timeout);
+                    Context timeout_ctx;
+                    if (!AssertEqual(mode + "늦게 시작", NodeStatus::RUNNING, run(*timeout_tree, timeout_ctx, 1000)) ||
+                        !AssertEqual(mode + "제한 전", NodeStatus::RUNNING, run(*timeout_tree, timeout_ctx, 1019)) ||
+                        !AssertEqual(mode + "제한 시각", NodeStatus::FAILURE, run(*timeout_tree, timeout_ctx, 1020)) ||
+                        !AssertEqual(mode + "자식 중단", 1, dig->GetHaltCount()))
+                        return TestResult("TestTimeDecorators", false, "Timeout 시간 측정 오류");
+
+                    // Cooldown: 자식이 끝나면 대기시간 동안 실패, 쿨다운 만료가 다른 대기보다 빠르면 그때 깨운다
+                    int  attacks  = 0;
+                    auto cooldown = std::make_shared<Cooldown>("cooldown", std::chrono::milliseconds(50));
+                    cooldown->AddChild(MakeAction("attack",
+                                                  [&attacks](Context&)
+                                                  {
+                                                      attacks++;
+                                                      return NodeStatus::SUCCESS;
+                                                  }));
+                    auto root = std::make_shared<Selector>("root");
+                    root->AddChild(cooldown);
+                    root->AddChild(std::make_shared<Delay>("rest", std::chrono::milliseconds(200)));
+                    auto    cooldown_tree = make_tree("cooldown_tree", root);
+                    Context cooldown_ctx;
+                    if (!AssertEqual(mode + "첫 공격", NodeStatus::SUCCESS, run(*cooldown_tree, cooldown_ctx, 0)) ||
+                        !AssertEqual(mode + "쿨다운 중", NodeStatus::RUNNING, run(*cooldown_tree, cooldown_ctx, 10)) ||
+                        !AssertEqual(mode + "쿨다운 중 공격 안 함", 1, attacks) ||
+                        !AssertTrue(mode + "대기 가능", cooldown_tree->CanPark(cooldown_ctx)) ||
+                        !AssertTrue(mode + "쿨다운 만료에 깨움",
+                                    cooldown_ctx.GetWakeTime() == start + std::chrono::milliseconds(50)))
+                        return TestResult("TestTimeDecorators", false, "Cooldown 대기 오류");
+                    if (!AssertEqual(mode + "쿨다운 만료", NodeStatus::SUCCESS, run(*cooldown_tree, cooldown_ctx, 50)) ||
+                        !AssertEqual(mode + "다시 공격", 2, attacks))
+                        return TestResult("TestTimeDecorators", false, "Cooldown 만료 오류");
+                }
+
+                std::cout << "  ✓ 프레임 시각 기반 시간 노드 테스트 통과\n";
+                return TestResult("TestTimeDecorators", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestTimeDecorators", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestAgentArena()
+        {
+            std::cout << "테스트: 에이전트 아레나\n";
+
+            try
+            {
+                // 해제된 블록은 같은 크기 구간의 다음 할당에 재사용
+                AgentArena arena(4096);
+                void*      first = arena.allocate(100);
+                arena.deallocate(first, 100);
+                void* second = arena.allocate(120);
+                if (!AssertTrue("같은 구간 재사용", first == second) ||
+                    !AssertTrue("청크 안", arena.Contains(second)) ||
+                    !AssertEqual("사용 중 바이트", size_t(128), arena.GetBytesInUse()))
+                    return TestResult("TestAgentArena", false, "블록 재사용 오류");
+                arena.deallocate(second, 120);
+
+                // 컨텍스트의 상태 블록과 블랙보드 슬롯이 아레나에 모인다
+                AgentArenaPool pool(4096);
+                auto           tree = std::make_shared<Tree>("arena_tree");
+                auto           root = std::make_shared<Sequence>("root");
+                root->AddChild(MakeAction("remember",
+                                          [](Context& context)
+                                          {
+                                              context.SetData("arena_value", 7);
+                                              return NodeStatus::SUCCESS;
+                                          }));
+                root->AddChild(std::make_shared<TestRunningAction>("wait", 100));
+                tree->SetRoot(root);
+
+                AgentArena* recycled_arena = nullptr;
+                size_t      chunk_count    = 0;
+                {
+                    Context context(pool.Acquire());
+                    recycled_arena = context.GetArena();
+                    tree->Execute(context);
+                    if (!AssertTrue("상태 블록", recycled_arena->Contains(&context.GetNodeState(0))) ||
+                        !AssertTrue("사용 중", recycled_arena->GetBytesInUse() > 0) ||
+                        !AssertEqual("블랙보드 값", 7, context.GetDataAs<int>("arena_value")))
+                        return TestResult("TestAgentArena", false, "컨텍스트 할당 위치 오류");
+#ifdef BT_HAS_COROUTINES
+                    size_t before = recycled_arena->GetBytesInUse();
+                    auto   co     = std::make_shared<CoAction>("co",
+                                                         [](Context&) -> CoTask
+                                                         {
+                                                             co_await NextTick();
+                                                             co_return NodeStatus::SUCCESS;
+                                                         });
+                    co->Execute(context);
+                    if (!AssertTrue("코루틴 프레임 청크",
+                                    recycled_arena->GetBytesInUse() >= before + FrameArena::kChunkSize))
+                        return TestResult("TestAgentArena", false, "코루틴 프레임이 아레나 밖에 할당됨");
+#endif
+                    chunk_count = recycled_arena->GetChunkCount();
+                }
+
+                // 컨텍스트가 사라지면 아레나는 비워져 풀로 돌아가고, 다음 에이전트가 청크째 재사용한다
+                if (!AssertEqual("풀로 반환", size_t(1), pool.GetFreeCount()) ||
+                    !AssertEqual("반환 시 비움", size_t(0), recycled_arena->GetBytesInUse()))
+                    return TestResult("TestAgentArena", false, "아레나 반환 오류");
+                {
+                    Context context(pool.Acquire());
+                    tree->Execute(context);
+                    if (!AssertTrue("같은 아레나 재사용", context.GetArena() == recycled_arena) ||
+                        !AssertEqual("청크 추가 없음", chunk_count, recycled_arena->GetChunkCount()) ||
+                        !AssertEqual("재사용 횟수", size_t(1), pool.GetReuseCount()))
+                        return TestResult("TestAgentArena", false, "아레나 재사용 오류");
+                }
+
+                std::cout << "  ✓ 에이전트 아레나 테스트 통과\n";
+                return TestResult("TestAgentArena", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestAgentArena", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestBatchExecution()
+        {
+            std::cout << "테스트: 같은 트리 에이전트 배치 실행\n";
+
+            try
+            {
+                constexpr int kAgents = 100;
+                constexpr int kFrames = 30;
+
+                // 프레임마다 에이전트별로 다른 값 (두 실행 방식에 같은 값을 넣는다)
+                auto set_frame = [](MockAIExecutor& ai, int index, int frame)
+                {
+                    ai.SetDistanceToTarget(static_cast<float>((index * 7 + frame * 3) % 10));
+                    ai.SetHealth(20 + (index * 13 + frame * 5) % 80);
+                };
+
+                for (ExecutionMode mode : {ExecutionMode::REACTIVE, ExecutionMode::MEMORY})
+                {
+                    const std::string label = mode == ExecutionMode::MEMORY ? "[메모리] " : "[반응형] ";
+
+                    auto in_range = std::make_shared<TestBatchInRangeCondition>("in_range", 5.0f);
+                    in_range->DeclarePure("batch_in_range");
+                    auto attack = std::make_shared<Sequence>("attack");
+                    attack->AddChild(in_range);
+                    attack->AddChild(MakeCondition("healthy",
+                                                   [](Context& context)
+                                                   { return context.GetAgent<MockAIExecutor>()->GetHealth() > 30; }));
+                    auto calm = std::make_shared<Invert>("calm");
+                    calm->AddChild(MakeCondition("furious",
+                                                 [](Context& context)
+                                                 { return context.GetAgent<MockAIExecutor>()->GetHealth() > 90; }));
+                    attack->AddChild(calm);
+                    attack->AddChild(MakeAction("strike",
+                                                [](Context& context)
+                                                {
+                                                    int strikes = ++context.GetAgent<MockAIExecutor>()->action_count_;
+                                                    return strikes % 3 ? NodeStatus::RUNNING : NodeStatus::SUCCESS;
+                                                }));
+
+                    auto patrol = std::make_shared<Sequence>("patrol");
+                    auto steps  = std::make_shared<Repeat>("steps", 2);
+                    steps->AddChild(MakeAction("step",
+                                               [](Context& context)
+                                               {
+                                                   int step = ++context.GetAgent<MockAIExecutor>()->condition_count_;
+                                                   return step % 2 ? NodeStatus::RUNNING : NodeStatus::SUCCESS;
+                                               }));
+                    patrol->AddChild(steps);
+                    patrol->AddChild(std::make_shared<TestSuccessAction>("rest"));
+
+                    auto root = std::make_shared<Selector>("root");
+                    root->AddChild(attack);
+                    root->AddChild(patrol);
+                    auto tree = std::make_shared<Tree>("batch_tree");
+                    tree->SetRoot(root);
+                    tree->SetExecutionMode(mode);
+                    tree->Compile();
+
+                    // 한 명씩 실행한 결과와 배치 실행 결과를 매 프레임 비교
+                    std::vector<std::shared_ptr<MockAIExecutor>> single;
+                    std::vector<std::shared_ptr<MockAIExecutor>> batched;
+                    std::vector<Context*>                        contexts;
+                    for (int i = 0; i < kAgents; ++i)
+                    {
+                        single.push_back(CreateMockAI("single_" + std::to_string(i)));
+                        batched.push_back(CreateMockAI("batched_" + std::to_string(i)));
+                        single.back()->GetContext().SetAgent(single.back().get());
+                        batched.back()->GetContext().SetAgent(batched.back().get());
+                        contexts.push_back(&batched.back()->GetContext());
+                    }
+
+                    std::vector<NodeStatus>    statuses(kAgents);
+                    CompiledTree::BatchScratch scratch;
+                    int                        single_calls = 0;
+                    for (int frame = 0; frame < kFrames; ++frame)
+                    {
+                        std::vector<NodeStatus> expected;
+                        int                     before = in_range->GetBatchCalls();
+                        for (int i = 0; i < kAgents; ++i)
+                        {
+                            set_frame(*single[i], i, frame);
+                            expected.push_back(tree->Execute(single[i]->GetContext()));
+                        }
+                        single_calls += in_range->GetBatchCalls() - before;
+
+                        for (int i = 0; i < kAgents; ++i)
+                        {
+                            set_frame(*batched[i], i, frame);
+                        }
+                        tree->ExecuteBatch(contexts.data(), contexts.size(), statuses.data(), scratch);
+
+                        for (int i = 0; i < kAgents; ++i)
+                        {
+                            Context& a = single[i]->GetContext();
+                            Context& b = batched[i]->GetContext();
+                            bool     same =
+                                expected[i] == statuses[i] &&
+                                single[i]->action_count_.load() == batched[i]->action_count_.load() &&
+                                single[i]->condition_count_.load() == batched[i]->condition_count_.load();
+                            for (size_t id = 0; same && id < tree->GetNodeCount(); ++id)
+                            {
+                                const NodeState& x = a.GetNodeState(static_cast<uint32_t>(id));
+                                const NodeState& y = b.GetNodeState(static_cast<uint32_t>(id));
+                                same = x.last_status == y.last_status && x.is_running == y.is_running &&
+                                       x.child_index == y.child_index && x.counter == y.counter;
+                            }
+                            if (!AssertTrue(label + "한 명씩 실행과 같은 결과", same))
+                                return TestResult("TestBatchExecution",
+                                                  false,
+                                                  label + "프레임 " + std::to_string(frame) + ", 에이전트 " +
+                                                      std::to_string(i) + " 결과 불일치");
+                        }
+                    }
+
+                    // 배치 조건은 노드 방문마다 블록(64명)당 한 번만 호출된다
+                    int batch_calls = in_range->GetBatchCalls() - single_calls;
+                    if (!AssertTrue(label + "배치 호출 수",
+                                    batch_calls <= kFrames * 2 * 2 && single_calls > batch_calls))
+                        return TestResult("TestBatchExecution", false, label + "배치 조건 호출 횟수 오류");
+                }
+
+                // 엔진 배치 틱: 트리별로 묶어 스레드 풀에서 실행해도 TickAll과 결과가 같다
+                Engine engine;
+                engine.SetThreadCount(2);
+                engine.SetBatchGrain(16);
+                std::vector<std::shared_ptr<Tree>> trees;
+                for (const char* name : {"batch_a", "batch_b"})
+                {
+                    auto root = std::make_shared<Selector>(std::string(name) + "_root");
+                    root->AddChild(std::make_shared<TestBatchInRangeCondition>("near", 3.0f));
+                    root->AddChild(MakeAction("wait",
+                                              [](Context& context)
+                                              {
+                                                  int count = ++context.GetAgent<MockAIExecutor>()->action_count_;
+                                                  return count % 2 ? NodeStatus::RUNNING : NodeStatus::FAILURE;
+                                              }));
+                    trees.push_back(std::make_shared<Tree>(name));
+                    trees.back()->SetRoot(root);
+                    trees.back()->Compile();
+                }
+
+                std::vector<std::shared_ptr<IExecutor>> ticked;
+                std::vector<std::shared_ptr<IExecutor>> batched;
+                for (int i = 0; i < 200; ++i)
+                {
+                    for (auto* executors : {&ticked, &batched})
+                    {
+                        auto ai = CreateMockAI("engine_" + std::to_string(i));
+                        ai->SetBehaviorTree(trees[i % 2]);
+                        ai->SetDistanceToTarget(static_cast<float>(i % 6));
+                        executors->push_back(ai);
+                    }
+                }
+
+                const auto now = std::chrono::steady_clock::now();
+                for (int frame = 0; frame < 5; ++frame)
+                {
+                    std::vector<size_t> order;
+                    engine.TickAll(ticked, 0.016f, now);
+                    engine.TickAllBatched(batched, 0.016f, now,
+                                          [&](size_t index, IExecutor&) { order.push_back(index); });
+                    if (!AssertEqual("commit 호출 수", batched.size(), order.size()) ||
+                        !AssertTrue("commit 순서", std::is_sorted(order.begin(), order.end())))
+                        return TestResult("TestBatchExecution", false, "엔진 배치 틱 commit 오류");
+                }
+                for (size_t i = 0; i < batched.size(); ++i)
+                {
+                    auto tree = batched[i]->GetBehaviorTree();
+                    if (!AssertEqual("실행 횟수", uint64_t(5), batched[i]->GetContext().GetExecutionCount()) ||
+                        !AssertEqual("결과",
+                                     tree->GetLastStatus(ticked[i]->GetContext()),
+                                     tree->GetLastStatus(batched[i]->GetContext())))
+                        return TestResult("TestBatchExecution", false, "엔진 배치 틱 결과 불일치");
+                }
+
+                std::cout << "  ✓ 배치 실행 테스트 통과\n";
+                return TestResult("TestBatchExecution", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestBatchExecution", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        // 메인 테스트 실행 함수
+        void RunBehaviorTreeTests()
+        {
+            BehaviorTreeTestSuite test_suite;
+            auto                  results = test_suite.RunAllTests();
+            test_suite.PrintTestResults(results);
+        }
+
+        TestResult BehaviorTreeTestSuite::TestTraceReplay()
+        {
+            std::cout << "테스트: 실행 추적 기록/재생\n";
+#ifdef BT_DISABLE_TRACING
+            std::cout << "  - BT_DISABLE_TRACING으로 빌드되어 건너뜀\n";
+            return TestResult("TestTraceReplay", true);
+#endif
+
+            try
+            {
+                // root(Selector) → [combat(Sequence) → has_target, attack_cd(Cooldown) → swing(2틱 RUNNING)],
+                //                  idle(WeightedRandomSelector) → wander, rest
+                BlackboardKey<int> target_key("trace_target");
+                BlackboardKey<int> swing_key("trace_swing");
+                auto               build = [&](bool compile)
+                {
+                    auto tree     = std::make_shared<Tree>("traced tree");
+                    auto root     = std::make_shared<Selector>("root");
+                    auto combat   = std::make_shared<Sequence>("combat");
+                    auto cooldown = std::make_shared<Cooldown>("attack_cd", std::chrono::milliseconds(120));
+                    auto idle     = std::make_shared<WeightedRandomSelector>("idle", std::vector<float>{1.0f, 3.0f});
+                    combat->AddChild(MakeCondition("has_target",
+                                                   [&](Context& context) { return context.Get(target_key) != 0; }));
+                    cooldown->AddChild(MakeAction("swing",
+                                                  [&](Context& context)
+                                                  {
+                                                      int swing = context.Get(swing_key) + 1;
+                                                      context.Set(swing_key, swing % 2);
+                                                      return swing % 2 ? NodeStatus::RUNNING : NodeStatus::SUCCESS;
+                                                  }));
+                    combat->AddChild(cooldown);
+                    idle->AddChild(MakeAction("wander", [](Context&) { return NodeStatus::SUCCESS; }));
+                    idle->AddChild(MakeAction("rest", [](Context&) { return NodeStatus::FAILURE; }));
+                    root->AddChild(combat);
+                    root->AddChild(idle);
+                    tree->SetRoot(root);
+                    tree->SetExecutionMode(ExecutionMode::MEMORY);
+                    if (compile)
+                    {
+                        tree->Compile();
+                    }
+                    return tree;
+                };
+
+                // 에이전트 8명 x 40틱, 프레임마다 50ms (타겟은 에이전트/틱마다 바뀐다)
+                const int kAgents = 8;
+                const int kTicks  = 40;
+                auto      run     = [&](Tree& tree)
+                {
+                    std::vector<std::unique_ptr<Context>> contexts;
+                    for (int i = 0; i < kAgents; ++i)
+                    {
+                        contexts.push_back(std::make_unique<Context>());
+                        contexts.back()->SetAgentId(100 + i);
+                        contexts.back()->SeedRandom(i);
+                    }
+                    auto now = std::chrono::steady_clock::now();
+                    for (int tick = 0; tick < kTicks; ++tick)
+                    {
+                        now += std::chrono::milliseconds(50);
+                        for (int i = 0; i < kAgents; ++i)
+                        {
+                            contexts[i]->Set(target_key, (tick / (i + 2)) % 2);
+                            contexts[i]->SetFrameTime(now);
+                            tree.Execute(*contexts[i]);
+                        }
+                    }
+                };
+
+                for (bool compile : {false, true})
+                {
+                    const std::string label = compile ? "[컴파일] " : "[그래프] ";
+                    auto              tree  = build(compile);
+
+                    // 3틱에 한 번 기록
+                    auto recorder = std::make_shared<TraceRecorder>(3);
+                    tree->SetTraceRecorder(recorder);
+                    run(*tree);
+                    TraceData trace = recorder->Collect();
+
+                    size_t recorded_ticks = 0;
+                    for (const auto& event : trace.events)
+                    {
+                        recorded_ticks += event.type == TraceEventType::TICK_BEGIN;
+                    }
+                    if (!AssertEqual(label + "표본 틱 수", size_t(kAgents * kTicks / 3), recorded_ticks) ||
+                        !AssertEqual(label + "트리 표", std::string("traced tree"), trace.trees.at(0).name) ||
+                        !AssertEqual(label + "노드 이름", std::string("swing"), trace.trees[0].node_names.at(4)) ||
+                        !AssertTrue(label + "기록기 연결", tree->GetTraceRecorder() == recorder))
+                        return TestResult("TestTraceReplay", false, label + "기록 오류");
+
+                    // 파일로 저장/읽기 (형식 왕복)
+                    const std::string path = "bt_trace_test.btt";
+                    trace.Save(path);
+                    TraceData loaded = TraceData::Load(path);
+                    std::remove(path.c_str());
+                    if (!AssertEqual(label + "이벤트 수", trace.events.size(), loaded.events.size()) ||
+                        !AssertTrue(label + "이벤트 내용",
+                                    std::equal(trace.events.begin(),
+                                               trace.events.end(),
+                                               loaded.events.begin(),
+                                               [](const TraceEvent& a, const TraceEvent& b)
+                                               {
+                                                   return a.type == b.type && a.status == b.status &&
+                                                          a.flags == b.flags && a.id == b.id && a.a == b.a &&
+                                                          a.b == b.b;
+                                               })) ||
+                        !AssertEqual(label + "키 이름", std::string("trace_swing"), loaded.keys.at(0).second))
+                        return TestResult("TestTraceReplay", false, label + "파일 왕복 오류");
+
+                    // 재생: 리프 결과만으로 제어 노드가 기록과 같은 경로를 밟는다 (리프는 실행되지 않음)
+                    TraceReplayer replayer(loaded);
+                    if (!AssertTrue(label + "트리 연결", replayer.AddTree(tree)))
+                        return TestResult("TestTraceReplay", false, label + "재생 트리 연결 실패");
+                    TraceReplayReport report = replayer.Run();
+                    if (!AssertEqual(label + "재생 틱", recorded_ticks, report.ticks) ||
+                        !AssertEqual(label + "일치 틱", recorded_ticks, report.matched) ||
+                        !AssertTrue(label + "어긋남 없음", report.divergences.empty()) ||
+                        !AssertEqual(label + "루트 호출", uint64_t(recorded_ticks), report.trees[0].nodes[0].calls) ||
+                        !AssertTrue(label + "루트 self ≤ total",
+                                    report.trees[0].nodes[0].child_cycles <= report.trees[0].nodes[0].total_cycles) ||
+                        !AssertTrue(label + "블랙보드 쓰기", !report.blackboard_writes.empty()) ||
+                        !AssertTrue(label + "재생 후 기록기 복원", tree->GetTraceRecorder() == recorder))
+                    {
+                        if (!report.divergences.empty())
+                            std::cout << "    " << report.divergences[0] << "\n";
+                        return TestResult("TestTraceReplay", false, label + "재생 결과 오류");
+                    }
+                    auto json = report.ToJson();
+                    if (!AssertEqual(label + "JSON 노드 이름", std::string("attack_cd"),
+                                     json["trees"][0]["nodes"][3]["name"].get<std::string>()))
+                        return TestResult("TestTraceReplay", false, label + "재생 보고서 오류");
+
+                    // 기록을 바꾸면 어긋남으로 보고된다 (has_target 결과 뒤집기)
+                    for (auto& event : loaded.events)
+                    {
+                        if (event.type == TraceEventType::NODE && event.id == 2)
+                        {
+                            event.status = event.status == 0 ? 1 : 0;
+                            break;
+                        }
+                    }
+                    TraceReplayer tampered(loaded);
+                    tampered.AddTree(tree);
+                    TraceReplayReport tampered_report = tampered.Run();
+                    if (!AssertEqual(label + "어긋난 틱", recorded_ticks - 1, tampered_report.matched) ||
+                        !AssertEqual(label + "어긋남 설명", size_t(1), tampered_report.divergences.size()))
+                        return TestResult("TestTraceReplay", false, label + "어긋남 검출 오류");
+                }
+
+                // 엔진에 연결하면 등록된 트리에 적용된다. 표본 간격 0이면 기록하지 않는다.
+                // 다른 구조의 트리는 재생 대상이 아니다.
+                auto   tree     = build(false);
+                auto   recorder = std::make_shared<TraceRecorder>(0);
+                Engine engine;
+                engine.RegisterTree("traced", tree);
+                engine.SetTraceRecorder(recorder);
+                run(*tree);
+                TraceReplayer other(recorder->Collect());
+                if (!AssertTrue("엔진 연결", tree->GetTraceRecorder() == recorder) ||
+                    !AssertTrue("간격 0", recorder->Collect().events.empty()) ||
+                    !AssertTrue("다른 트리 연결 안 함", !other.AddTree(std::make_shared<Tree>("traced tree"))))
+                    return TestResult("TestTraceReplay", false, "표본 간격/트리 대조 오류");
+
+                // 손상된 파일
+                bool rejected = false;
+                try
+                {
+                    TraceData::Deserialize({'B', 'T', 'T', '1', TraceData::kVersion, 1, 2});
+                }
+                catch (const TraceError&)
+                {
+                    rejected = true;
+                }
+                if (!AssertTrue("잘린 파일 거부", rejected))
+                    return TestResult("TestTraceReplay", false, "손상된 파일 검사 오류");
+
+                std::cout << "  ✓ 실행 추적 기록/재생 테스트 통과\n";
+                return TestResult("TestTraceReplay", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestTraceReplay", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestSubTree()
+        {
+            std::cout << "테스트: 하위 트리 참조와 트리 합성\n";
+
+            try
+            {
+                // 공유 공격 동작: 체력이 충분하고 사거리 안이면 세 틱에 걸쳐 공격
+                auto in_range    = std::make_shared<TestBatchInRangeCondition>("in_range", 5.0f);
+                auto make_attack = [&]()
+                {
+                    auto attack = std::make_shared<Sequence>("attack_sequence");
+                    attack->AddChild(MakeCondition("healthy",
+                                                   [](Context& context)
+                                                   { return context.GetAgent<MockAIExecutor>()->GetHealth() > 30; }));
+                    attack->AddChild(in_range);
+                    attack->AddChild(MakeAction("strike",
+                                                [](Context& context)
+                                                {
+                                                    int strikes = ++context.GetAgent<MockAIExecutor>()->action_count_;
+                                                    return strikes % 3 ? NodeStatus::RUNNING : NodeStatus::SUCCESS;
+                                                }));
+                    auto tree = std::make_shared<Tree>("monster_attack");
+                    tree->SetRoot(attack);
+                    tree->SetExecutionMode(ExecutionMode::MEMORY);
+                    tree->Compile();
+                    return tree;
+                };
+                auto make_parent =
+                    [](const std::string& name, std::shared_ptr<Node> attack, std::shared_ptr<Node> patrol)
+                    {
+                        auto root = std::make_shared<Selector>(name + "_root");
+                        root->AddChild(attack);
+                        root->AddChild(patrol);
+                        auto tree = std::make_shared<Tree>(name);
+                        tree->SetRoot(root);
+                        tree->SetExecutionMode(ExecutionMode::MEMORY);
+                        return tree;
+                    };
+
+                // 대상보다 먼저 만든 참조는 이름만 기억했다가 대상이 등록된 뒤 링커가 연결한다
+                Engine engine;
+                auto   attack_a = engine.CreateSubTree("attack", "monster_attack");
+                auto   patrol_a = std::make_shared<TestHaltingAction>("patrol");
+                auto   goblin   = make_parent("goblin", attack_a, patrol_a);
+                goblin->Compile();
+                engine.RegisterTree("goblin", goblin);
+                if (!AssertFalse("등록 전 참조는 미연결", attack_a->IsLinked()))
+                    return TestResult("TestSubTree", false, "등록되지 않은 트리에 연결됨");
+
+                engine.RegisterTree("monster_attack", make_attack());
+                auto attack_b = engine.CreateSubTree("attack", engine.GetTreeId("monster_attack"));
+                auto patrol_b = std::make_shared<TestHaltingAction>("patrol");
+                auto orc      = make_parent("orc", attack_b, patrol_b); // 그래프 실행
+                engine.RegisterTree("orc", orc);
+
+                if (!AssertEqual("연결된 참조 수", size_t(2), engine.LinkSubTrees()) ||
+                    !AssertTrue("같은 슬롯 공유",
+                                attack_a->GetSlot() == attack_b->GetSlot() &&
+                                    attack_a->GetSlot() == engine.GetTreeSlot("monster_attack")) ||
+                    !AssertEqual("바깥 트리에는 참조 레코드 하나", size_t(3), goblin->GetCompiled()->GetNodeCount()))
+                    return TestResult("TestSubTree", false, "링크 결과 오류");
+
+                // 두 트리(컴파일/그래프)가 같은 하위 트리를 같은 규칙으로 실행한다
+                struct Step
+                {
+                    float      distance;
+                    NodeStatus expected;
+                    int        halts; // 순찰 중단 횟수
+                };
+                const std::vector<Step> steps = {
+                    {10.0f, NodeStatus::RUNNING, 0}, // 사거리 밖: 순찰
+                    {2.0f, NodeStatus::RUNNING, 1},  // 하위 트리 가드가 순찰을 선점, 공격 시작
+                    {2.0f, NodeStatus::RUNNING, 1},
+                    {2.0f, NodeStatus::SUCCESS, 1},  // 세 번째 공격으로 완료
+                    {2.0f, NodeStatus::RUNNING, 1},
+                    {10.0f, NodeStatus::RUNNING, 1}, // 하위 트리의 가드 실패로 공격 중단, 다시 순찰
+                };
+                std::vector<std::pair<std::shared_ptr<Tree>, std::shared_ptr<TestHaltingAction>>> parents = {
+                    {goblin, patrol_a}, {orc, patrol_b}};
+                std::vector<std::shared_ptr<MockAIExecutor>> agents;
+                for (auto& [tree, patrol] : parents)
+                {
+                    auto ai = CreateMockAI(tree->GetName());
+                    ai->GetContext().SetAgent(ai.get());
+                    ai->SetHealth(100);
+                    agents.push_back(ai);
+                    for (size_t i = 0; i < steps.size(); ++i)
+                    {
+                        ai->SetDistanceToTarget(steps[i].distance);
+                        const std::string label = tree->GetName() + " 틱 " + std::to_string(i);
+                        if (!AssertEqual(label, steps[i].expected, tree->Execute(ai->GetContext())) ||
+                            !AssertEqual(label + " 순찰 중단", steps[i].halts, patrol->GetHaltCount()))
+                            return TestResult("TestSubTree", false, label + " 결과 오류");
+                    }
+                    if (!AssertEqual(tree->GetName() + " 공격 횟수", 4, ai->action_count_.load()))
+                        return TestResult("TestSubTree", false, "하위 트리 실행 횟수 오류");
+                }
+
+                // 하위 트리를 다시 등록하면 이를 쓰는 모든 트리가 다음 틱에 새 버전을 실행한다
+                auto flee = std::make_shared<Tree>("monster_attack");
+                flee->SetRoot(MakeCondition("flee",
+                                            [](Context& context)
+                                            {
+                                                context.GetAgent<MockAIExecutor>()->condition_count_++;
+                                                return true;
+                                            }));
+                flee->Compile();
+                engine.RegisterTree("monster_attack", flee);
+                for (size_t i = 0; i < parents.size(); ++i)
+                {
+                    auto& [tree, patrol] = parents[i];
+                    if (!AssertEqual(tree->GetName() + " 새 버전 결과", NodeStatus::SUCCESS,
+                                     tree->Execute(agents[i]->GetContext())) ||
+                        !AssertEqual(tree->GetName() + " 새 버전 실행", 2, agents[i]->condition_count_.load()) ||
+                        !AssertEqual(tree->GetName() + " 순찰 선점", 2, patrol->GetHaltCount()))
+                        return TestResult("TestSubTree", false, "하위 트리 갱신이 전파되지 않음");
+                }
+
+                // 데이터 기반 트리의 "SubTree" 노드도 등록할 때 연결된다
+                NodeRegistry registry;
+                TreeLoader   loader(registry);
+                auto         loaded = loader.LoadJson(nlohmann::json::parse(R"({"name": "loaded", "root": {
+                    "type": "SubTree", "name": "attack", "params": {"tree": "monster_attack"}}})"));
+                engine.RegisterTree("loaded", loaded);
+                if (!AssertEqual("로드한 트리의 하위 트리 실행",
+                                 NodeStatus::SUCCESS,
+                                 loaded->Execute(agents[0]->GetContext())))
+                    return TestResult("TestSubTree", false, "로드한 SubTree 연결 오류");
+
+                // 배치 실행: 하위 트리도 에이전트 묶음으로 실행하며 결과는 한 명씩 실행한 것과 같다
+                engine.RegisterTree("monster_attack", make_attack());
+                constexpr int                                kAgents = 100;
+                std::vector<std::shared_ptr<MockAIExecutor>> single;
+                std::vector<std::shared_ptr<MockAIExecutor>> batched;
+                std::vector<Context*>                        contexts;
+                for (int i = 0; i < kAgents; ++i)
+                {
+                    single.push_back(CreateMockAI("single_" + std::to_string(i)));
+                    batched.push_back(CreateMockAI("batched_" + std::to_string(i)));
+                    single.back()->GetContext().SetAgent(single.back().get());
+                    batched.back()->GetContext().SetAgent(batched.back().get());
+                    contexts.push_back(&batched.back()->GetContext());
+                }
+                std::vector<NodeStatus>    statuses(kAgents);
+                CompiledTree::BatchScratch scratch;
+                for (int frame = 0; frame < 20; ++frame)
+                {
+                    std::vector<NodeStatus> expected;
+                    for (int i = 0; i < kAgents; ++i)
+                    {
+                        for (auto* ai : {single[i].get(), batched[i].get()})
+                        {
+                            ai->SetDistanceToTarget(static_cast<float>((i * 7 + frame * 3) % 10));
+                            ai->SetHealth(20 + (i * 13 + frame * 5) % 80);
+                        }
+                        expected.push_back(goblin->Execute(single[i]->GetContext()));
+                    }
+                    const int before = in_range->GetBatchCalls();
+                    goblin->ExecuteBatch(contexts.data(), contexts.size(), statuses.data(), scratch);
+                    // 선점 가드 확인과 실행에서 각각 블록(64명)당 한 번
+                    if (!AssertTrue("하위 트리 조건 배치 호출", in_range->GetBatchCalls() - before <= 4))
+                        return TestResult("TestSubTree", false, "하위 트리가 배치로 실행되지 않음");
+                    for (int i = 0; i < kAgents; ++i)
+                    {
+                        if (!AssertTrue("배치 결과 일치",
+                                        expected[i] == statuses[i] &&
+                                            single[i]->action_count_.load() == batched[i]->action_count_.load()))
+                            return TestResult("TestSubTree",
+                                              false,
+                                              "프레임 " + std::to_string(frame) + ", 에이전트 " + std::to_string(i) +
+                                                  " 배치 결과 불일치");
+                    }
+                }
+
+                // 순환 참조와 등록되지 않은 트리는 링커가 거부하고, 연결되지 않은 참조는 실행해도 실패할 뿐이다
+                Engine cyclic;
+                for (auto [name, target] : {std::pair{"loop_a", "loop_b"}, std::pair{"loop_b", "loop_a"}})
+                {
+                    auto tree = std::make_shared<Tree>(name);
+                    tree->SetRoot(std::make_shared<SubTree>("call", target));
+                    cyclic.RegisterTree(name, tree);
+                }
+                bool cycle_rejected = false;
+                try
+                {
+                    cyclic.LinkSubTrees();
+                }
+                catch (const TreeLinkError&)
+                {
+                    cycle_rejected = true;
+                }
+                auto context = std::make_shared<Context>();
+                if (!AssertTrue("순환 참조 거부", cycle_rejected) ||
+                    !AssertEqual("순환 참조는 연결하지 않음",
+                                 NodeStatus::FAILURE,
+                                 cyclic.GetTree("loop_b")->Execute(*context)))
+                    return TestResult("TestSubTree", false, "순환 참조 검사 오류");
+
+                Engine missing;
+                auto   lonely = std::make_shared<Tree>("lonely");
+                lonely->SetRoot(std::make_shared<SubTree>("call", "nowhere"));
+                missing.RegisterTree("lonely", lonely);
+                bool missing_rejected = false;
+                try
+                {
+                    missing.LinkSubTrees();
+                }
+                catch (const TreeLinkError&)
+                {
+                    missing_rejected = true;
+                }
+                if (!AssertTrue("등록되지 않은 하위 트리 거부", missing_rejected))
+                    return TestResult("TestSubTree", false, "미등록 참조 검사 오류");
+
+                std::cout << "  ✓ 하위 트리 테스트 통과\n";
+                return TestResult("TestSubTree", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestSubTree", false, std::string("예외 발생: ") + e.what());
+            }
+        }
+
+        TestResult BehaviorTreeTestSuite::TestSpatialGrid()
+        {
+            std::cout << "테스트: 공간 격자\n";
+#ifndef BT_TEST_SPATIAL_GRID
+            std::cout << "  - 서버 소스 없이 빌드되어 건너뜀\n";
+            return TestResult("TestSpatialGrid", true);
+#else
+
+            try
+            {
+                // 격자 질의를 같은 점 집합의 전수 비교와 맞춘다 (음수 좌표, 칸 경계를 넘는 이동, swap-pop 제거 포함)
+                SpatialGrid                                           grid(8.0f);
+                std::unordered_map<uint32_t, std::pair<float, float>> points;
+                Rng                                                   rng(2024);
+                auto random_coord = [&](float extent) { return (rng.NextFloat() * 2.0f - 1.0f) * extent; };
+
+                auto brute_radius = [&](float x, float z, float radius)
+                {
+                    std::vector<uint32_t> ids;
+                    for (const auto& [id, point] : points)
+                    {
+                        const float dx = point.first - x;
+                        const float dz = point.second - z;
+                        if (dx * dx + dz * dz <= radius * radius)
+                        {
+                            ids.push_back(id);
+                        }
+                    }
+                    std::sort(ids.begin(), ids.end());
+                    return ids;
+                };
+                auto brute_nearest = [&](float x, float z, size_t count, float max_radius)
+                {
+                    std::vector<float> distances;
+                    for (const auto& [id, point] : points)
+                    {
+                        const float dx          = point.first - x;
+                        const float dz          = point.second - z;
+                        const float distance_sq = dx * dx + dz * dz;
+                        if (distance_sq <= max_radius * max_radius)
+                        {
+                            distances.push_back(distance_sq);
+                        }
+                    }
+                    std::sort(distances.begin(), distances.end());
+                    distances.resize(std::min(count, distances.size()));
+                    return distances;
+                };
+
+                // 반경/최근접 질의를 전수 비교 결과와 대조 (최근접은 거리 순서를 비교, 같은 거리의 id 순서는 무관)
+                auto verify = [&](const std::string& phase)
+                {
+                    if (!AssertEqual(phase + " 크기", points.size(), grid.Size()))
+                        return false;
+                    const float  radii[]  = {0.0f, 3.0f, 12.0f, 40.0f, 500.0f};
+                    const size_t counts[] = {1, 5, 32, 10000};
+                    for (int query = 0; query < 40; ++query)
+                    {
+                        // 일부 질의는 점이 없는 먼 곳에서 (링 확장이 전체 탐색으로 넘어가는 경로)
+                        const float extent = query % 8 == 0 ? 400.0f : 120.0f;
+                        const float x      = random_coord(extent);
+                        const float z      = random_coord(extent);
+                        for (float radius : radii)
+                        {
+                            std::vector<SpatialGrid::Hit> hits;
+                            grid.QueryRadius(x, z, radius, hits);
+                            std::vector<uint32_t> ids;
+                            for (const auto& hit : hits)
+                            {
+                                ids.push_back(hit.id);
+                            }
+                            std::sort(ids.begin(), ids.end());
+                            if (!AssertTrue(phase + " 반경 질의", ids == brute_radius(x, z, radius)))
+                                return false;
+
+                            for (size_t count : counts)
+                            {
+                                std::vector<SpatialGrid::Hit> nearest = {{0xFFFFFFFFu, -1.0f}}; // 이 뒤에 추가된다
+                                const size_t                  found   = grid.QueryNearest(x, z, count, radius, nearest);
+                                std::vector<float>            distances;
+                                for (size_t i = 1; i < nearest.size(); ++i)
+                                {
+                                    distances.push_back(nearest[i].distance_sq);
+                                }
+                                if (!AssertEqual(phase + " 최근접 수", found, distances.size()) ||
+                                    !AssertTrue(phase + " 앞선 내용 유지", nearest[0].id == 0xFFFFFFFFu) ||
+                                    !AssertTrue(phase + " 최근접 거리",
+                                                distances == brute_nearest(x, z, count, radius)))
+                                    return false;
+                            }
+                        }
+                    }
+                    return true;
+                };
+
+                for (uint32_t id = 1; id <= 600; ++id)
+                {
+                    points[id] = {random_coord(100.0f), random_coord(100.0f)};
+                    grid.Insert(id, points[id].first, points[id].second);
+                }
+                if (!verify("삽입"))
+                    return TestResult("TestSpatialGrid", false, "삽입 후 질의 불일치");
+
+                // 같은 칸 안의 작은 이동과 칸을 넘는 이동을 섞는다
+                for (uint32_t id = 1; id <= 600; id += 2)
+                {
+                    const float step = id % 4 == 1 ? 0.5f : 30.0f;
+                    points[id].first += random_coord(step);
+                    points[id].second += random_coord(step);
+                    if (!AssertTrue("등록된 id 이동", grid.Move(id, points[id].first, points[id].second)))
+                        return TestResult("TestSpatialGrid", false, "이동 실패");
+                }
+                if (!AssertFalse("없는 id 이동", grid.Move(9999, 0.0f, 0.0f)) || !verify("이동"))
+                    return TestResult("TestSpatialGrid", false, "이동 후 질의 불일치");
+
+                // 제거는 마지막 엔트리를 빈자리로 옮기므로 앞/중간/끝을 골고루 지운다
+                for (uint32_t id = 1; id <= 600; id += 3)
+                {
+                    points.erase(id);
+                    if (!AssertTrue("제거", grid.Remove(id)))
+                        return TestResult("TestSpatialGrid", false, "제거 실패");
+                }
+                if (!AssertFalse("중복 제거", grid.Remove(1)) || !AssertFalse("제거된 id", grid.Contains(4)) ||
+                    !verify("제거"))
+                    return TestResult("TestSpatialGrid", false, "제거 후 질의 불일치");
+
+                // 제거 뒤 이동과 재삽입 (옮겨진 엔트리의 칸 목록 위치가 맞아야 한다)
+                for (uint32_t id = 2; id <= 600; id += 3)
+                {
+                    points[id] = {random_coord(100.0f), random_coord(100.0f)};
+                    grid.Move(id, points[id].first, points[id].second);
+                }
+                for (uint32_t id = 1; id <= 600; id += 6)
+                {
+                    points[id] = {random_coord(100.0f), random_coord(100.0f)};
+                    grid.Insert(id, points[id].first, points[id].second);
+                }
+                if (!verify("재배치"))
+                    return TestResult("TestSpatialGrid", false, "재배치 후 질의 불일치");
+
+                // 멀리 떨어진 두 무리: 링 확장이 빈 칸을 지나 경계 거리 조건으로 멈추거나 전체 탐색으로 넘어간다
+                grid.Clear();
+                points.clear();
+                if (!AssertEqual("비운 뒤 크기", size_t(0), grid.Size()) || !verify("비움"))
+                    return TestResult("TestSpatialGrid", false, "Clear 오류");
+                for (uint32_t id = 1; id <= 200; ++id)
+                {
+                    const float center = id % 2 ? -300.0f : 300.0f;
+                    points[id]         = {center + random_coord(10.0f), center + random_coord(10.0f)};
+                    grid.Insert(id, points[id].first, points[id].second);
+                }
+                if (!verify("군집"))
+                    return TestResult("TestSpatialGrid", false, "군집 질의 불일치");
+
+                // 무리 전체가 계속 새 칸으로 이동: 비게 된 칸은 지워지고 칸 수가 실제로 차 있는 칸 수를 따른다
+                // (Clear가 남겨 둔 버퍼가 섞이지 않도록 새 격자에서)
+                grid = SpatialGrid(8.0f);
+                for (const auto& [id, point] : points)
+                {
+                    grid.Insert(id, point.first, point.second);
+                }
+                for (int frame = 1; frame <= 20; ++frame)
+                {
+                    for (auto& [id, point] : points)
+                    {
+                        point.first += 50.0f;
+                        grid.Move(id, point.first, point.second);
+                    }
+                }
+                if (!AssertEqual("이동 후 보관 칸 = 차 있는 칸", grid.GetOccupiedCellCount(), grid.GetBucketCount()) ||
+                    !verify("무리 이동"))
+                    return TestResult("TestSpatialGrid", false, "이동한 칸 정리 실패");
+
+                // REBUILD 방식(프레임마다 Clear 후 다시 삽입): 보관 칸은 직전 프레임과 이번 프레임에 쓰인 칸으로 한정
+                for (int frame = 1; frame <= 20; ++frame)
+                {
+                    const size_t previous = grid.GetOccupiedCellCount();
+                    grid.Clear();
+                    for (auto& [id, point] : points)
+                    {
+                        point.second += 50.0f;
+                        grid.Insert(id, point.first, point.second);
+                    }
+                    if (!AssertTrue("재구성 보관 칸 한도",
+                                    grid.GetBucketCount() <= previous + grid.GetOccupiedCellCount()))
+                        return TestResult("TestSpatialGrid", false, "재구성 칸 누적");
+                }
+                if (!verify("재구성"))
+                    return TestResult("TestSpatialGrid", false, "재구성 후 질의 불일치");
+
+                std::cout << "  ✓ 공간 격자 테스트 통과\n";
+                return TestResult("TestSpatialGrid", true);
+            }
+            catch (const std::exception& e)
+            {
+                return TestResult("TestSpatialGrid", false, std::string("예외 발생: ") + e.what());
+            }
+#endif
         }
 
     } // namespace test
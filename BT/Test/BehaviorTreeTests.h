@@ -7,12 +7,28 @@
 
 #include <cassert>
 
+#include "../Action/Action.h"
+#include "../Action/AsyncAction.h"
+#include "../Action/CoAction.h"
+#include "../AgentArena.h"
+#include "../AgentNode.h"
+#include "../CompiledTree.h"
+#include "../Condition/Condition.h"
 #include "../Context.h"
 #include "../Control/Selector.h"
 #include "../Control/Sequence.h"
+#include "../Control/UtilitySelector.h"
+#include "../Control/WeightedRandomSelector.h"
+#include "../Decorator/Cooldown.h"
 #include "../Engine.h"
 #include "../Node.h"
+#include "../StaticTree.h"
+#include "../SubTree.h"
+#include "../Trace.h"
+#include "../TraceReplay.h"
 #include "../Tree.h"
+#include "../TreeLoader.h"
+#include "../TreeSlot.h"
 #include "TestNodes.h"
 
 namespace bt
@@ -54,6 +70,29 @@ namespace bt
             TestResult TestEngineRegistration();
             TestResult TestBlackboardFunctionality();
             TestResult TestEnvironmentInfoFunctionality();
+            TestResult TestCompiledTree();
+            TestResult TestSharedTreeState();
+            TestResult TestMemoryExecution();
+            TestResult TestEventScheduling();
+            TestResult TestParallelTickAll();
+            TestResult TestAsyncParallel();
+            TestResult TestCoroutineAction();
+            TestResult TestHaltPropagation();
+            TestResult TestConditionMemo();
+            TestResult TestTypedAgent();
+            TestResult TestSeededSelectors();
+            TestResult TestTimeDecorators();
+            TestResult TestAgentArena();
+            TestResult TestBatchExecution();
+            TestResult TestTraceReplay();
+            TestResult TestSubTree();
+            TestResult TestSpatialGrid();
+            TestResult TestTypedBlackboard();
+            TestResult TestLayeredBlackboard();
+            TestResult TestStaticTree();
+            TestResult TestProfiler();
+            TestResult TestTreeLoader();
+            TestResult TestHotReload();
 
             // 헬퍼 함수들
             std::shared_ptr<MockAIExecutor> CreateMockAI(const std::string& name = "TestAI");
@@ -77,7 +116,6 @@ namespace bt
 
         // 테스트 실행 함수
         void RunBehaviorTreeTests();
-        void RunPerformanceTest();
 
     } // namespace test
 } // namespace bt
@@ -2,7 +2,6 @@
 #include <iostream>
 
 #include "BehaviorTreeTests.h"
-#include "PerformanceTest.cpp"
 
 int main()
 {
@@ -13,8 +12,7 @@ int main()
 
     try
     {
-        bt::test::RunBehaviorTreeTests();
-        bt::test::RunPerformanceTest();
+        bt::test::RunBehaviorTreeTests(); // 성능 측정은 BT_Benchmarks
     }
     catch (const std::exception& e)
     {
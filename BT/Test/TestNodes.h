@@ -3,6 +3,7 @@
 #include <atomic>
 #include <chrono>
 
+#include "../BatchNode.h"
 #include "../Context.h"
 #include "../IExecutor.h"
 #include "../Node.h"
@@ -25,7 +26,23 @@ namespace bt
             }
 
             // IExecutor 인터페이스 구현
-            void                  Update(float delta_time) override {}
+            void                  Update(float /* delta_time */) override
+            {
+                if (behavior_tree_)
+                {
+                    context_.IncrementExecutionCount();
+                    context_.SetAgent(this);
+                    behavior_tree_->Execute(context_);
+                }
+            }
+            Tree* PrepareBatchTick(float /* delta_time */) override
+            {
+                if (!behavior_tree_)
+                    return nullptr;
+                context_.IncrementExecutionCount();
+                context_.SetAgent(this);
+                return behavior_tree_.get();
+            }
             void                  SetBehaviorTree(std::shared_ptr<Tree> tree) override { behavior_tree_ = tree; }
             std::shared_ptr<Tree> GetBehaviorTree() const override { return behavior_tree_; }
             Context&              GetContext() override { return context_; }
@@ -158,6 +175,28 @@ namespace bt
             int current_tick_;
         };
 
+        // 테스트용 Action 노드 - 항상 RUNNING, 실행/중단 횟수 기록
+        class TestHaltingAction : public Node
+        {
+        public:
+            TestHaltingAction(const std::string& name) : Node(name, NodeType::ACTION) {}
+
+            NodeStatus Execute(Context& /* context */) override
+            {
+                execute_count_++;
+                return NodeStatus::RUNNING;
+            }
+
+            void Halt(Context& /* context */) override { halt_count_++; }
+
+            int GetExecuteCount() const { return execute_count_; }
+            int GetHaltCount() const { return halt_count_; }
+
+        private:
+            int execute_count_ = 0;
+            int halt_count_    = 0;
+        };
+
         // 테스트용 Condition 노드 - 체력 확인
         class TestHealthCondition : public Node
         {
@@ -338,5 +377,36 @@ namespace bt
             int current_tick_;
         };
 
+        // 테스트용 배치 Condition 노드 - 타겟과의 거리가 range 이하인지 (거리를 배열로 모아 한 번에 비교)
+        class TestBatchInRangeCondition : public BatchCondition<MockAIExecutor>
+        {
+        public:
+            TestBatchInRangeCondition(const std::string& name, float range) : BatchCondition(name), range_(range) {}
+
+            int GetBatchCalls() const { return batch_calls_.load(); }
+
+        protected:
+            void EvaluateBatch(MockAIExecutor* const* agents,
+                               Context* const* /* contexts */,
+                               size_t   count,
+                               uint8_t* passed) override
+            {
+                batch_calls_++;
+                float distances[kBlockSize];
+                for (size_t i = 0; i < count; ++i)
+                {
+                    distances[i] = agents[i]->GetDistanceToTarget();
+                }
+                for (size_t i = 0; i < count; ++i)
+                {
+                    passed[i] = distances[i] <= range_;
+                }
+            }
+
+        private:
+            float            range_;
+            std::atomic<int> batch_calls_{0};
+        };
+
     } // namespace test
 } // namespace bt
@@ -0,0 +1,293 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <cstdint>
+
+namespace bt
+{
+
+    // 작업 훔치기(work-stealing) 스레드 풀
+    // ParallelFor 한 번이 한 배치이며, 모든 작업이 끝날 때까지 호출 스레드가 기다린다 (프레임 끝 배리어).
+    // 각 워커는 자기 큐의 뒤에서 꺼내고, 비면 다른 큐의 앞에서 훔쳐 온다. 호출 스레드도 작업에 참여한다.
+    class WorkStealingPool
+    {
+    public:
+        using RangeFunction = std::function<void(size_t begin, size_t end)>;
+
+        explicit WorkStealingPool(size_t thread_count = DefaultThreadCount()) : queues_(thread_count + 1)
+        {
+            for (auto& queue : queues_)
+            {
+                queue = std::make_unique<WorkQueue>();
+            }
+            workers_.reserve(thread_count);
+            for (size_t i = 0; i < thread_count; ++i)
+            {
+                workers_.emplace_back([this, i]() { WorkerLoop(i); });
+            }
+        }
+
+        ~WorkStealingPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(wake_mutex_);
+                stop_ = true;
+            }
+            wake_cv_.notify_all();
+            for (auto& worker : workers_)
+            {
+                if (worker.joinable())
+                {
+                    worker.join();
+                }
+            }
+        }
+
+        WorkStealingPool(const WorkStealingPool&)            = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        // [0, count)를 grain 크기 구간으로 나눠 병렬 실행 (구간 k는 큐 k % 큐 수에 배치)
+        // 작업에서 던진 첫 예외는 배치가 모두 끝난 뒤 호출 스레드에서 다시 던진다.
+        void ParallelFor(size_t count, size_t grain, const RangeFunction& function)
+        {
+            if (count == 0)
+                return;
+
+            std::lock_guard<std::mutex> batch_lock(batch_mutex_); // 배치는 한 번에 하나
+            grain = std::max<size_t>(grain, 1);
+
+            size_t task_count = (count + grain - 1) / grain;
+            job_              = &function;
+            error_            = nullptr;
+            remaining_.store(task_count, std::memory_order_relaxed);
+
+            for (size_t task = 0; task < task_count; ++task)
+            {
+                size_t                      begin = task * grain;
+                WorkQueue&                  queue = *queues_[task % queues_.size()];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                queue.tasks.push_back({begin, std::min(begin + grain, count)});
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(wake_mutex_);
+                generation_++;
+            }
+            wake_cv_.notify_all();
+
+            // 호출 스레드도 참여한 뒤 배리어에서 대기
+            RunTasks(queues_.size() - 1);
+            {
+                std::unique_lock<std::mutex> lock(done_mutex_);
+                done_cv_.wait(lock, [this]() { return remaining_.load(std::memory_order_acquire) == 0; });
+            }
+            job_ = nullptr;
+
+            if (error_)
+            {
+                std::rethrow_exception(error_);
+            }
+        }
+
+        size_t GetThreadCount() const { return workers_.size(); }
+
+        static size_t DefaultThreadCount()
+        {
+            unsigned int hardware = std::thread::hardware_concurrency();
+            return hardware > 1 ? hardware - 1 : 1; // 호출 스레드 몫을 뺀다
+        }
+
+    private:
+        struct Task
+        {
+            size_t begin;
+            size_t end;
+        };
+
+        struct WorkQueue
+        {
+            std::mutex       mutex;
+            std::deque<Task> tasks;
+        };
+
+        void WorkerLoop(size_t index)
+        {
+            uint64_t seen_generation = 0;
+            while (true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(wake_mutex_);
+                    wake_cv_.wait(lock, [&]() { return stop_ || generation_ != seen_generation; });
+                    if (stop_)
+                        return;
+                    seen_generation = generation_;
+                }
+                RunTasks(index);
+            }
+        }
+
+        // 자기 큐를 먼저 비우고, 이후 다른 큐에서 훔친다
+        void RunTasks(size_t index)
+        {
+            Task task;
+            while (PopLocal(index, task) || Steal(index, task))
+            {
+                try
+                {
+                    (*job_)(task.begin, task.end);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(error_mutex_);
+                    if (!error_)
+                    {
+                        error_ = std::current_exception();
+                    }
+                }
+
+                if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    std::lock_guard<std::mutex> lock(done_mutex_);
+                    done_cv_.notify_all();
+                }
+            }
+        }
+
+        bool PopLocal(size_t index, Task& task)
+        {
+            WorkQueue&                  queue = *queues_[index];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty())
+                return false;
+            task = queue.tasks.back();
+            queue.tasks.pop_back();
+            return true;
+        }
+
+        bool Steal(size_t index, Task& task)
+        {
+            for (size_t offset = 1; offset < queues_.size(); ++offset)
+            {
+                WorkQueue&                  victim = *queues_[(index + offset) % queues_.size()];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!victim.tasks.empty())
+                {
+                    task = victim.tasks.front();
+                    victim.tasks.pop_front();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        std::vector<std::unique_ptr<WorkQueue>> queues_; // 워커별 큐 + 호출 스레드 큐(마지막)
+        std::vector<std::thread>                workers_;
+
+        std::mutex           batch_mutex_;
+        const RangeFunction* job_ = nullptr;
+        std::atomic<size_t>  remaining_{0};
+        std::mutex           error_mutex_;
+        std::exception_ptr   error_;
+
+        std::mutex              wake_mutex_;
+        std::condition_variable wake_cv_;
+        uint64_t                generation_ = 0;
+        bool                    stop_       = false;
+
+        std::mutex              done_mutex_;
+        std::condition_variable done_cv_;
+    };
+
+    // 비동기 작업 풀 (AsyncAction처럼 틱을 넘겨 진행되는 작업용)
+    // 배치 단위로 기다리는 WorkStealingPool과 달리 작업을 하나씩 제출하고 결과는 future로 받는다.
+    // 풀이 소멸할 때 시작하지 못한 작업은 버려지며, 그 future는 broken_promise 예외를 전달한다.
+    class JobPool
+    {
+    public:
+        explicit JobPool(size_t thread_count = WorkStealingPool::DefaultThreadCount())
+        {
+            workers_.reserve(thread_count);
+            for (size_t i = 0; i < std::max<size_t>(thread_count, 1); ++i)
+            {
+                workers_.emplace_back([this]() { WorkerLoop(); });
+            }
+        }
+
+        ~JobPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+                jobs_.clear();
+            }
+            cv_.notify_all();
+            for (auto& worker : workers_)
+            {
+                if (worker.joinable())
+                {
+                    worker.join();
+                }
+            }
+        }
+
+        JobPool(const JobPool&)            = delete;
+        JobPool& operator=(const JobPool&) = delete;
+
+        template <typename F>
+        std::future<std::invoke_result_t<F>> Submit(F&& function)
+        {
+            auto task   = std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(std::forward<F>(function));
+            auto result = task->get_future();
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                jobs_.emplace_back([task]() { (*task)(); });
+            }
+            cv_.notify_one();
+            return result;
+        }
+
+        size_t GetThreadCount() const { return workers_.size(); }
+        size_t GetPendingCount() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return jobs_.size();
+        }
+
+    private:
+        void WorkerLoop()
+        {
+            while (true)
+            {
+                std::function<void()> job;
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    cv_.wait(lock, [this]() { return stop_ || !jobs_.empty(); });
+                    if (stop_)
+                        return;
+                    job = std::move(jobs_.front());
+                    jobs_.pop_front();
+                }
+                job(); // 예외는 packaged_task가 future로 전달
+            }
+        }
+
+        std::vector<std::thread>          workers_;
+        std::deque<std::function<void()>> jobs_;
+        mutable std::mutex                mutex_;
+        std::condition_variable           cv_;
+        bool                              stop_ = false;
+    };
+
+} // namespace bt
@@ -0,0 +1,540 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+#include <cstring>
+
+#include "Blackboard.h"
+#include "Context.h"
+#include "Node.h"
+#include "Profiler.h"
+#include "Tracer.h"
+
+namespace bt
+{
+
+    // 추적 파일 읽기/쓰기 실패
+    class TraceError : public std::runtime_error
+    {
+    public:
+        explicit TraceError(const std::string& message) : std::runtime_error(message) {}
+    };
+
+    // 추적 이벤트 종류 (필드 의미는 종류별로 다르다)
+    enum class TraceEventType : uint8_t
+    {
+        TICK_BEGIN,       // id: 트리 번호, a: 에이전트 id, b: 프레임 시각 (steady_clock 눈금)
+        RNG,              // a: 난수 상태, b: 난수 증분 (틱 시작 시점)
+        NODE_STATE,       // 틱 시작 시점에 기본값이 아닌 노드 상태 (id: 노드, a: deadline, b: 자식 << 32 | counter)
+        NODE,             // 노드 평가 결과 (id: 노드, status, a: 자손 포함 사이클), 자식이 먼저 끝나므로 후위 순서
+        BLACKBOARD_WRITE, // 틱 동안 쓰인 키 (id: 키, a: 쓰기 버전, flags: TRACE_REMOVED)
+        TICK_END          // status: 트리 결과, a: 틱 전체 사이클, b: 에이전트의 틱 번호
+    };
+
+    // NODE_STATE/BLACKBOARD_WRITE 플래그
+    enum TraceFlag : uint16_t
+    {
+        TRACE_RUNNING = 1 << 0, // NodeState::is_running
+        TRACE_STARTED = 1 << 1, // NodeState::started
+        TRACE_REMOVED = 1 << 2  // 키 삭제
+    };
+
+    // 고정 크기 이벤트 레코드 (24바이트)
+    struct TraceEvent
+    {
+        TraceEventType type   = TraceEventType::TICK_BEGIN;
+        uint8_t        status = 0; // NodeStatus
+        uint16_t       flags  = 0; // TraceFlag 조합
+        uint32_t       id     = 0;
+        uint64_t       a      = 0;
+        uint64_t       b      = 0;
+    };
+
+    // 기록된 트리 정보 (재생할 트리를 찾고 결과에 노드 이름을 붙일 때 사용)
+    struct TraceTreeInfo
+    {
+        std::string              name;
+        uint64_t                 structure_hash = 0;
+        std::vector<std::string> node_names; // 노드 id로 인덱싱
+    };
+
+    // 추적 데이터 (TraceRecorder::Collect 또는 파일에서 읽은 결과)
+    // 이벤트는 완결된 틱(TICK_BEGIN ~ TICK_END) 단위로만 들어 있고, 스레드별로 기록 순서를 유지한다.
+    //
+    // 파일 형식 (리틀 엔디언):
+    //   "BTT1" | 버전(u8) | 나노초/사이클(f64) | 트리 수(u32) | 트리 (이름, 구조 해시 u64, 노드 수 u32, 노드 이름...)
+    //   | 키 수(u32) | 키 (id u32, 이름) | 이벤트 수(u64) | 이벤트 (종류 u8, 결과 u8, 플래그 u16, id u32, a u64, b u64)
+    //   문자열은 길이(u32) + 바이트.
+    struct TraceData
+    {
+        static constexpr uint8_t kVersion = 1;
+
+        double                                        ns_per_cycle = 1.0;
+        std::vector<TraceTreeInfo>                    trees; // TICK_BEGIN의 트리 번호로 인덱싱
+        std::vector<std::pair<uint32_t, std::string>> keys;  // 기록된 블랙보드 키 id → 이름
+        std::vector<TraceEvent>                       events;
+
+        std::vector<uint8_t> Serialize() const
+        {
+            std::vector<uint8_t> out = {'B', 'T', 'T', '1', kVersion};
+            uint64_t             ns_bits;
+            std::memcpy(&ns_bits, &ns_per_cycle, sizeof(ns_bits));
+            WriteInt(out, ns_bits, 8);
+
+            WriteInt(out, trees.size(), 4);
+            for (const auto& tree : trees)
+            {
+                WriteString(out, tree.name);
+                WriteInt(out, tree.structure_hash, 8);
+                WriteInt(out, tree.node_names.size(), 4);
+                for (const auto& name : tree.node_names)
+                {
+                    WriteString(out, name);
+                }
+            }
+
+            WriteInt(out, keys.size(), 4);
+            for (const auto& [id, name] : keys)
+            {
+                WriteInt(out, id, 4);
+                WriteString(out, name);
+            }
+
+            WriteInt(out, events.size(), 8);
+            out.reserve(out.size() + events.size() * sizeof(TraceEvent));
+            for (const auto& event : events)
+            {
+                WriteInt(out, static_cast<uint8_t>(event.type), 1);
+                WriteInt(out, event.status, 1);
+                WriteInt(out, event.flags, 2);
+                WriteInt(out, event.id, 4);
+                WriteInt(out, event.a, 8);
+                WriteInt(out, event.b, 8);
+            }
+            return out;
+        }
+
+        static TraceData Deserialize(const std::vector<uint8_t>& data)
+        {
+            Reader reader{data};
+            if (data.size() < 5 || std::memcmp(data.data(), "BTT1", 4) != 0)
+                throw TraceError("추적 파일 형식이 아닙니다");
+            reader.offset = 4;
+            if (reader.Int(1) != kVersion)
+                throw TraceError("지원하지 않는 추적 파일 버전입니다");
+
+            TraceData trace;
+            uint64_t  ns_bits = reader.Int(8);
+            std::memcpy(&trace.ns_per_cycle, &ns_bits, sizeof(ns_bits));
+
+            trace.trees.resize(reader.Count(4, 1));
+            for (auto& tree : trace.trees)
+            {
+                tree.name           = reader.String();
+                tree.structure_hash = reader.Int(8);
+                tree.node_names.resize(reader.Count(4, 4));
+                for (auto& name : tree.node_names)
+                {
+                    name = reader.String();
+                }
+            }
+
+            trace.keys.resize(reader.Count(4, 8));
+            for (auto& [id, name] : trace.keys)
+            {
+                id   = static_cast<uint32_t>(reader.Int(4));
+                name = reader.String();
+            }
+
+            trace.events.resize(reader.Count(8, sizeof(TraceEvent)));
+            for (auto& event : trace.events)
+            {
+                event.type   = static_cast<TraceEventType>(reader.Int(1));
+                event.status = static_cast<uint8_t>(reader.Int(1));
+                event.flags  = static_cast<uint16_t>(reader.Int(2));
+                event.id     = static_cast<uint32_t>(reader.Int(4));
+                event.a      = reader.Int(8);
+                event.b      = reader.Int(8);
+                if (event.type > TraceEventType::TICK_END || event.status > static_cast<uint8_t>(NodeStatus::RUNNING))
+                    throw TraceError("손상된 추적 이벤트");
+            }
+            return trace;
+        }
+
+        void Save(const std::string& path) const
+        {
+            std::vector<uint8_t> data = Serialize();
+            std::ofstream        file(path, std::ios::binary);
+            if (!file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size())))
+                throw TraceError("추적 파일을 쓸 수 없습니다: " + path);
+        }
+
+        static TraceData Load(const std::string& path)
+        {
+            std::ifstream file(path, std::ios::binary);
+            if (!file)
+                throw TraceError("추적 파일을 열 수 없습니다: " + path);
+            std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+            return Deserialize(data);
+        }
+
+    private:
+        static void WriteInt(std::vector<uint8_t>& out, uint64_t value, size_t bytes)
+        {
+            for (size_t i = 0; i < bytes; ++i)
+            {
+                out.push_back(static_cast<uint8_t>(value >> (i * 8)));
+            }
+        }
+
+        static void WriteString(std::vector<uint8_t>& out, const std::string& value)
+        {
+            WriteInt(out, value.size(), 4);
+            out.insert(out.end(), value.begin(), value.end());
+        }
+
+        // 범위를 검사하며 읽는 커서 (손상된 파일은 TraceError)
+        struct Reader
+        {
+            const std::vector<uint8_t>& data;
+            size_t                      offset = 0;
+
+            uint64_t Int(size_t bytes)
+            {
+                if (data.size() - offset < bytes)
+                    throw TraceError("추적 파일이 잘렸습니다");
+                uint64_t value = 0;
+                for (size_t i = 0; i < bytes; ++i)
+                {
+                    value |= static_cast<uint64_t>(data[offset + i]) << (i * 8);
+                }
+                offset += bytes;
+                return value;
+            }
+
+            // 원소 수 (원소마다 최소 min_size 바이트가 남아 있어야 한다, 손상된 수로 큰 할당을 하지 않도록)
+            size_t Count(size_t bytes, size_t min_size)
+            {
+                uint64_t count = Int(bytes);
+                if (count > (data.size() - offset) / min_size)
+                    throw TraceError("추적 파일이 잘렸습니다");
+                return static_cast<size_t>(count);
+            }
+
+            std::string String()
+            {
+                size_t      size = Count(4, 1);
+                std::string value(reinterpret_cast<const char*>(data.data() + offset), size);
+                offset += size;
+                return value;
+            }
+        };
+    };
+
+    // 노드 실행 추적 기록기
+    // 표본으로 뽑힌 에이전트 틱의 방문 노드와 결과, 노드별 사이클, 틱 동안 쓰인 블랙보드 키를 스레드별 고정 크기
+    // 링 버퍼에 잠금 없이 기록한다 (가득 차면 오래된 틱부터 덮어쓴다). 틱마다 시작 시점의 노드 상태, 난수 상태,
+    // 프레임 시각을 함께 남기므로 기록된 틱은 하나씩 따로 재생할 수 있다 (TraceReplayer).
+    // 표본 간격이 N이면 스레드마다 N틱에 한 번 기록한다. 나머지 틱은 카운터 증가 하나라 운영 중에도 켜 둘 수 있다.
+    // Tree::SetTraceRecorder(또는 Engine::SetTraceRecorder)로 연결한다. 표본 간격은 언제든 바꿀 수 있지만
+    // Collect/WriteFile/Reset은 기록 중인 스레드가 없을 때(프레임 사이) 호출해야 한다.
+    class TraceRecorder : public Tracer
+    {
+    public:
+        static constexpr size_t kDefaultCapacity = 64 * 1024; // 스레드당 이벤트 수 (이벤트당 24바이트)
+
+        explicit TraceRecorder(uint32_t sample_interval = 1, size_t capacity = kDefaultCapacity)
+            : sample_interval_(sample_interval), capacity_(RoundUpPowerOfTwo(capacity)), serial_(NextSerial()),
+              start_cycles_(CycleClock::Now()), start_time_(std::chrono::steady_clock::now())
+        {
+        }
+
+        TraceRecorder(const TraceRecorder&)            = delete;
+        TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+        // 표본 간격 (N틱에 한 번 기록, 0이면 기록하지 않음)
+        void     SetSampleInterval(uint32_t interval) { sample_interval_.store(interval, std::memory_order_relaxed); }
+        uint32_t GetSampleInterval() const { return sample_interval_.load(std::memory_order_relaxed); }
+
+        // 트리 등록 (이름과 구조 해시가 같으면 같은 번호, Tree::SetTraceRecorder가 호출)
+        uint32_t RegisterTree(const std::string& name, uint64_t structure_hash, const Node* root)
+        {
+            std::lock_guard<std::mutex> lock(trees_mutex_);
+            for (size_t i = 0; i < trees_.size(); ++i)
+            {
+                if (trees_[i].name == name && trees_[i].structure_hash == structure_hash)
+                    return static_cast<uint32_t>(i);
+            }
+
+            TraceTreeInfo info;
+            info.name           = name;
+            info.structure_hash = structure_hash;
+            if (root)
+            {
+                CollectNodeNames(root, info.node_names);
+            }
+            trees_.push_back(std::move(info));
+            return static_cast<uint32_t>(trees_.size() - 1);
+        }
+
+        // 틱 시작 (Tree가 노드 상태를 준비한 뒤 호출, 이 틱을 기록하면 true)
+        bool BeginTick(uint32_t tree_index, Context& context)
+        {
+            const uint32_t interval = GetSampleInterval();
+            if (interval == 0)
+                return false;
+            ThreadBuffer& buffer = GetThreadBuffer();
+            if (++buffer.skipped < interval)
+                return false;
+            buffer.skipped = 0;
+
+            Push(buffer,
+                 {TraceEventType::TICK_BEGIN,
+                  0,
+                  0,
+                  tree_index,
+                  context.GetAgentId(),
+                  static_cast<uint64_t>(context.GetFrameTime().time_since_epoch().count())});
+
+            const Rng& rng = context.GetRng();
+            Push(buffer, {TraceEventType::RNG, 0, 0, 0, rng.GetState(), rng.GetIncrement()});
+
+            TreeState& state = context.GetTreeState();
+            for (uint32_t id = 0; id < state.Size(); ++id)
+            {
+                const NodeState& node = state.Get(id);
+                if (node.is_running || node.started || node.counter != 0 || node.child_index != 0 ||
+                    node.last_status != NodeStatus::FAILURE)
+                {
+                    const int flags = (node.is_running ? TRACE_RUNNING : 0) | (node.started ? TRACE_STARTED : 0);
+                    Push(buffer,
+                         {TraceEventType::NODE_STATE,
+                          static_cast<uint8_t>(node.last_status),
+                          static_cast<uint16_t>(flags),
+                          id,
+                          static_cast<uint64_t>(node.deadline.time_since_epoch().count()),
+                          (static_cast<uint64_t>(node.child_index) << 32) | static_cast<uint32_t>(node.counter)});
+                }
+            }
+
+            buffer.blackboard_version = context.GetBlackboard().GetVersion();
+            buffer.tick_start         = CycleClock::Now();
+            return true;
+        }
+
+        // 기록 중인 틱 끝 (Tree가 BeginTick이 true였던 틱에만 호출)
+        void EndTick(Context& context, NodeStatus status)
+        {
+            ThreadBuffer&  buffer  = GetThreadBuffer();
+            const uint64_t elapsed = CycleClock::Now() - buffer.tick_start;
+            context.GetBlackboard().ForEachWriteSince(
+                buffer.blackboard_version,
+                [&](uint32_t key, uint32_t version, bool removed)
+                {
+                    Push(buffer,
+                         {TraceEventType::BLACKBOARD_WRITE,
+                          0,
+                          static_cast<uint16_t>(removed ? TRACE_REMOVED : 0),
+                          key,
+                          version,
+                          0});
+                });
+            Push(buffer,
+                 {TraceEventType::TICK_END,
+                  static_cast<uint8_t>(status),
+                  0,
+                  0,
+                  elapsed,
+                  context.GetTreeState().GetTick()});
+        }
+
+        NodeStatus TraceNode(uint32_t node_id,
+                             bool /* leaf */,
+                             Context& /* context */,
+                             NodeStatus (*evaluate)(void*),
+                             void* arg) override
+        {
+            const uint64_t start  = CycleClock::Now();
+            NodeStatus     status = evaluate(arg);
+            const uint64_t cycles = CycleClock::Now() - start;
+            Push(GetThreadBuffer(), {TraceEventType::NODE, static_cast<uint8_t>(status), 0, node_id, cycles, 0});
+            return status;
+        }
+
+        // 모든 스레드 버퍼의 완결된 틱 (덮어써져 앞부분이 사라진 틱, 진행 중인 틱은 제외)
+        TraceData Collect() const
+        {
+            TraceData trace;
+            trace.ns_per_cycle = GetNanosecondsPerCycle();
+            {
+                std::lock_guard<std::mutex> lock(trees_mutex_);
+                trace.trees = trees_;
+            }
+
+            std::vector<TraceEvent> pending;
+            {
+                std::lock_guard<std::mutex> lock(buffers_mutex_);
+                for (const auto& buffer : buffers_)
+                {
+                    const uint64_t head  = buffer->head;
+                    const uint64_t first = head > capacity_ ? head - capacity_ : 0;
+                    bool           open  = false;
+                    pending.clear();
+                    for (uint64_t i = first; i < head; ++i)
+                    {
+                        const TraceEvent& event = buffer->ring[i & (capacity_ - 1)];
+                        if (event.type == TraceEventType::TICK_BEGIN)
+                        {
+                            pending.clear();
+                            open = true;
+                        }
+                        if (!open)
+                            continue;
+                        pending.push_back(event);
+                        if (event.type == TraceEventType::TICK_END)
+                        {
+                            trace.events.insert(trace.events.end(), pending.begin(), pending.end());
+                            open = false;
+                        }
+                    }
+                }
+            }
+
+            std::vector<uint32_t> key_ids;
+            for (const auto& event : trace.events)
+            {
+                if (event.type == TraceEventType::BLACKBOARD_WRITE)
+                {
+                    key_ids.push_back(event.id);
+                }
+            }
+            std::sort(key_ids.begin(), key_ids.end());
+            key_ids.erase(std::unique(key_ids.begin(), key_ids.end()), key_ids.end());
+            for (uint32_t id : key_ids)
+            {
+                trace.keys.emplace_back(id, BlackboardKeyRegistry::Instance().GetName(id));
+            }
+            return trace;
+        }
+
+        void WriteFile(const std::string& path) const { Collect().Save(path); }
+
+        // 기록 비우기 (트리 등록은 유지)
+        void Reset()
+        {
+            std::lock_guard<std::mutex> lock(buffers_mutex_);
+            for (auto& buffer : buffers_)
+            {
+                buffer->head = 0;
+            }
+        }
+
+        // 사이클 → 나노초 환산 비율 (Profiler와 같은 방식)
+        double GetNanosecondsPerCycle() const
+        {
+#ifdef BT_PROFILER_HAS_RDTSC
+            uint64_t cycles  = CycleClock::Now() - start_cycles_;
+            auto     elapsed = std::chrono::steady_clock::now() - start_time_;
+            double   nanos   = std::chrono::duration<double, std::nano>(elapsed).count();
+            return cycles > 0 && nanos > 0.0 ? nanos / static_cast<double>(cycles) : 1.0;
+#else
+            return 1.0;
+#endif
+        }
+
+    private:
+        struct ThreadBuffer
+        {
+            std::vector<TraceEvent> ring;                   // 크기는 capacity_ (2의 거듭제곱)
+            uint64_t                head               = 0; // 지금까지 기록한 이벤트 수
+            uint32_t                skipped            = 0; // 마지막 표본 이후 건너뛴 틱 수
+            uint32_t                blackboard_version = 0; // 기록 중인 틱 시작 시점의 블랙보드 버전
+            uint64_t                tick_start         = 0;
+        };
+
+        static uint64_t NextSerial()
+        {
+            static std::atomic<uint64_t> serial{0};
+            return ++serial;
+        }
+
+        static size_t RoundUpPowerOfTwo(size_t value)
+        {
+            size_t power = 64;
+            while (power < value)
+            {
+                power <<= 1;
+            }
+            return power;
+        }
+
+        static void CollectNodeNames(const Node* node, std::vector<std::string>& names)
+        {
+            if (node->GetId() >= names.size())
+            {
+                names.resize(node->GetId() + 1);
+            }
+            names[node->GetId()] = node->GetName();
+            for (const auto& child : node->GetChildren())
+            {
+                if (child)
+                {
+                    CollectNodeNames(child.get(), names);
+                }
+            }
+        }
+
+        void Push(ThreadBuffer& buffer, const TraceEvent& event)
+        {
+            buffer.ring[buffer.head & (capacity_ - 1)] = event;
+            buffer.head++;
+        }
+
+        // 스레드별 버퍼 (처음 기록하는 스레드만 잠금을 거쳐 등록, Profiler와 같은 방식)
+        ThreadBuffer& GetThreadBuffer()
+        {
+            struct CacheEntry
+            {
+                uint64_t      serial;
+                ThreadBuffer* buffer;
+            };
+            thread_local std::vector<CacheEntry> cache;
+
+            for (const auto& entry : cache)
+            {
+                if (entry.serial == serial_)
+                {
+                    return *entry.buffer;
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(buffers_mutex_);
+            buffers_.push_back(std::make_unique<ThreadBuffer>());
+            buffers_.back()->ring.resize(capacity_);
+            cache.push_back({serial_, buffers_.back().get()});
+            return *buffers_.back();
+        }
+
+        std::atomic<uint32_t>                      sample_interval_;
+        size_t                                     capacity_;
+        uint64_t                                   serial_; // 스레드 캐시 식별자 (주소 재사용과 구분)
+        uint64_t                                   start_cycles_;
+        std::chrono::steady_clock::time_point      start_time_;
+        std::vector<TraceTreeInfo>                 trees_; // 트리 번호로 인덱싱
+        mutable std::mutex                         trees_mutex_;
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+        mutable std::mutex                         buffers_mutex_;
+    };
+
+} // namespace bt
@@ -0,0 +1,373 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+
+#include <nlohmann/json.hpp>
+
+#include "Context.h"
+#include "Node.h"
+#include "Profiler.h"
+#include "Trace.h"
+#include "Tracer.h"
+#include "Tree.h"
+
+namespace bt
+{
+
+    // 추적 재생 결과
+    struct TraceReplayReport
+    {
+        // 트리 하나의 노드별 측정값 (기록된 사이클, 노드 id로 인덱싱)
+        struct TreeTiming
+        {
+            std::string              name;
+            std::vector<std::string> node_names;
+            std::vector<NodeProfile> nodes;
+        };
+
+        size_t                                        ticks   = 0; // 재생한 틱
+        size_t                                        matched = 0; // 기록과 같은 노드를 같은 결과로 방문한 틱
+        size_t                                        skipped = 0; // 재생할 트리가 없어 건너뛴 틱
+        std::vector<std::string>                      divergences;        // 기록과 달라진 틱 설명 (앞쪽 일부)
+        std::vector<TreeTiming>                       trees;              // 기록의 트리 번호로 인덱싱
+        std::vector<std::pair<std::string, uint64_t>> blackboard_writes; // 키별 쓰기 횟수
+        double                                        ns_per_cycle = 1.0;
+
+        // JSON 내보내기 (시간 단위: 나노초, Profiler::ToJson과 같은 노드 필드)
+        nlohmann::json ToJson() const
+        {
+            nlohmann::json json_trees = nlohmann::json::array();
+            for (const auto& tree : trees)
+            {
+                nlohmann::json nodes = nlohmann::json::array();
+                for (size_t id = 0; id < tree.nodes.size(); ++id)
+                {
+                    const NodeProfile& profile = tree.nodes[id];
+                    uint64_t self = profile.total_cycles > profile.child_cycles
+                                        ? profile.total_cycles - profile.child_cycles
+                                        : 0;
+                    nodes.push_back({{"id", id},
+                                     {"name", id < tree.node_names.size() ? tree.node_names[id] : std::string()},
+                                     {"calls", profile.calls},
+                                     {"success", profile.status_counts[0]},
+                                     {"failure", profile.status_counts[1]},
+                                     {"running", profile.status_counts[2]},
+                                     {"total_ns", static_cast<uint64_t>(profile.total_cycles * ns_per_cycle)},
+                                     {"self_ns", static_cast<uint64_t>(self * ns_per_cycle)}});
+                }
+                json_trees.push_back({{"tree", tree.name}, {"nodes", nodes}});
+            }
+
+            nlohmann::json writes = nlohmann::json::object();
+            for (const auto& [key, count] : blackboard_writes)
+            {
+                writes[key] = count;
+            }
+            return {{"ticks", ticks},
+                    {"matched", matched},
+                    {"skipped", skipped},
+                    {"divergences", divergences},
+                    {"blackboard_writes", writes},
+                    {"trees", json_trees}};
+        }
+    };
+
+    // 추적 재생기
+    // 기록된 틱을 같은 트리로 하나씩 다시 실행한다. 틱 시작 시점의 노드 상태, 난수 상태, 프레임 시각을 복원하고
+    // 리프는 실행하지 않고 기록된 결과를 돌려주므로 게임 월드 없이 재생된다. 제어 노드가 기록과 같은 순서로
+    // 같은 노드를 방문해 같은 결과를 내는지 확인하고(어긋나면 divergences), 기록된 사이클을 재생한 호출 구조로
+    // 나눠 노드별 자손 포함/자기 시간을 보고한다.
+    // 트리 정의의 노드를 실행하므로 같은 트리로 게임 틱이 돌고 있지 않을 때(별도 프로세스, 프레임 사이) 호출한다.
+    //
+    //   TraceReplayer replayer(TraceData::Load("bt_trace.btt"));
+    //   replayer.AddTree(MonsterBTs::CreateGoblinBT());
+    //   std::cout << replayer.Run().ToJson().dump(2);
+    class TraceReplayer : public Tracer
+    {
+    public:
+        static constexpr size_t kMaxDivergences = 32;
+
+        explicit TraceReplayer(TraceData trace) : trace_(std::move(trace)), trees_(trace_.trees.size()) {}
+
+        // 재생할 트리 (기록된 트리 중 이름과 구조 해시가 같은 것에 연결, 연결되었으면 true)
+        bool AddTree(std::shared_ptr<Tree> tree)
+        {
+            bool added = false;
+            for (size_t i = 0; tree && i < trace_.trees.size(); ++i)
+            {
+                const TraceTreeInfo& info = trace_.trees[i];
+                if (info.name == tree->GetName() && info.structure_hash == tree->GetStructureHash())
+                {
+                    trees_[i] = tree;
+                    added     = true;
+                }
+            }
+            return added;
+        }
+
+        TraceReplayReport Run()
+        {
+            TraceReplayReport report;
+            report.ns_per_cycle = trace_.ns_per_cycle;
+            for (const auto& info : trace_.trees)
+            {
+                report.trees.push_back({info.name, info.node_names, std::vector<NodeProfile>(info.node_names.size())});
+            }
+            report_ = &report;
+
+            // 기록기가 연결된 트리는 재생 중에만 떼어 둔다 (재생 실행이 다시 기록되지 않도록)
+            std::vector<std::shared_ptr<TraceRecorder>> recorders(trees_.size());
+            for (size_t i = 0; i < trees_.size(); ++i)
+            {
+                if (trees_[i])
+                {
+                    recorders[i] = trees_[i]->GetTraceRecorder();
+                    trees_[i]->SetTraceRecorder(nullptr);
+                }
+            }
+
+            std::vector<uint64_t> key_writes;
+            Context               context;
+            context.SetTracer(this);
+            const auto& events = trace_.events;
+            for (size_t begin = 0; begin < events.size();)
+            {
+                if (events[begin].type != TraceEventType::TICK_BEGIN)
+                {
+                    begin++;
+                    continue;
+                }
+                size_t end = begin + 1;
+                while (end < events.size() && events[end].type != TraceEventType::TICK_END &&
+                       events[end].type != TraceEventType::TICK_BEGIN)
+                {
+                    end++;
+                }
+                if (end == events.size() || events[end].type != TraceEventType::TICK_END)
+                {
+                    begin = end; // 끝나지 않은 틱
+                    continue;
+                }
+
+                for (size_t i = begin; i < end; ++i)
+                {
+                    if (events[i].type == TraceEventType::BLACKBOARD_WRITE)
+                    {
+                        key_writes.resize(std::max<size_t>(key_writes.size(), events[i].id + 1));
+                        key_writes[events[i].id]++;
+                    }
+                }
+                ReplayTick(begin, end, context);
+                begin = end + 1;
+            }
+
+            for (const auto& [id, name] : trace_.keys)
+            {
+                if (id < key_writes.size() && key_writes[id] > 0)
+                {
+                    report.blackboard_writes.emplace_back(name, key_writes[id]);
+                }
+            }
+
+            for (size_t i = 0; i < trees_.size(); ++i)
+            {
+                if (trees_[i])
+                {
+                    trees_[i]->SetTraceRecorder(recorders[i]);
+                }
+            }
+            report_ = nullptr;
+            return report;
+        }
+
+        bool ReplaysLeaves() const override { return true; }
+
+        NodeStatus TraceNode(uint32_t node_id,
+                             bool     leaf,
+                             Context& /* context */,
+                             NodeStatus (*evaluate)(void*),
+                             void* arg) override
+        {
+            if (!divergence_.empty())
+            {
+                return leaf ? NodeStatus::FAILURE : evaluate(arg); // 어긋난 틱은 끝까지 실행만 한다
+            }
+            if (leaf)
+            {
+                const TraceEvent* recorded = Next(node_id);
+                if (!recorded)
+                    return NodeStatus::FAILURE;
+                Account(node_id, *recorded, 0);
+                return static_cast<NodeStatus>(recorded->status);
+            }
+
+            child_cycles_.push_back(0);
+            NodeStatus status   = evaluate(arg);
+            uint64_t   children = child_cycles_.back();
+            child_cycles_.pop_back();
+            if (!divergence_.empty())
+                return status;
+
+            const TraceEvent* recorded = Next(node_id);
+            if (!recorded)
+                return status;
+            if (recorded->status != static_cast<uint8_t>(status))
+            {
+                Diverge("노드 " + NodeName(node_id) + " 결과가 " + StatusName(recorded->status) + "에서 " +
+                        StatusName(static_cast<uint8_t>(status)) + "로 바뀜");
+                return status;
+            }
+            Account(node_id, *recorded, children);
+            return status;
+        }
+
+    private:
+        void ReplayTick(size_t begin, size_t end, Context& context)
+        {
+            const TraceEvent& head = trace_.events[begin];
+            if (head.id >= trees_.size() || !trees_[head.id])
+            {
+                report_->skipped++;
+                return;
+            }
+            Tree& tree = *trees_[head.id];
+            report_->ticks++;
+
+            // 틱 시작 시점 복원 (기록되지 않은 노드는 기본 상태)
+            TreeState& state = context.GetTreeState();
+            state.Bind(&tree, tree.GetNodeCount());
+            state.ResetNodes();
+            recorded_.clear();
+            for (size_t i = begin + 1; i < end; ++i)
+            {
+                const TraceEvent& event = trace_.events[i];
+                switch (event.type)
+                {
+                    case TraceEventType::RNG:
+                        context.GetRng().Restore(event.a, event.b);
+                        break;
+                    case TraceEventType::NODE_STATE:
+                    {
+                        NodeState& node  = context.GetNodeState(event.id);
+                        node.deadline    = std::chrono::steady_clock::time_point(
+                            std::chrono::steady_clock::duration(static_cast<int64_t>(event.a)));
+                        node.counter     = static_cast<int32_t>(static_cast<uint32_t>(event.b));
+                        node.child_index = static_cast<uint32_t>(event.b >> 32);
+                        node.last_status = static_cast<NodeStatus>(event.status);
+                        node.is_running  = (event.flags & TRACE_RUNNING) != 0;
+                        node.started     = (event.flags & TRACE_STARTED) != 0;
+                        break;
+                    }
+                    case TraceEventType::NODE:
+                        recorded_.push_back(&event);
+                        break;
+                    default:
+                        break;
+                }
+            }
+            context.SetAgentId(head.a);
+            context.SetFrameTime(std::chrono::steady_clock::time_point(
+                std::chrono::steady_clock::duration(static_cast<int64_t>(head.b))));
+
+            tree_index_ = head.id;
+            cursor_     = 0;
+            divergence_.clear();
+            child_cycles_.clear();
+
+            NodeStatus status = tree.Execute(context);
+            if (divergence_.empty() && cursor_ != recorded_.size())
+            {
+                Diverge("기록된 노드 " + std::to_string(recorded_.size() - cursor_) + "개가 실행되지 않음");
+            }
+            const uint8_t recorded_status = trace_.events[end].status;
+            if (divergence_.empty() && recorded_status != static_cast<uint8_t>(status))
+            {
+                Diverge("트리 결과가 " + StatusName(recorded_status) + "에서 " +
+                        StatusName(static_cast<uint8_t>(status)) + "로 바뀜");
+            }
+
+            if (divergence_.empty())
+            {
+                report_->matched++;
+            }
+            else if (report_->divergences.size() < kMaxDivergences)
+            {
+                report_->divergences.push_back(tree.GetName() + " 에이전트 " + std::to_string(head.a) + " 틱 " +
+                                               std::to_string(trace_.events[end].b) + ": " + divergence_);
+            }
+        }
+
+        // 다음 기록된 노드 (node_id가 아니면 어긋남)
+        const TraceEvent* Next(uint32_t node_id)
+        {
+            if (cursor_ >= recorded_.size())
+            {
+                Diverge("기록에 없는 노드 " + NodeName(node_id) + " 실행");
+                return nullptr;
+            }
+            const TraceEvent* recorded = recorded_[cursor_];
+            if (recorded->id != node_id)
+            {
+                Diverge("노드 " + NodeName(recorded->id) + " 대신 " + NodeName(node_id) + " 실행");
+                return nullptr;
+            }
+            cursor_++;
+            return recorded;
+        }
+
+        void Account(uint32_t node_id, const TraceEvent& recorded, uint64_t children)
+        {
+            auto& nodes = report_->trees[tree_index_].nodes;
+            if (node_id >= nodes.size())
+            {
+                nodes.resize(node_id + 1);
+            }
+            NodeProfile& profile = nodes[node_id];
+            profile.calls++;
+            profile.status_counts[recorded.status]++;
+            profile.total_cycles += recorded.a;
+            profile.child_cycles += std::min(children, recorded.a);
+            if (!child_cycles_.empty())
+            {
+                child_cycles_.back() += recorded.a;
+            }
+        }
+
+        void Diverge(const std::string& message)
+        {
+            if (divergence_.empty())
+            {
+                divergence_ = message;
+            }
+        }
+
+        std::string NodeName(uint32_t node_id) const
+        {
+            const auto& names = trace_.trees[tree_index_].node_names;
+            return (node_id < names.size() ? names[node_id] : std::string()) + "(" + std::to_string(node_id) + ")";
+        }
+
+        static std::string StatusName(uint8_t status)
+        {
+            static const char* names[] = {"SUCCESS", "FAILURE", "RUNNING"};
+            return status < 3 ? names[status] : "?";
+        }
+
+        TraceData                          trace_;
+        std::vector<std::shared_ptr<Tree>> trees_; // 기록의 트리 번호로 인덱싱
+        TraceReplayReport*                 report_     = nullptr;
+        uint32_t                           tree_index_ = 0;
+        std::vector<const TraceEvent*>     recorded_; // 재생 중인 틱의 NODE 이벤트 (후위 순서)
+        size_t                             cursor_ = 0;
+        std::vector<uint64_t>              child_cycles_; // 평가 중인 제어 노드별 자식 사이클 합
+        std::string                        divergence_;   // 재생 중인 틱에서 처음 어긋난 내용
+    };
+
+} // namespace bt
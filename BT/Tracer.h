@@ -0,0 +1,45 @@
+#pragma once
+
+#include <type_traits>
+
+#include <cstdint>
+
+#include "Node.h"
+
+namespace bt
+{
+
+    // 전방 선언
+    class Context;
+
+    // 노드 실행 추적 훅 (TraceRecorder: 기록, TraceReplayer: 재생)
+    // Context에 연결되어 있는 동안 Node::Tick/CompiledTree::Tick이 노드 평가를 Trace로 감싼다.
+    // 연결되지 않은 틱은 포인터 검사 한 번만 하고, BT_DISABLE_TRACING을 정의하면 검사 자체가 없다.
+    class Tracer
+    {
+    public:
+        virtual ~Tracer() = default;
+
+        // node_id 노드의 평가를 감싼다 (leaf: 자식이 없는 노드, evaluate(arg)가 실제 평가)
+        virtual NodeStatus TraceNode(uint32_t node_id,
+                                     bool     leaf,
+                                     Context& context,
+                                     NodeStatus (*evaluate)(void*),
+                                     void* arg) = 0;
+
+        // 리프를 실행하지 않고 기록된 결과로 대신하는지 (재생 중에는 리프의 Halt 등 부수 효과도 건너뛴다)
+        virtual bool ReplaysLeaves() const { return false; }
+
+        template <typename F>
+        NodeStatus Trace(uint32_t node_id, bool leaf, Context& context, F&& evaluate)
+        {
+            using Function = std::remove_reference_t<F>;
+            return TraceNode(node_id,
+                             leaf,
+                             context,
+                             [](void* arg) -> NodeStatus { return (*static_cast<Function*>(arg))(); },
+                             &evaluate);
+        }
+    };
+
+} // namespace bt
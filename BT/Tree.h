@@ -1,62 +1,380 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <string>
+#include <typeinfo>
+#include <vector>
 
+#include "CompiledTree.h"
+#include "Context.h"
 #include "Node.h"
+#include "Profiler.h"
+#include "Trace.h"
 
 namespace bt
 {
 
-    // 전방 선언
-    class Context;
-
     // Behavior Tree 클래스
+    // 트리는 불변 정의로 여러 에이전트가 공유하고, 실행 상태는 각 에이전트의 Context(TreeState)에 둔다.
     class Tree
     {
     public:
-        Tree(const std::string& name) : name_(name), last_status_(NodeStatus::FAILURE), is_running_(false) {}
+        Tree(const std::string& name) : name_(name), last_status_(NodeStatus::FAILURE) {}
         ~Tree() = default;
 
-        // 트리 구성
-        void                  SetRoot(std::shared_ptr<Node> root) { root_ = root; }
+        // 트리 구성 (노드 id를 다시 부여하므로 공유 전에 완료해야 한다)
+        void SetRoot(std::shared_ptr<Node> root)
+        {
+            root_ = root;
+            compiled_.reset(); // 그래프가 바뀌면 컴파일 결과는 무효
+            node_count_     = root_ ? CompiledTree::AssignNodeIds(root_.get()) : 0;
+            structure_hash_ = root_ ? HashStructure(root_.get(), kHashSeed) : 0;
+            if (profiler_)
+            {
+                EnableProfiling(); // 노드 id가 바뀌었으므로 측정을 새로 시작
+            }
+            SetTraceRecorder(trace_recorder_);
+        }
         std::shared_ptr<Node> GetRoot() const { return root_; }
 
+        // 현재 그래프를 평탄화된 실행 형태로 컴파일 (이후 Execute는 컴파일된 형태로 실행)
+        // 컴파일 후 그래프를 수정했다면 다시 Compile()을 호출해야 한다.
+        std::shared_ptr<CompiledTree> Compile()
+        {
+            if (root_)
+            {
+                node_count_     = CompiledTree::AssignNodeIds(root_.get());
+                structure_hash_ = HashStructure(root_.get(), kHashSeed);
+            }
+            compiled_ = root_ ? std::make_shared<CompiledTree>(root_) : nullptr;
+            SetTraceRecorder(trace_recorder_);
+            return compiled_;
+        }
+        bool                          IsCompiled() const { return compiled_ != nullptr; }
+        std::shared_ptr<CompiledTree> GetCompiled() const { return compiled_; }
+
+        // 실행 모드 (MEMORY: 모든 Sequence/Selector가 실행 중인 자식부터 재개)
+        void          SetExecutionMode(ExecutionMode mode) { mode_ = mode; }
+        ExecutionMode GetExecutionMode() const { return mode_; }
+
+        // 노드별 실행 프로파일링 (켜고 끄기는 이 트리를 실행 중인 스레드가 없을 때 호출)
+        void                      EnableProfiling() { profiler_ = std::make_shared<Profiler>(name_, root_.get()); }
+        void                      DisableProfiling() { profiler_.reset(); }
+        bool                      IsProfiling() const { return profiler_ != nullptr; }
+        std::shared_ptr<Profiler> GetProfiler() const { return profiler_; }
+
+        // 실행 추적 기록 (표본으로 뽑힌 틱만 기록, 연결/해제는 이 트리를 실행 중인 스레드가 없을 때 호출)
+        void SetTraceRecorder(std::shared_ptr<TraceRecorder> recorder)
+        {
+            trace_recorder_ = std::move(recorder);
+            trace_tree_     = trace_recorder_ ? trace_recorder_->RegisterTree(name_, structure_hash_, root_.get()) : 0;
+        }
+        std::shared_ptr<TraceRecorder> GetTraceRecorder() const { return trace_recorder_; }
+
         // 트리 실행
         NodeStatus Execute(Context& context)
         {
             if (!root_)
                 return NodeStatus::FAILURE;
 
-            // 이전 상태가 RUNNING이 아니면 트리 초기화
-            if (last_status_ != NodeStatus::RUNNING)
+            // 실행이 끝날 때마다 트리 전체를 다시 초기화하지 않는다: 분기가 바뀌거나 결과가 결정되면
+            // 각 composite/decorator가 실행 중이던 경로만 HaltSubtree로 중단하고 초기화한다.
+            BeginExecute(context);
+            NodeStatus status = compiled_ ? compiled_->Execute(context) : root_->Tick(context);
+            EndExecute(context, status);
+            return status;
+        }
+
+        // 이 트리를 실행하는 여러 에이전트를 한 번에 실행 (결과는 statuses[0..count))
+        // 컴파일된 트리는 kBatchChunk명씩 노드 단위로 묶어 실행한다 (CompiledTree::ExecuteBatch). 컴파일하지 않았거나
+        // 프로파일링/실행 추적 중이면 에이전트마다 Execute한다. scratch는 호출 스레드가 보관해 재사용한다.
+        void ExecuteBatch(Context* const*             contexts,
+                          size_t                      count,
+                          NodeStatus*                 statuses,
+                          CompiledTree::BatchScratch& scratch)
+        {
+            if (!compiled_ || profiler_ || trace_recorder_)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    statuses[i] = Execute(*contexts[i]);
+                }
+                return;
+            }
+
+            for (size_t begin = 0; begin < count; begin += CompiledTree::kBatchChunk)
+            {
+                const size_t end = std::min(begin + CompiledTree::kBatchChunk, count);
+                for (size_t i = begin; i < end; ++i)
+                {
+                    BeginExecute(*contexts[i]);
+                }
+                compiled_->ExecuteBatch(contexts + begin, end - begin, statuses + begin, scratch);
+                for (size_t i = begin; i < end; ++i)
+                {
+                    EndExecute(*contexts[i], statuses[i]);
+                }
+            }
+        }
+
+        // 다른 트리의 SubTree 노드 안에서 실행 (context의 현재 상태 블록은 SubTree가 이 트리용으로 전환해 둔 것)
+        // 실행 모드와 프로파일러만 이 트리의 것을 쓰고 프레임 시각, 스케줄링 힌트, 난수는 바깥 틱과 공유한다.
+        // 하위 트리의 노드는 추적하지 않는다 (바깥 트리의 실행 추적에는 SubTree가 리프 하나로 남는다).
+        NodeStatus ExecuteNested(Context& context)
+        {
+            if (!root_)
+                return NodeStatus::FAILURE;
+
+            const NestedScope scope = BeginNested(context);
+            NodeStatus        status = compiled_ ? compiled_->Execute(context) : root_->Tick(context);
+            EndNested(context, scope);
+            context.GetTreeState().SetStatus(status);
+            return status;
+        }
+
+        // ExecuteNested의 배치 버전 (모든 컨텍스트가 이 트리용 상태 블록으로 전환되어 있어야 한다)
+        void ExecuteNestedBatch(Context* const*             contexts,
+                                size_t                      count,
+                                NodeStatus*                 statuses,
+                                CompiledTree::BatchScratch& scratch)
+        {
+            if (!compiled_ || profiler_)
             {
-                InitializeTree();
+                for (size_t i = 0; i < count; ++i)
+                {
+                    statuses[i] = ExecuteNested(*contexts[i]);
+                }
+                return;
             }
 
-            // 트리 실행
-            last_status_ = root_->Execute(context);
-            is_running_  = (last_status_ == NodeStatus::RUNNING);
+            // 한 배치의 컨텍스트는 모두 같은 바깥 트리에서 왔으므로 바깥 설정도 같다
+            NestedScope scope{};
+            for (size_t i = 0; i < count; ++i)
+            {
+                scope = BeginNested(*contexts[i]);
+            }
+            compiled_->ExecuteBatch(contexts, count, statuses, scratch);
+            for (size_t i = 0; i < count; ++i)
+            {
+                EndNested(*contexts[i], scope);
+                contexts[i]->GetTreeState().SetStatus(statuses[i]);
+            }
+        }
 
-            return last_status_;
+        // 바깥 메모리 Selector가 SubTree를 선점 가드로 확인할 때
+        // (루트가 조건이거나 조건으로 시작하는 Sequence여야 가드가 있다)
+        bool NestedGuardPasses(Context& context)
+        {
+            if (!root_)
+                return false;
+
+            const NestedScope scope  = BeginNested(context);
+            bool              passed = compiled_ ? compiled_->RootGuardPasses(context)
+                                                 : Selector::GuardPasses(root_.get(), context);
+            EndNested(context, scope);
+            return passed;
         }
 
+        // NestedGuardPasses의 배치 버전 (통과하면 statuses[i]가 SUCCESS, 아니면 FAILURE)
+        void NestedGuardPassesBatch(Context* const*             contexts,
+                                    size_t                      count,
+                                    NodeStatus*                 statuses,
+                                    CompiledTree::BatchScratch& scratch)
+        {
+            if (!compiled_ || profiler_)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    statuses[i] = NestedGuardPasses(*contexts[i]) ? NodeStatus::SUCCESS : NodeStatus::FAILURE;
+                }
+                return;
+            }
+
+            NestedScope scope{};
+            for (size_t i = 0; i < count; ++i)
+            {
+                scope = BeginNested(*contexts[i]);
+            }
+            compiled_->RootGuardPassesBatch(contexts, count, statuses, scratch);
+            for (size_t i = 0; i < count; ++i)
+            {
+                EndNested(*contexts[i], scope);
+            }
+        }
+
+        // 이벤트 기반 스케줄링: 대기 중인 에이전트를 깨울 블랙보드 키/이벤트 이름
+        void                            AddDependency(const std::string& key) { dependencies_.push_back(key); }
+        const std::vector<std::string>& GetDependencies() const { return dependencies_; }
+
+        // 마지막 실행 결과 이 에이전트를 틱하지 않고 대기시켜도 되는지 (RUNNING이고 모든 실행 중 노드가 대기 중)
+        bool CanPark(const Context& context) const { return IsRunning(context) && context.CanSleep(); }
+
         // 트리 정보
         const std::string& GetName() const { return name_; }
-        NodeStatus         GetLastStatus() const { return last_status_; }
-        bool               IsRunning() const { return is_running_; }
+        size_t             GetNodeCount() const { return node_count_; }
+
+        // 노드 구조 해시 (전위 순회의 노드 클래스/타입/이름/자식 수, 파라미터 값은 포함하지 않음)
+        // 해시가 같은 두 트리는 노드 id 배치가 같아 에이전트별 상태를 그대로 옮길 수 있다.
+        uint64_t GetStructureHash() const { return structure_hash_; }
 
-        // 트리 초기화
+        // 핫 리로드: previous를 실행하던 에이전트의 상태를 이 트리로 이전
+        // 구조가 같으면 실행 중인 노드 상태를 유지하고(true), 다르면 상태를 초기화해 처음부터 실행한다(false).
+        bool AdoptState(const Tree& previous, Context& context) const
+        {
+            TreeState& state = context.GetTreeState();
+            if (state.GetTree() != &previous)
+                return false; // previous를 실행한 적이 없으면 다음 Execute에서 새로 준비된다
+
+            // 컴파일 실행은 child_index에 레코드 인덱스를 저장하므로 실행 방식도 같아야 한다
+            if (root_ && previous.structure_hash_ == structure_hash_ && previous.node_count_ == node_count_ &&
+                previous.IsCompiled() == IsCompiled())
+            {
+                state.Rebind(this, node_count_);
+                return true;
+            }
+            state.Bind(this, node_count_);
+            return false;
+        }
+
+        // 마지막으로 실행한 에이전트 기준 상태 (진단용, 에이전트별 상태는 Context로 조회)
+        NodeStatus GetLastStatus() const { return last_status_.load(std::memory_order_relaxed); }
+        bool       IsRunning() const { return GetLastStatus() == NodeStatus::RUNNING; }
+
+        // 에이전트별 상태 조회
+        NodeStatus GetLastStatus(const Context& context) const
+        {
+            const TreeState& state = context.GetTreeState();
+            return state.GetTree() == this ? state.GetStatus() : NodeStatus::FAILURE;
+        }
+        bool IsRunning(const Context& context) const { return GetLastStatus(context) == NodeStatus::RUNNING; }
+
+        // 트리 전체 초기화 (해당 에이전트의 상태 블록 리셋 + 노드별 Initialize 호출)
+        // 실행 중인 에이전트를 처음부터 다시 시작하게 할 때만 명시적으로 호출한다.
+        void InitializeTree(Context& context)
+        {
+            Halt(context);
+            context.GetTreeState().ResetNodes();
+            InitializeTree();
+        }
+
+        // 이 에이전트의 실행 중 경로를 모두 중단 (진행 중인 비동기 작업 취소 등, 노드 상태는 RUNNING이 아니게 된다)
+        void Halt(Context& context)
+        {
+            TreeState& state = context.GetTreeState();
+            if (state.GetTree() != this || state.GetStatus() != NodeStatus::RUNNING)
+                return;
+
+            if (compiled_)
+            {
+                compiled_->Halt(context);
+            }
+            else
+            {
+                root_->HaltSubtree(context);
+            }
+            state.SetStatus(NodeStatus::FAILURE);
+        }
+
+        // 노드 정의의 Initialize 호출 (노드 자체 상태를 쓰는 사용자 노드 호환용)
         void InitializeTree()
         {
-            if (root_)
+            if (compiled_)
             {
-                InitializeNode(root_);
+                compiled_->InitializeNodes();
+            }
+            else if (root_)
+            {
+                InitializeNode(root_.get());
             }
         }
 
     private:
-        void InitializeNode(std::shared_ptr<Node> node)
+        // 틱 시작/끝의 에이전트별 준비와 결과 기록 (Execute와 ExecuteBatch가 공유)
+        void BeginExecute(Context& context)
+        {
+            TreeState& state = context.GetTreeState();
+            state.Bind(this, node_count_);
+            state.BeginTick();
+
+            context.BeginFrame();
+            context.SetExecutionMode(mode_);
+            context.SetProfiler(profiler_.get());
+            context.ResetSchedulingHints();
+            if (trace_recorder_)
+            {
+                context.SetTracer(trace_recorder_->BeginTick(trace_tree_, context) ? trace_recorder_.get() : nullptr);
+            }
+        }
+
+        void EndExecute(Context& context, NodeStatus status)
+        {
+            if (trace_recorder_ && context.GetTracer() == trace_recorder_.get())
+            {
+                trace_recorder_->EndTick(context, status);
+                context.SetTracer(nullptr);
+            }
+            context.GetTreeState().SetStatus(status);
+            last_status_.store(status, std::memory_order_relaxed);
+        }
+
+        // 하위 트리 실행 동안 바꿔 둔 바깥 틱의 설정
+        struct NestedScope
+        {
+            ExecutionMode mode;
+            Profiler*     profiler;
+            Tracer*       tracer;
+        };
+
+        NestedScope BeginNested(Context& context)
+        {
+            TreeState& state = context.GetTreeState();
+            state.Bind(this, node_count_);
+
+            NestedScope scope{context.GetExecutionMode(), context.GetProfiler(), context.GetTracer()};
+            context.SetExecutionMode(mode_);
+            context.SetProfiler(profiler_.get());
+            context.SetTracer(nullptr);
+            return scope;
+        }
+
+        static void EndNested(Context& context, const NestedScope& scope)
+        {
+            context.SetExecutionMode(scope.mode);
+            context.SetProfiler(scope.profiler);
+            context.SetTracer(scope.tracer);
+        }
+
+        static constexpr uint64_t kHashSeed = 14695981039346656037ull; // FNV-1a
+
+        static uint64_t HashCombine(uint64_t hash, uint64_t value)
+        {
+            for (int i = 0; i < 8; ++i)
+            {
+                hash = (hash ^ ((value >> (i * 8)) & 0xff)) * 1099511628211ull;
+            }
+            return hash;
+        }
+
+        static uint64_t HashStructure(const Node* node, uint64_t hash)
+        {
+            if (!node)
+                return HashCombine(hash, 0);
+
+            hash = HashCombine(hash, typeid(*node).hash_code());
+            hash = HashCombine(hash, static_cast<uint64_t>(node->GetType()));
+            hash = HashCombine(hash, std::hash<std::string>()(node->GetName()));
+            hash = HashCombine(hash, node->GetChildren().size());
+            for (const auto& child : node->GetChildren())
+            {
+                hash = HashStructure(child.get(), hash);
+            }
+            return hash;
+        }
+
+        void InitializeNode(Node* node)
         {
             if (!node)
                 return;
@@ -64,14 +382,21 @@ namespace bt
             node->Initialize();
             for (auto& child : node->GetChildren())
             {
-                InitializeNode(child);
+                InitializeNode(child.get());
             }
         }
 
-        std::string           name_;
-        std::shared_ptr<Node> root_;
-        NodeStatus            last_status_;
-        bool                  is_running_;
+        std::string                    name_;
+        std::shared_ptr<Node>          root_;
+        std::shared_ptr<CompiledTree>  compiled_;
+        size_t                         node_count_     = 0;
+        uint64_t                       structure_hash_ = 0;
+        ExecutionMode                  mode_           = ExecutionMode::REACTIVE;
+        std::vector<std::string>       dependencies_;
+        std::shared_ptr<Profiler>      profiler_;
+        std::shared_ptr<TraceRecorder> trace_recorder_;
+        uint32_t                       trace_tree_ = 0; // trace_recorder_에 등록된 트리 번호
+        std::atomic<NodeStatus>        last_status_;
     };
 
 } // namespace bt
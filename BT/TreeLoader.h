@@ -0,0 +1,718 @@
+#pragma once
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+#include <cstring>
+
+#include <nlohmann/json.hpp>
+
+#include "NodeRegistry.h"
+#include "Tree.h"
+
+namespace bt
+{
+
+    // 트리 로드/검증 실패 (메시지에 문제가 된 노드 경로가 들어간다)
+    class TreeLoadError : public std::runtime_error
+    {
+    public:
+        explicit TreeLoadError(const std::string& message) : std::runtime_error(message) {}
+    };
+
+    // 로드한 노드 정의 (JSON/바이너리 공통 중간 형태)
+    struct NodeSpec
+    {
+        std::string                                     type;
+        std::string                                     name;
+        std::vector<std::pair<std::string, ParamValue>> params;
+        std::vector<NodeSpec>                           children;
+    };
+
+    // 로드한 트리 정의
+    struct TreeSpec
+    {
+        std::string                                    name;
+        ExecutionMode                                  mode    = ExecutionMode::REACTIVE;
+        bool                                           compile = true;
+        std::vector<std::string>                       dependencies;
+        std::vector<std::pair<std::string, ParamType>> blackboard; // 트리가 쓰는 블랙보드 키 → 값 타입
+        NodeSpec                                       root;
+    };
+
+    // 데이터 기반 트리 로더
+    //
+    // JSON 형식:
+    //   {
+    //     "name": "goblin_bt",
+    //     "execution_mode": "MEMORY",              // 선택 (기본 REACTIVE)
+    //     "compile": true,                         // 선택 (기본 true)
+    //     "dependencies": ["target"],              // 선택
+    //     "blackboard": {"target": "int"},         // 선택, KEY 파라미터가 참조하는 키와 값 타입
+    //     "root": {"type": "Selector", "name": "goblin_root", "params": {"memory": true}, "children": [...]}
+    //   }
+    //   다른 트리 참조: {"type": "SubTree", "name": "attack", "params": {"tree": "monster_attack"}}
+    //   (엔진에 등록할 때 이름으로 연결된다, Engine::LinkSubTrees)
+    //
+    // 바이너리 형식 (미리 컴파일된 형태, 리틀 엔디언):
+    //   "BTB1" | 버전(u8) | 문자열 테이블 | 트리 헤더 | 노드 (전위 순회)
+    //   정수는 varint(부호 있는 값은 zigzag), 문자열은 중복 제거된 테이블의 인덱스로 저장한다.
+    //   JSON 파싱과 문자열 할당 없이 읽으므로 트리 변형이 많을 때 시작 시간이 짧다.
+    //
+    // 두 형식 모두 생성 전에 등록부 기준으로 검증한다: 노드 타입, 파라미터 이름/타입/필수 여부/허용 값,
+    // KEY 파라미터가 블랙보드 스키마에 같은 타입으로 선언되었는지, 자식 수.
+    class TreeLoader
+    {
+    public:
+        static constexpr uint8_t kBinaryVersion = 1;
+        static constexpr size_t  kMaxDepth      = 256; // 손상된 입력의 재귀 깊이 제한
+
+        explicit TreeLoader(const NodeRegistry& registry) : registry_(registry) {}
+
+        // 로드 (검증 후 트리 생성)
+        std::shared_ptr<Tree> LoadJson(const nlohmann::json& json) const { return Build(ParseJson(json)); }
+        std::shared_ptr<Tree> LoadBinary(const std::vector<uint8_t>& data) const { return Build(ParseBinary(data)); }
+
+        std::shared_ptr<Tree> LoadFile(const std::string& path) const
+        {
+            std::vector<uint8_t> data = ReadFile(path);
+            try
+            {
+                if (IsBinary(data))
+                {
+                    return LoadBinary(data);
+                }
+                return LoadJson(nlohmann::json::parse(data.begin(), data.end()));
+            }
+            catch (const nlohmann::json::exception& e)
+            {
+                throw TreeLoadError(path + ": JSON 파싱 실패: " + e.what());
+            }
+            catch (const TreeLoadError& e)
+            {
+                throw TreeLoadError(path + ": " + e.what());
+            }
+        }
+
+        // JSON → 검증된 바이너리 (빌드 단계에서 미리 컴파일할 때 사용)
+        std::vector<uint8_t> Precompile(const nlohmann::json& json) const
+        {
+            TreeSpec spec = ParseJson(json);
+            Validate(spec);
+            return ToBinary(spec);
+        }
+
+        // 등록부 기준 검증 (실패 시 TreeLoadError)
+        void Validate(const TreeSpec& spec) const
+        {
+            std::unordered_map<std::string, ParamType> schema;
+            for (const auto& entry : spec.blackboard)
+            {
+                if (!schema.emplace(entry.first, entry.second).second)
+                {
+                    throw TreeLoadError(spec.name + ": 블랙보드 키가 중복 선언됨: " + entry.first);
+                }
+            }
+            ValidateNode(spec.root, schema, spec.name + "/" + spec.root.name);
+        }
+
+        // 검증 후 트리 생성
+        std::shared_ptr<Tree> Build(const TreeSpec& spec) const
+        {
+            Validate(spec);
+
+            auto tree = std::make_shared<Tree>(spec.name);
+            tree->SetRoot(BuildNode(spec.root));
+            tree->SetExecutionMode(spec.mode);
+            for (const auto& dependency : spec.dependencies)
+            {
+                tree->AddDependency(dependency);
+            }
+            if (spec.compile)
+            {
+                tree->Compile();
+            }
+            return tree;
+        }
+
+        // JSON → 중간 형태 (형식 오류만 검사, 등록부 검증은 Validate)
+        static TreeSpec ParseJson(const nlohmann::json& json)
+        {
+            if (!json.is_object())
+            {
+                throw TreeLoadError("트리 정의는 JSON 객체여야 합니다");
+            }
+
+            TreeSpec spec;
+            spec.name = RequireString(json, "name", "<tree>");
+
+            if (json.contains("execution_mode"))
+            {
+                std::string mode = RequireString(json, "execution_mode", spec.name);
+                if (mode == "MEMORY")
+                    spec.mode = ExecutionMode::MEMORY;
+                else if (mode != "REACTIVE")
+                    throw TreeLoadError(spec.name + ": 알 수 없는 execution_mode: " + mode);
+            }
+
+            if (json.contains("compile"))
+            {
+                if (!json["compile"].is_boolean())
+                    throw TreeLoadError(spec.name + ": compile은 bool이어야 합니다");
+                spec.compile = json["compile"].get<bool>();
+            }
+
+            if (json.contains("dependencies"))
+            {
+                const auto& dependencies = json["dependencies"];
+                if (!dependencies.is_array())
+                    throw TreeLoadError(spec.name + ": dependencies는 문자열 배열이어야 합니다");
+                for (const auto& dependency : dependencies)
+                {
+                    if (!dependency.is_string())
+                        throw TreeLoadError(spec.name + ": dependencies는 문자열 배열이어야 합니다");
+                    spec.dependencies.push_back(dependency.get<std::string>());
+                }
+            }
+
+            if (json.contains("blackboard"))
+            {
+                const auto& blackboard = json["blackboard"];
+                if (!blackboard.is_object())
+                    throw TreeLoadError(spec.name + ": blackboard는 키 → 타입 객체여야 합니다");
+                for (auto it = blackboard.begin(); it != blackboard.end(); ++it)
+                {
+                    ParamType type;
+                    if (!it.value().is_string() || !ParseValueType(it.value().get<std::string>(), type))
+                    {
+                        throw TreeLoadError(spec.name + ": 블랙보드 키 " + it.key() +
+                                            "의 타입은 int/float/bool/string 중 하나여야 합니다");
+                    }
+                    spec.blackboard.emplace_back(it.key(), type);
+                }
+            }
+
+            if (!json.contains("root"))
+            {
+                throw TreeLoadError(spec.name + ": root가 없습니다");
+            }
+            spec.root = ParseJsonNode(json["root"], spec.name, 0);
+            return spec;
+        }
+
+        // 중간 형태 → 바이너리
+        static std::vector<uint8_t> ToBinary(const TreeSpec& spec)
+        {
+            BinaryWriter writer;
+            writer.Collect(spec);
+
+            std::vector<uint8_t>& out = writer.out;
+            out.insert(out.end(), {'B', 'T', 'B', '1', kBinaryVersion});
+            writer.WriteVarint(writer.strings.size());
+            for (const auto& text : writer.strings)
+            {
+                writer.WriteVarint(text.size());
+                out.insert(out.end(), text.begin(), text.end());
+            }
+
+            writer.WriteString(spec.name);
+            out.push_back(static_cast<uint8_t>(spec.mode));
+            out.push_back(spec.compile ? 1 : 0);
+            writer.WriteVarint(spec.dependencies.size());
+            for (const auto& dependency : spec.dependencies)
+            {
+                writer.WriteString(dependency);
+            }
+            writer.WriteVarint(spec.blackboard.size());
+            for (const auto& entry : spec.blackboard)
+            {
+                writer.WriteString(entry.first);
+                out.push_back(static_cast<uint8_t>(entry.second));
+            }
+            writer.WriteNode(spec.root);
+            return out;
+        }
+
+        // 바이너리 → 중간 형태
+        static TreeSpec ParseBinary(const std::vector<uint8_t>& data)
+        {
+            if (!IsBinary(data))
+            {
+                throw TreeLoadError("바이너리 트리 형식이 아닙니다");
+            }
+
+            BinaryReader reader(data, 4); // 매직 다음부터
+            if (reader.ReadByte() != kBinaryVersion)
+            {
+                throw TreeLoadError("지원하지 않는 바이너리 트리 버전");
+            }
+
+            size_t string_count = reader.ReadCount();
+            reader.strings.reserve(string_count);
+            for (size_t i = 0; i < string_count; ++i)
+            {
+                size_t length = reader.ReadCount();
+                reader.strings.emplace_back(reinterpret_cast<const char*>(data.data() + reader.pos), length);
+                reader.pos += length;
+            }
+
+            TreeSpec spec;
+            spec.name    = reader.ReadString();
+            spec.mode    = reader.ReadByte() == static_cast<uint8_t>(ExecutionMode::MEMORY) ? ExecutionMode::MEMORY
+                                                                                            : ExecutionMode::REACTIVE;
+            spec.compile = reader.ReadByte() != 0;
+            size_t count = reader.ReadCount();
+            for (size_t i = 0; i < count; ++i)
+            {
+                spec.dependencies.push_back(reader.ReadString());
+            }
+            count = reader.ReadCount();
+            for (size_t i = 0; i < count; ++i)
+            {
+                std::string key  = reader.ReadString();
+                uint8_t     type = reader.ReadByte();
+                if (type > static_cast<uint8_t>(ParamType::STRING))
+                {
+                    throw TreeLoadError(spec.name + ": 잘못된 블랙보드 키 타입: " + key);
+                }
+                spec.blackboard.emplace_back(std::move(key), static_cast<ParamType>(type));
+            }
+            spec.root = reader.ReadNode(0);
+            if (reader.pos != data.size())
+            {
+                throw TreeLoadError(spec.name + ": 바이너리 트리 뒤에 남는 데이터가 있습니다");
+            }
+            return spec;
+        }
+
+        static bool IsBinary(const std::vector<uint8_t>& data)
+        {
+            return data.size() >= 5 && std::memcmp(data.data(), "BTB1", 4) == 0;
+        }
+
+        static std::vector<uint8_t> ReadFile(const std::string& path)
+        {
+            std::ifstream file(path, std::ios::binary);
+            if (!file)
+            {
+                throw TreeLoadError(path + ": 파일을 열 수 없습니다");
+            }
+            return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+
+    private:
+        // 파라미터 값 태그 (바이너리 형식, ParamValue의 인덱스와 같다)
+        enum ValueTag : uint8_t
+        {
+            TAG_INT,
+            TAG_FLOAT,
+            TAG_BOOL,
+            TAG_STRING
+        };
+
+        struct BinaryWriter
+        {
+            std::vector<uint8_t>                      out;
+            std::vector<std::string>                  strings;
+            std::unordered_map<std::string, uint64_t> indices;
+
+            void Intern(const std::string& text)
+            {
+                if (indices.emplace(text, strings.size()).second)
+                {
+                    strings.push_back(text);
+                }
+            }
+
+            void Collect(const TreeSpec& spec)
+            {
+                Intern(spec.name);
+                for (const auto& dependency : spec.dependencies)
+                {
+                    Intern(dependency);
+                }
+                for (const auto& entry : spec.blackboard)
+                {
+                    Intern(entry.first);
+                }
+                Collect(spec.root);
+            }
+
+            void Collect(const NodeSpec& node)
+            {
+                Intern(node.type);
+                Intern(node.name);
+                for (const auto& param : node.params)
+                {
+                    Intern(param.first);
+                    if (const auto* text = std::get_if<std::string>(&param.second))
+                    {
+                        Intern(*text);
+                    }
+                }
+                for (const auto& child : node.children)
+                {
+                    Collect(child);
+                }
+            }
+
+            void WriteVarint(uint64_t value)
+            {
+                while (value >= 0x80)
+                {
+                    out.push_back(static_cast<uint8_t>(value | 0x80));
+                    value >>= 7;
+                }
+                out.push_back(static_cast<uint8_t>(value));
+            }
+
+            void WriteString(const std::string& text) { WriteVarint(indices.at(text)); }
+
+            void WriteNode(const NodeSpec& node)
+            {
+                WriteString(node.type);
+                WriteString(node.name);
+                WriteVarint(node.params.size());
+                for (const auto& param : node.params)
+                {
+                    WriteString(param.first);
+                    out.push_back(static_cast<uint8_t>(param.second.index()));
+                    switch (param.second.index())
+                    {
+                        case TAG_INT:
+                        {
+                            int64_t value = std::get<int64_t>(param.second);
+                            WriteVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+                            break;
+                        }
+                        case TAG_FLOAT:
+                        {
+                            uint64_t bits;
+                            double   value = std::get<double>(param.second);
+                            std::memcpy(&bits, &value, sizeof(bits));
+                            for (int i = 0; i < 8; ++i)
+                            {
+                                out.push_back(static_cast<uint8_t>(bits >> (i * 8)));
+                            }
+                            break;
+                        }
+                        case TAG_BOOL:
+                            out.push_back(std::get<bool>(param.second) ? 1 : 0);
+                            break;
+                        default:
+                            WriteString(std::get<std::string>(param.second));
+                            break;
+                    }
+                }
+                WriteVarint(node.children.size());
+                for (const auto& child : node.children)
+                {
+                    WriteNode(child);
+                }
+            }
+        };
+
+        struct BinaryReader
+        {
+            BinaryReader(const std::vector<uint8_t>& bytes, size_t offset) : data(bytes), pos(offset) {}
+
+            const std::vector<uint8_t>& data;
+            size_t                      pos;
+            std::vector<std::string>    strings;
+
+            uint8_t ReadByte()
+            {
+                if (pos >= data.size())
+                {
+                    throw TreeLoadError("바이너리 트리가 중간에 끝났습니다");
+                }
+                return data[pos++];
+            }
+
+            uint64_t ReadVarint()
+            {
+                uint64_t value = 0;
+                for (int shift = 0; shift < 64; shift += 7)
+                {
+                    uint8_t byte = ReadByte();
+                    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+                    if ((byte & 0x80) == 0)
+                        return value;
+                }
+                throw TreeLoadError("바이너리 트리의 varint가 너무 깁니다");
+            }
+
+            // 개수/길이 (남은 바이트 수를 넘을 수 없다)
+            size_t ReadCount()
+            {
+                uint64_t count = ReadVarint();
+                if (count > data.size() - pos)
+                {
+                    throw TreeLoadError("바이너리 트리의 길이 값이 잘못되었습니다");
+                }
+                return static_cast<size_t>(count);
+            }
+
+            const std::string& ReadString()
+            {
+                uint64_t index = ReadVarint();
+                if (index >= strings.size())
+                {
+                    throw TreeLoadError("바이너리 트리의 문자열 인덱스가 범위를 벗어났습니다");
+                }
+                return strings[index];
+            }
+
+            NodeSpec ReadNode(size_t depth)
+            {
+                if (depth > kMaxDepth)
+                {
+                    throw TreeLoadError("바이너리 트리가 너무 깊습니다");
+                }
+
+                NodeSpec node;
+                node.type          = ReadString();
+                node.name          = ReadString();
+                size_t param_count = ReadCount();
+                node.params.reserve(param_count);
+                for (size_t i = 0; i < param_count; ++i)
+                {
+                    const std::string& name = ReadString();
+                    switch (ReadByte())
+                    {
+                        case TAG_INT:
+                        {
+                            uint64_t raw = ReadVarint();
+                            node.params.emplace_back(name, static_cast<int64_t>((raw >> 1) ^ (~(raw & 1) + 1)));
+                            break;
+                        }
+                        case TAG_FLOAT:
+                        {
+                            uint64_t bits = 0;
+                            for (int b = 0; b < 8; ++b)
+                            {
+                                bits |= static_cast<uint64_t>(ReadByte()) << (b * 8);
+                            }
+                            double value;
+                            std::memcpy(&value, &bits, sizeof(value));
+                            node.params.emplace_back(name, value);
+                            break;
+                        }
+                        case TAG_BOOL:
+                            node.params.emplace_back(name, ReadByte() != 0);
+                            break;
+                        case TAG_STRING:
+                            node.params.emplace_back(name, ReadString());
+                            break;
+                        default:
+                            throw TreeLoadError(node.name + ": 잘못된 파라미터 태그: " + name);
+                    }
+                }
+
+                size_t child_count = ReadCount();
+                node.children.reserve(child_count);
+                for (size_t i = 0; i < child_count; ++i)
+                {
+                    node.children.push_back(ReadNode(depth + 1));
+                }
+                return node;
+            }
+        };
+
+        static std::string RequireString(const nlohmann::json& json, const char* field, const std::string& path)
+        {
+            auto it = json.find(field);
+            if (it == json.end() || !it->is_string())
+            {
+                throw TreeLoadError(path + ": " + field + " 문자열이 필요합니다");
+            }
+            return it->get<std::string>();
+        }
+
+        static NodeSpec ParseJsonNode(const nlohmann::json& json, const std::string& parent_path, size_t depth)
+        {
+            if (depth > kMaxDepth)
+            {
+                throw TreeLoadError(parent_path + ": 트리가 너무 깊습니다");
+            }
+            if (!json.is_object())
+            {
+                throw TreeLoadError(parent_path + ": 노드는 JSON 객체여야 합니다");
+            }
+
+            NodeSpec node;
+            node.type        = RequireString(json, "type", parent_path);
+            node.name        = json.contains("name") ? RequireString(json, "name", parent_path) : node.type;
+            std::string path = parent_path + "/" + node.name;
+
+            if (json.contains("params"))
+            {
+                const auto& params = json["params"];
+                if (!params.is_object())
+                    throw TreeLoadError(path + ": params는 객체여야 합니다");
+                for (auto it = params.begin(); it != params.end(); ++it)
+                {
+                    const auto& value = it.value();
+                    if (value.is_boolean())
+                        node.params.emplace_back(it.key(), value.get<bool>());
+                    else if (value.is_number_integer())
+                        node.params.emplace_back(it.key(), value.get<int64_t>());
+                    else if (value.is_number_float())
+                        node.params.emplace_back(it.key(), value.get<double>());
+                    else if (value.is_string())
+                        node.params.emplace_back(it.key(), value.get<std::string>());
+                    else
+                        throw TreeLoadError(path + ": 파라미터 " + it.key() + "는 숫자/bool/문자열이어야 합니다");
+                }
+            }
+
+            if (json.contains("children"))
+            {
+                const auto& children = json["children"];
+                if (!children.is_array())
+                    throw TreeLoadError(path + ": children은 배열이어야 합니다");
+                for (size_t i = 0; i < children.size(); ++i)
+                {
+                    std::string child_path = path + "[" + std::to_string(i) + "]";
+                    node.children.push_back(ParseJsonNode(children[i], child_path, depth + 1));
+                }
+            }
+            return node;
+        }
+
+        // 선언 타입에 맞는 값인지 (FLOAT 파라미터에는 정수도 허용)
+        static bool MatchesType(const ParamValue& value, ParamType type)
+        {
+            switch (type)
+            {
+                case ParamType::INT:
+                    return std::holds_alternative<int64_t>(value);
+                case ParamType::FLOAT:
+                    return std::holds_alternative<double>(value) || std::holds_alternative<int64_t>(value);
+                case ParamType::BOOL:
+                    return std::holds_alternative<bool>(value);
+                default:
+                    return std::holds_alternative<std::string>(value);
+            }
+        }
+
+        void ValidateNode(const NodeSpec&                                   node,
+                          const std::unordered_map<std::string, ParamType>& schema,
+                          const std::string&                                path) const
+        {
+            const NodeTypeInfo* info = registry_.Find(node.type);
+            if (!info)
+            {
+                throw TreeLoadError(path + ": 등록되지 않은 노드 타입: " + node.type);
+            }
+
+            for (const auto& param : node.params)
+            {
+                const ParamSpec* spec = info->FindParam(param.first);
+                if (!spec)
+                {
+                    throw TreeLoadError(path + ": " + node.type + "에 없는 파라미터: " + param.first);
+                }
+                if (!MatchesType(param.second, spec->type))
+                {
+                    throw TreeLoadError(path + ": 파라미터 " + param.first + "는 " + ParamTypeName(spec->type) +
+                                        " 타입이어야 합니다");
+                }
+                if (!spec->choices.empty() &&
+                    std::find(spec->choices.begin(), spec->choices.end(), std::get<std::string>(param.second)) ==
+                        spec->choices.end())
+                {
+                    throw TreeLoadError(path + ": 파라미터 " + param.first +
+                                        "의 허용되지 않는 값: " + std::get<std::string>(param.second));
+                }
+                if (spec->type == ParamType::KEY)
+                {
+                    const std::string& key = std::get<std::string>(param.second);
+                    auto               it  = schema.find(key);
+                    if (it == schema.end())
+                    {
+                        throw TreeLoadError(path + ": 블랙보드에 선언되지 않은 키: " + key);
+                    }
+                    if (it->second != spec->key_type)
+                    {
+                        throw TreeLoadError(path + ": 블랙보드 키 " + key + "는 " + ParamTypeName(it->second) +
+                                            "로 선언되었지만 " + param.first + "는 " +
+                                            ParamTypeName(spec->key_type) + " 키가 필요합니다");
+                    }
+                }
+            }
+
+            for (const auto& spec : info->params)
+            {
+                if (!spec.required)
+                    continue;
+                bool found = std::any_of(node.params.begin(), node.params.end(),
+                                         [&](const auto& param) { return param.first == spec.name; });
+                if (!found)
+                {
+                    throw TreeLoadError(path + ": 필수 파라미터가 없습니다: " + spec.name);
+                }
+            }
+
+            if (node.children.size() < info->min_children || node.children.size() > info->max_children)
+            {
+                std::string expected = info->max_children == info->min_children
+                                           ? std::to_string(info->min_children)
+                                           : std::to_string(info->min_children) + " 이상";
+                if (info->max_children != info->min_children &&
+                    info->max_children != std::numeric_limits<size_t>::max())
+                {
+                    expected = std::to_string(info->min_children) + "~" + std::to_string(info->max_children);
+                }
+                throw TreeLoadError(path + ": " + node.type + "의 자식 수는 " + expected + "개여야 합니다 (현재 " +
+                                    std::to_string(node.children.size()) + "개)");
+            }
+
+            for (size_t i = 0; i < node.children.size(); ++i)
+            {
+                const NodeSpec& child = node.children[i];
+                ValidateNode(child, schema, path + "[" + std::to_string(i) + "]/" + child.name);
+            }
+        }
+
+        std::shared_ptr<Node> BuildNode(const NodeSpec& node) const
+        {
+            const NodeTypeInfo* info = registry_.Find(node.type);
+
+            NodeParams params;
+            for (const auto& spec : info->params)
+            {
+                if (!spec.required)
+                {
+                    params.Set(spec.name, spec.default_value);
+                }
+            }
+            for (const auto& param : node.params)
+            {
+                params.Set(param.first, param.second);
+            }
+
+            std::shared_ptr<Node> built = info->factory(node.name, params);
+            if (!built)
+            {
+                throw TreeLoadError(node.name + ": " + node.type + " 생성 함수가 노드를 만들지 못했습니다");
+            }
+            for (const auto& child : node.children)
+            {
+                built->AddChild(BuildNode(child));
+            }
+            return built;
+        }
+
+        const NodeRegistry& registry_;
+    };
+
+} // namespace bt
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include <cstdint>
+
+#include "Context.h"
+#include "Tree.h"
+
+namespace bt
+{
+
+    // 트리 이름 하나에 게시된 현재 버전 (핫 리로드용, RCU 방식)
+    // 새 트리는 완성된 뒤 Publish로 통째로 교체하고, 이전 버전은 그것을 실행 중인 마지막 에이전트가 놓을 때 해제된다.
+    // 틱 경로는 버전 번호만 원자적으로 읽으며, 포인터 읽기는 버전이 바뀐 경우에만 일어난다.
+    class TreeSlot
+    {
+    public:
+        explicit TreeSlot(const std::string& name) : name_(name) {}
+
+        TreeSlot(const TreeSlot&)            = delete;
+        TreeSlot& operator=(const TreeSlot&) = delete;
+
+        // 새 버전 게시 (트리를 먼저 게시한 뒤 버전을 올리므로, 새 버전을 본 읽기는 새 트리 이상을 읽는다)
+        uint64_t Publish(std::shared_ptr<Tree> tree)
+        {
+            std::atomic_store_explicit(&tree_, std::move(tree), std::memory_order_release);
+            return version_.fetch_add(1, std::memory_order_acq_rel) + 1;
+        }
+
+        std::shared_ptr<Tree> Load() const { return std::atomic_load_explicit(&tree_, std::memory_order_acquire); }
+        uint64_t              GetVersion() const { return version_.load(std::memory_order_acquire); }
+        const std::string&    GetName() const { return name_; }
+
+    private:
+        std::string           name_;
+        std::shared_ptr<Tree> tree_; // std::atomic_load/store로만 접근
+        std::atomic<uint64_t> version_{0};
+    };
+
+    // 실행자 쪽 트리 참조 (슬롯을 따라가며 틱 경계에서 새 버전으로 교체)
+    // 한 실행자 안에서만 쓰며, 교체는 Acquire/Execute를 호출하는 틱 스레드에서 일어난다.
+    //
+    // 실행 상태 이전: 새 트리의 구조 해시가 같으면(노드 타입/이름/자식 수가 같아 노드 id가 일치) 에이전트의
+    // 노드 상태를 그대로 이어받아 실행 중인 노드에서 계속하고, 다르면 상태를 버리고 새 트리를 처음부터 실행한다.
+    class TreeBinding
+    {
+    public:
+        TreeBinding() = default;
+        explicit TreeBinding(std::shared_ptr<TreeSlot> slot) { Bind(std::move(slot)); }
+
+        // 슬롯 연결 (다음 Acquire에서 현재 버전을 가져온다)
+        void Bind(std::shared_ptr<TreeSlot> slot)
+        {
+            slot_    = std::move(slot);
+            version_ = 0;
+        }
+
+        // 고정 트리 사용 (핫 리로드 없음)
+        void SetTree(std::shared_ptr<Tree> tree)
+        {
+            slot_.reset();
+            tree_ = std::move(tree);
+        }
+
+        // 틱 시작 시 호출: 새 버전이 게시되었으면 교체하고 context의 실행 상태를 이전한다
+        const std::shared_ptr<Tree>& Acquire(Context& context)
+        {
+            if (slot_)
+            {
+                uint64_t version = slot_->GetVersion();
+                if (version != version_)
+                {
+                    version_                   = version;
+                    std::shared_ptr<Tree> next = slot_->Load();
+                    if (next != tree_)
+                    {
+                        if (tree_ && next)
+                        {
+                            next->AdoptState(*tree_, context);
+                        }
+                        tree_ = std::move(next);
+                        reload_count_++;
+                    }
+                }
+            }
+            return tree_;
+        }
+
+        NodeStatus Execute(Context& context)
+        {
+            const std::shared_ptr<Tree>& tree = Acquire(context);
+            return tree ? tree->Execute(context) : NodeStatus::FAILURE;
+        }
+
+        const std::shared_ptr<Tree>&     GetTree() const { return tree_; }
+        const std::shared_ptr<TreeSlot>& GetSlot() const { return slot_; }
+        uint64_t                         GetVersion() const { return version_; }
+        uint64_t                         GetReloadCount() const { return reload_count_; } // 처음 가져온 것 포함
+
+    private:
+        std::shared_ptr<TreeSlot> slot_;
+        std::shared_ptr<Tree>     tree_;
+        uint64_t                  version_      = 0; // 마지막으로 확인한 슬롯 버전 (0 = 아직 안 가져옴)
+        uint64_t                  reload_count_ = 0;
+    };
+
+} // namespace bt
@@ -1,19 +1,24 @@
 #pragma once
 
-#include "../../../BT/Node.h"
+#include "../../../BT/AgentNode.h"
 
 namespace bt
 {
+
+    // 전방 선언
+    class TestClient;
+
     namespace action
     {
 
         // 플레이어 공격 액션 노드
-        class Attack : public Node
+        class Attack : public AgentNode<TestClient>
         {
         public:
-            Attack(const std::string& name) : Node(name, NodeType::ACTION) {}
+            Attack(const std::string& name) : AgentNode(name, NodeType::ACTION) {}
 
-            NodeStatus Execute(Context& context) override;
+        protected:
+            NodeStatus ExecuteAgent(TestClient& client, Context& context) override;
         };
 
     } // namespace action
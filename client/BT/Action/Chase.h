@@ -1,19 +1,24 @@
 #pragma once
 
-#include "../../../BT/Node.h"
+#include "../../../BT/AgentNode.h"
 
 namespace bt
 {
+
+    // 전방 선언
+    class TestClient;
+
     namespace action
     {
 
         // 플레이어 추적 액션 노드
-        class Chase : public Node
+        class Chase : public AgentNode<TestClient>
         {
         public:
-            Chase(const std::string& name) : Node(name, NodeType::ACTION) {}
+            Chase(const std::string& name) : AgentNode(name, NodeType::ACTION) {}
 
-            NodeStatus Execute(Context& context) override;
+        protected:
+            NodeStatus ExecuteAgent(TestClient& client, Context& context) override;
         };
 
     } // namespace action
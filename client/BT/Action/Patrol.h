@@ -1,19 +1,24 @@
 #pragma once
 
-#include "../../../BT/Node.h"
+#include "../../../BT/AgentNode.h"
 
 namespace bt
 {
+
+    // 전방 선언
+    class TestClient;
+
     namespace action
     {
 
         // 플레이어 순찰 액션 노드
-        class Patrol : public Node
+        class Patrol : public AgentNode<TestClient>
         {
         public:
-            Patrol(const std::string& name) : Node(name, NodeType::ACTION) {}
+            Patrol(const std::string& name) : AgentNode(name, NodeType::ACTION) {}
 
-            NodeStatus Execute(Context& context) override;
+        protected:
+            NodeStatus ExecuteAgent(TestClient& client, Context& context) override;
         };
 
     } // namespace action
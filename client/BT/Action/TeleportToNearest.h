@@ -1,20 +1,25 @@
 #pragma once
 
-#include "../../../BT/Node.h"
+#include "../../../BT/AgentNode.h"
 
 namespace bt
 {
+
+    // 전방 선언
+    class TestClient;
+
     namespace action
     {
 
         // 가장 가까운 몬스터로 텔레포트하는 액션 노드
-        class TeleportToNearest : public Node
+        class TeleportToNearest : public AgentNode<TestClient>
         {
         public:
-            TeleportToNearest(const std::string& name) : Node(name, NodeType::ACTION) {}
+            TeleportToNearest(const std::string& name) : AgentNode(name, NodeType::ACTION) {}
             virtual ~TeleportToNearest() = default;
 
-            NodeStatus Execute(Context& context) override;
+        protected:
+            NodeStatus ExecuteAgent(TestClient& client, Context& context) override;
         };
 
     } // namespace action
@@ -9,36 +9,28 @@ namespace bt
     namespace condition
     {
 
-        NodeStatus HasTarget::Execute(Context& context)
+        HasTarget::HasTarget(const std::string& name) : AgentNode(name, NodeType::CONDITION)
         {
-            // AI 클라이언트 가져오기
-            auto ai = context.GetAI();
-            if (!ai)
-            {
-                return NodeStatus::FAILURE;
-            }
-
-            auto client_executor = std::dynamic_pointer_cast<TestClient>(ai);
-            if (!client_executor)
-            {
-                return NodeStatus::FAILURE;
-            }
+            DeclarePure("HasTarget", {"target"});
+        }
 
+        NodeStatus HasTarget::ExecuteAgent(TestClient& client, Context& /* context */)
+        {
             // 타겟이 있는지 확인
-            uint32_t target_id  = client_executor->GetTargetID();
-            bool     has_target = client_executor->HasTarget();
+            uint32_t target_id  = client.GetTargetID();
+            bool     has_target = client.HasTarget();
 
             std::cout << "HasTarget 조건 체크: target_id=" << target_id
                       << ", has_target=" << (has_target ? "true" : "false") << std::endl;
 
             if (has_target)
             {
-                std::cout << "플레이어 " << client_executor->GetName() << " 타겟 발견: ID " << target_id << std::endl;
+                std::cout << "플레이어 " << client.GetName() << " 타겟 발견: ID " << target_id << std::endl;
                 return NodeStatus::SUCCESS;
             }
             else
             {
-                std::cout << "플레이어 " << client_executor->GetName() << " 타겟 없음" << std::endl;
+                std::cout << "플레이어 " << client.GetName() << " 타겟 없음" << std::endl;
                 return NodeStatus::FAILURE;
             }
         }
@@ -1,19 +1,25 @@
 #pragma once
 
-#include "../../../BT/Node.h"
+#include "../../../BT/AgentNode.h"
 
 namespace bt
 {
+
+    // 전방 선언
+    class TestClient;
+
     namespace condition
     {
 
         // 타겟이 있는지 확인하는 조건 노드
-        class HasTarget : public Node
+        class HasTarget : public AgentNode<TestClient>
         {
         public:
-            HasTarget(const std::string& name) : Node(name, NodeType::CONDITION) {}
+            // 틱 단위 순수 조건 (한 틱에 여러 Sequence에서 확인해도 한 번만 계산, 블랙보드 "target"이 쓰이면 재계산)
+            HasTarget(const std::string& name);
 
-            NodeStatus Execute(Context& context) override;
+        protected:
+            NodeStatus ExecuteAgent(TestClient& client, Context& context) override;
         };
 
     } // namespace condition
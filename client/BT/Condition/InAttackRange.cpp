@@ -9,34 +9,21 @@ namespace bt
     namespace condition
     {
 
-        NodeStatus InAttackRange::Execute(Context& context)
+        NodeStatus InAttackRange::ExecuteAgent(TestClient& client, Context& /* context */)
         {
-            // AI 클라이언트 가져오기
-            auto ai = context.GetAI();
-            if (!ai)
-            {
-                return NodeStatus::FAILURE;
-            }
-
-            auto client_executor = std::dynamic_pointer_cast<TestClient>(ai);
-            if (!client_executor)
-            {
-                return NodeStatus::FAILURE;
-            }
-
             // 타겟이 있는지 확인
-            if (!client_executor->HasTarget())
+            if (!client.HasTarget())
             {
                 return NodeStatus::FAILURE;
             }
 
             // 공격 범위 내에 있는지 확인
-            float distance     = client_executor->GetDistanceToTarget();
-            float attack_range = client_executor->GetAttackRange();
+            float distance     = client.GetDistanceToTarget();
+            float attack_range = client.GetAttackRange();
 
             if (distance <= attack_range)
             {
-                std::cout << "플레이어 " << client_executor->GetName() << " 공격 범위 내: 거리 " << distance
+                std::cout << "플레이어 " << client.GetName() << " 공격 범위 내: 거리 " << distance
                           << " <= " << attack_range << std::endl;
                 return NodeStatus::SUCCESS;
             }
@@ -1,19 +1,24 @@
 #pragma once
 
-#include "../../../BT/Node.h"
+#include "../../../BT/AgentNode.h"
 
 namespace bt
 {
+
+    // 전방 선언
+    class TestClient;
+
     namespace condition
     {
 
         // 탐지 범위 내에 있는지 확인하는 조건 노드
-        class InDetectionRange : public Node
+        class InDetectionRange : public AgentNode<TestClient>
         {
         public:
-            InDetectionRange(const std::string& name) : Node(name, NodeType::CONDITION) {}
+            InDetectionRange(const std::string& name) : AgentNode(name, NodeType::CONDITION) {}
 
-            NodeStatus Execute(Context& context) override;
+        protected:
+            NodeStatus ExecuteAgent(TestClient& client, Context& context) override;
         };
 
     } // namespace condition
@@ -9,27 +9,13 @@ namespace bt
     namespace condition
     {
 
-        NodeStatus TeleportTimer::Execute(Context& context)
+        NodeStatus TeleportTimer::ExecuteAgent(TestClient& client, Context& /* context */)
         {
-            // AI 클라이언트 가져오기
-            auto ai = context.GetAI();
-            if (!ai)
-            {
-                return NodeStatus::FAILURE;
-            }
-
-            auto client_executor = std::dynamic_pointer_cast<TestClient>(ai);
-            if (!client_executor)
-            {
-                return NodeStatus::FAILURE;
-            }
-
             // 타겟이 없거나 탐지 범위 밖에 있을 때만 타이머 체크
-            if (!client_executor->HasTarget() ||
-                client_executor->GetDistanceToTarget() > client_executor->GetDetectionRange())
+            if (!client.HasTarget() || client.GetDistanceToTarget() > client.GetDetectionRange())
             {
                 // 텔레포트 타이머 가져오기
-                float teleport_timer = client_executor->GetTeleportTimer();
+                float teleport_timer = client.GetTeleportTimer();
 
                 if (teleport_timer >= TELEPORT_TIMEOUT)
                 {
@@ -47,7 +33,7 @@ namespace bt
             else
             {
                 // 타겟이 탐지 범위 내에 있으면 타이머 리셋
-                client_executor->ResetTeleportTimer();
+                client.ResetTeleportTimer();
                 return NodeStatus::FAILURE; // 텔레포트 불필요
             }
         }
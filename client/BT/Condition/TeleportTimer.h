@@ -1,21 +1,26 @@
 #pragma once
 
-#include "../../../BT/Node.h"
+#include "../../../BT/AgentNode.h"
 
 namespace bt
 {
+
+    // 전방 선언
+    class TestClient;
+
     namespace condition
     {
 
         // 텔레포트 타이머 조건 노드
         // 3초 동안 타겟을 찾지 못했는지 확인
-        class TeleportTimer : public Node
+        class TeleportTimer : public AgentNode<TestClient>
         {
         public:
-            TeleportTimer(const std::string& name) : Node(name, NodeType::CONDITION) {}
+            TeleportTimer(const std::string& name) : AgentNode(name, NodeType::CONDITION) {}
             virtual ~TeleportTimer() = default;
 
-            NodeStatus Execute(Context& context) override;
+        protected:
+            NodeStatus ExecuteAgent(TestClient& client, Context& context) override;
 
         private:
             static constexpr float TELEPORT_TIMEOUT = 3.0f; // 3초
@@ -63,6 +63,7 @@ namespace bt
     {
         // shared_from_this() 사용을 위해 context에 AI 설정
         context_.SetAI(shared_from_this());
+        context_.SetAgent(this); // 리프(AgentNode<TestClient>)가 타입 조회 없이 받는 참조
 
         // 메시지 큐 시스템 초기화 (shared_from_this() 사용 가능한 시점)
         InitializeMessageQueue();
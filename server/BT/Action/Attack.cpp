@@ -2,7 +2,6 @@
 
 #include "../../BT/Context.h"
 #include "../Monster/Monster.h"
-#include "../Monster/MonsterBTExecutor.h"
 #include "Attack.h"
 
 namespace bt
@@ -10,37 +9,20 @@ namespace bt
     namespace action
     {
 
-        NodeStatus Attack::Execute(Context& context)
+        NodeStatus Attack::ExecuteAgent(Monster& monster, Context& context)
         {
-            auto ai = context.GetAI();
-            if (!ai)
-            {
-                return NodeStatus::FAILURE;
-            }
-
-            auto monster_executor = std::dynamic_pointer_cast<MonsterBTExecutor>(ai);
-            if (!monster_executor)
-            {
-                return NodeStatus::FAILURE;
-            }
-
-            auto monster = monster_executor->GetMonster();
-            if (!monster)
-            {
-                return NodeStatus::FAILURE;
-            }
-
             // 타겟이 있는지 확인
-            if (monster->GetTargetID() == 0)
+            if (monster.GetTargetID() == 0)
             {
                 return NodeStatus::FAILURE;
             }
 
             // 공격 실행
-            std::cout << "Goblin " << monster->GetName() << " attacks target!" << std::endl;
+            std::cout << "Goblin " << monster.GetName() << " attacks target for "
+                      << context.Get(monster_keys::attack_power) << " damage!" << std::endl;
 
             // 공격 애니메이션/이펙트 처리
-            monster->SetState(MonsterStateType::ATTACK);
+            monster.SetState(MonsterStateType::ATTACK);
 
             return NodeStatus::SUCCESS;
         }
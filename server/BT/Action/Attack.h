@@ -1,20 +1,25 @@
 #pragma once
 
-#include "../../BT/Node.h"
+#include "../../BT/AgentNode.h"
 #include "../Monster/MonsterTypes.h"
 
 namespace bt
 {
+
+    // 전방 선언
+    class Monster;
+
     namespace action
     {
 
         // 공격 액션 노드
-        class Attack : public Node
+        class Attack : public AgentNode<Monster>
         {
         public:
-            Attack(const std::string& name) : Node(name, NodeType::ACTION) {}
+            Attack(const std::string& name) : AgentNode(name, NodeType::ACTION) {}
 
-            NodeStatus Execute(Context& context) override;
+        protected:
+            NodeStatus ExecuteAgent(Monster& monster, Context& context) override;
         };
 
     } // namespace action
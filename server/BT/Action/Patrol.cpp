@@ -4,7 +4,6 @@
 
 #include "../../BT/Context.h"
 #include "../Monster/Monster.h"
-#include "../Monster/MonsterBTExecutor.h"
 #include "Patrol.h"
 
 namespace bt
@@ -12,35 +11,17 @@ namespace bt
     namespace action
     {
 
-        NodeStatus Patrol::Execute(Context& context)
+        NodeStatus Patrol::ExecuteAgent(Monster& monster, Context& context)
         {
-            auto ai = context.GetAI();
-            if (!ai)
-            {
-                return NodeStatus::FAILURE;
-            }
-
-            auto monster_executor = std::dynamic_pointer_cast<MonsterBTExecutor>(ai);
-            if (!monster_executor)
-            {
-                return NodeStatus::FAILURE;
-            }
-
-            auto monster = monster_executor->GetMonster();
-            if (!monster)
-            {
-                return NodeStatus::FAILURE;
-            }
-
             // 순찰점이 있는지 확인
-            if (!monster->HasPatrolPoints())
+            if (!monster.HasPatrolPoints())
             {
                 return NodeStatus::FAILURE;
             }
 
             // 다음 순찰점 가져오기
-            auto        target_point = monster->GetNextPatrolPoint();
-            const auto& current_pos  = monster->GetPosition();
+            auto        target_point = monster.GetNextPatrolPoint();
+            const auto& current_pos  = monster.GetPosition();
 
             // 목표 지점까지의 거리 계산
             float dx       = target_point.x - current_pos.x;
@@ -52,18 +33,18 @@ namespace bt
 
             if (distance <= arrival_threshold)
             {
-                // std::cout << "Goblin " << monster->GetName() << " reached patrol point: ("
+                // std::cout << "Goblin " << monster.GetName() << " reached patrol point: ("
                 //           << target_point.x << ", " << target_point.y << ", " << target_point.z << ")" << std::endl;
                 // 도착 지점에 도달했을 때도 정확한 위치로 이동
-                monster->MoveTo(target_point.x, target_point.y, target_point.z, current_pos.rotation);
+                monster.MoveTo(target_point.x, target_point.y, target_point.z, current_pos.rotation);
                 // 다음 순찰점으로 인덱스 이동
-                monster->AdvanceToNextPatrolPoint();
+                monster.AdvanceToNextPatrolPoint();
                 return NodeStatus::SUCCESS;
             }
             else
             {
-                // 목표 지점으로 이동
-                float move_speed = monster->GetStats().move_speed;
+                // 목표 지점으로 이동 (이동 속도는 몬스터 타입 설정 계층에서 읽음)
+                float move_speed = context.Get(monster_keys::move_speed);
 
                 // 정규화된 방향 벡터 계산
                 float normalized_dx = dx / distance;
@@ -74,9 +55,9 @@ namespace bt
                 float new_x     = current_pos.x + normalized_dx * step_size;
                 float new_z     = current_pos.z + normalized_dz * step_size;
 
-                monster->MoveTo(new_x, current_pos.y, new_z, current_pos.rotation);
+                monster.MoveTo(new_x, current_pos.y, new_z, current_pos.rotation);
 
-                // std::cout << "Goblin " << monster->GetName() << " moving to patrol point: ("
+                // std::cout << "Goblin " << monster.GetName() << " moving to patrol point: ("
                 //           << new_x << ", " << current_pos.y << ", " << new_z << ")" << std::endl;
 
                 return NodeStatus::RUNNING;
@@ -1,8 +1,5 @@
-#include <iostream>
-
 #include "../../BT/Context.h"
 #include "../Monster/Monster.h"
-#include "../Monster/MonsterBTExecutor.h"
 #include "HasTarget.h"
 
 namespace bt
@@ -10,37 +7,25 @@ namespace bt
     namespace condition
     {
 
-        NodeStatus HasTarget::Execute(Context& context)
+        HasTarget::HasTarget(const std::string& name) : BatchCondition(name)
         {
-            auto ai = context.GetAI();
-            if (!ai)
-            {
-                return NodeStatus::FAILURE;
-            }
-
-            auto monster_executor = std::dynamic_pointer_cast<MonsterBTExecutor>(ai);
-            if (!monster_executor)
-            {
-                return NodeStatus::FAILURE;
-            }
-
-            auto monster = monster_executor->GetMonster();
-            if (!monster)
-            {
-                return NodeStatus::FAILURE;
-            }
-
-            // 타겟이 있는지 확인
-            bool has_target = (monster->GetTargetID() != 0);
+            DeclarePure("HasTarget");
+        }
 
-            if (has_target)
+        void HasTarget::EvaluateBatch(Monster* const* monsters,
+                                      Context* const* /* contexts */,
+                                      size_t   count,
+                                      uint8_t* passed)
+        {
+            // 타겟 id를 배열로 모은 뒤 비교 (비교 루프는 분기가 없어 벡터화된다)
+            uint32_t target_ids[kBlockSize];
+            for (size_t i = 0; i < count; ++i)
             {
-                std::cout << "Goblin " << monster->GetName() << " has target: " << monster->GetTargetID() << std::endl;
-                return NodeStatus::SUCCESS;
+                target_ids[i] = monsters[i]->GetTargetID();
             }
-            else
+            for (size_t i = 0; i < count; ++i)
             {
-                return NodeStatus::FAILURE;
+                passed[i] = target_ids[i] != 0;
             }
         }
 
@@ -1,20 +1,31 @@
 #pragma once
 
-#include "../../BT/Node.h"
+#include "../../BT/BatchNode.h"
 #include "../Monster/MonsterTypes.h"
 
 namespace bt
 {
+
+    // 전방 선언
+    class Monster;
+
     namespace condition
     {
 
-        // 타겟이 있는지 확인하는 조건 노드
-        class HasTarget : public Node
+        // 타겟이 있는지 확인하는 조건 노드 (배치 실행 시 몬스터 묶음의 타겟 id를 한 번에 확인)
+        class HasTarget : public BatchCondition<Monster>
         {
         public:
-            HasTarget(const std::string& name) : Node(name, NodeType::CONDITION) {}
+            // 틱 단위 순수 조건 (한 틱에 여러 Sequence에서 확인해도 한 번만 계산)
+            // 블랙보드가 아니라 Monster::GetTargetID를 읽으므로 무효화할 키가 없다. 타겟은 틱 안에서 바뀌지 않는다고
+            // 가정한다 (틱 중에 타겟을 바꾸는 노드를 추가하면 타겟을 블랙보드 키로 옮기고 그 키로 무효화한다).
+            HasTarget(const std::string& name);
 
-            NodeStatus Execute(Context& context) override;
+        protected:
+            void EvaluateBatch(Monster* const* monsters,
+                               Context* const* contexts,
+                               size_t          count,
+                               uint8_t*        passed) override;
         };
 
     } // namespace condition
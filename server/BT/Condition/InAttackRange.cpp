@@ -1,10 +1,5 @@
-#include <iostream>
-
-#include <cmath>
-
 #include "../../BT/Context.h"
 #include "../Monster/Monster.h"
-#include "../Monster/MonsterBTExecutor.h"
 #include "InAttackRange.h"
 
 namespace bt
@@ -12,48 +7,25 @@ namespace bt
     namespace condition
     {
 
-        NodeStatus InAttackRange::Execute(Context& context)
+        void InAttackRange::EvaluateBatch(Monster* const* monsters,
+                                          Context* const* contexts,
+                                          size_t          count,
+                                          uint8_t*        passed)
         {
-            auto ai = context.GetAI();
-            if (!ai)
-            {
-                return NodeStatus::FAILURE;
-            }
-
-            auto monster_executor = std::dynamic_pointer_cast<MonsterBTExecutor>(ai);
-            if (!monster_executor)
-            {
-                return NodeStatus::FAILURE;
-            }
-
-            auto monster = monster_executor->GetMonster();
-            if (!monster)
-            {
-                return NodeStatus::FAILURE;
-            }
-
-            // 타겟이 있는지 확인
-            if (monster->GetTargetID() == 0)
-            {
-                return NodeStatus::FAILURE;
-            }
-
-            // TODO: 실제 타겟 위치를 가져와서 거리 계산
-            // 현재는 시뮬레이션을 위해 랜덤하게 성공/실패 반환
-            static int call_count = 0;
-            call_count++;
-
-            // 10번 중 3번 정도만 공격 범위 내에 있다고 가정
-            bool in_range = (call_count % 10) < 3;
-
-            if (in_range)
-            {
-                std::cout << "Goblin " << monster->GetName() << " is in attack range!" << std::endl;
-                return NodeStatus::SUCCESS;
-            }
-            else
+            for (size_t i = 0; i < count; ++i)
             {
-                return NodeStatus::FAILURE;
+                // 타겟이 없으면 실패
+                if (monsters[i]->GetTargetID() == 0)
+                {
+                    passed[i] = 0;
+                    continue;
+                }
+
+                // TODO: 실제 타겟 위치를 가져와서 거리 계산
+                // 현재는 시뮬레이션을 위해 10번 중 3번 정도만 공격 범위 내에 있다고 가정
+                // 호출 횟수는 트리를 공유하는 다른 몬스터와 섞이지 않도록 에이전트별 노드 상태에 저장
+                int call_count = ++contexts[i]->GetNodeState(GetId()).counter;
+                passed[i]      = (call_count % 10) < 3;
             }
         }
 
@@ -1,20 +1,28 @@
 #pragma once
 
-#include "../../BT/Node.h"
+#include "../../BT/BatchNode.h"
 #include "../Monster/MonsterTypes.h"
 
 namespace bt
 {
+
+    // 전방 선언
+    class Monster;
+
     namespace condition
     {
 
-        // 공격 범위 내에 있는지 확인하는 조건 노드
-        class InAttackRange : public Node
+        // 공격 범위 내에 있는지 확인하는 조건 노드 (배치 실행 시 몬스터 묶음을 한 번에 확인)
+        class InAttackRange : public BatchCondition<Monster>
         {
         public:
-            InAttackRange(const std::string& name) : Node(name, NodeType::CONDITION) {}
+            InAttackRange(const std::string& name) : BatchCondition(name) {}
 
-            NodeStatus Execute(Context& context) override;
+        protected:
+            void EvaluateBatch(Monster* const* monsters,
+                               Context* const* contexts,
+                               size_t          count,
+                               uint8_t*        passed) override;
         };
 
     } // namespace condition
@@ -81,6 +81,11 @@ namespace bt
 
         uint32_t id   = monster->GetID();
         monsters_[id] = monster;
+        spatial_grid_.Insert(id, monster->GetPosition().x, monster->GetPosition().z);
+        if (bt_engine_)
+        {
+            bt_engine_->GetScheduler().Add(id);
+        }
 
         // 스폰 메시지 전송
         auto position = monster->GetPosition();
@@ -88,8 +93,8 @@ namespace bt
                                 monster->GetName(),
                                 MonsterFactory::MonsterTypeToString(monster->GetType()),
                                 position,
-                                monster->GetStats().health,
-                                monster->GetStats().max_health);
+                                monster->GetHealth(),
+                                monster->GetMaxHealth());
 
         std::cout << "몬스터 추가됨: " << monster->GetName() << " (ID: " << id << ")" << std::endl;
     }
@@ -106,6 +111,17 @@ namespace bt
             SendMonsterDeathMessage(monster_id, monster->GetName(), position);
 
             monsters_.erase(it);
+            spatial_grid_.Remove(monster_id);
+            if (bt_engine_)
+            {
+                bt_engine_->GetScheduler().Remove(monster_id);
+            }
+
+            // 몬스터 ↔ AI 순환 참조를 끊어 AI 컨텍스트가 소멸하고 아레나가 풀로 돌아가게 한다
+            if (auto ai = monster->GetAI())
+            {
+                ai->SetMonster(nullptr);
+            }
             std::cout << "몬스터 제거됨: " << monster->GetName() << " (ID: " << monster_id << ")" << std::endl;
         }
     }
@@ -132,21 +148,38 @@ namespace bt
     std::vector<std::shared_ptr<Monster>> MessageBasedMonsterManager::GetMonstersInRange(
         const MonsterPosition& position, float range)
     {
+        // 평면(XZ) 거리 기준, 격자에서 주변 칸만 훑는다 (AI 병렬 단계에서 동시에 불려도 되도록 공유 버퍼를 쓰지 않는다)
         std::vector<std::shared_ptr<Monster>> result;
+        spatial_grid_.ForEachInRadius(position.x,
+                                      position.z,
+                                      range,
+                                      [&](uint32_t id, float /* distance_sq */)
+                                      {
+                                          auto it = monsters_.find(id);
+                                          if (it != monsters_.end() && it->second)
+                                          {
+                                              result.push_back(it->second);
+                                          }
+                                      });
 
-        for (const auto& pair : monsters_)
-        {
-            auto monster = pair.second;
-            if (!monster)
-                continue;
+        return result;
+    }
 
-            auto  monster_pos = monster->GetPosition();
-            float distance =
-                std::sqrt(std::pow(monster_pos.x - position.x, 2) + std::pow(monster_pos.z - position.z, 2));
+    std::vector<std::shared_ptr<Monster>> MessageBasedMonsterManager::GetNearestMonsters(
+        const MonsterPosition& position, size_t count, float range)
+    {
+        // 평면(XZ) 거리 기준, 가까운 순서
+        std::vector<SpatialGrid::Hit> hits;
+        spatial_grid_.QueryNearest(position.x, position.z, count, range, hits);
 
-            if (distance <= range)
+        std::vector<std::shared_ptr<Monster>> result;
+        result.reserve(hits.size());
+        for (const auto& hit : hits)
+        {
+            auto it = monsters_.find(hit.id);
+            if (it != monsters_.end() && it->second)
             {
-                result.push_back(monster);
+                result.push_back(it->second);
             }
         }
 
@@ -159,22 +192,27 @@ namespace bt
     {
         uint32_t id = next_monster_id_++;
 
-        // MonsterFactory를 사용하여 AI가 포함된 몬스터 생성
-        auto monster = MonsterFactory::CreateMonster(type, name, position);
+        // MonsterFactory를 사용하여 AI가 포함된 몬스터 생성 (AI 컨텍스트는 재사용 아레나에서 할당)
+        auto monster = MonsterFactory::CreateMonster(type, name, position, arena_pool_.Acquire());
         if (!monster)
         {
             std::cerr << "몬스터 생성 실패: " << name << std::endl;
             return nullptr;
         }
+        monster->SetID(id);
+        if (monster->GetAI())
+        {
+            monster->GetAI()->GetContext().SeedRandom(id); // 같은 ID면 같은 랜덤 선택 (AI 재현용)
+        }
 
         // Behavior Tree 설정
         if (bt_engine_ && monster->GetAI())
         {
             std::string bt_name = monster->GetBTName();
-            auto        tree    = bt_engine_->GetTree(bt_name);
-            if (tree)
+            auto        slot    = bt_engine_->GetTreeSlot(bt_name);
+            if (slot && slot->Load())
             {
-                monster->GetAI()->SetBehaviorTree(tree);
+                monster->GetAI()->BindTreeSlot(slot); // 핫 리로드된 버전을 다음 틱에 가져감
                 std::cout << "몬스터 생성: " << name << " (타입: " << static_cast<int>(type) << ", BT: " << bt_name
                           << ")" << std::endl;
             }
@@ -328,6 +366,15 @@ namespace bt
     {
         bt_engine_ = engine;
 
+        // 이미 있는 몬스터도 스케줄러에 등록
+        if (bt_engine_)
+        {
+            for (const auto& pair : monsters_)
+            {
+                bt_engine_->GetScheduler().Add(pair.first);
+            }
+        }
+
         // 기존 몬스터들에게도 BT 엔진 설정은 Monster 클래스에서 직접 지원하지 않으므로 주석 처리
         // for (auto& pair : monsters_) {
         //     if (pair.second) {
@@ -336,6 +383,12 @@ namespace bt
         // }
     }
 
+    void MessageBasedMonsterManager::SetSpatialUpdateMode(SpatialUpdateMode mode)
+    {
+        spatial_mode_ = mode;
+        RebuildSpatialGrid(); // 어느 방식이든 현재 위치에서 시작
+    }
+
     void MessageBasedMonsterManager::SetMessageProcessor(std::shared_ptr<GameMessageProcessor> processor)
     {
         message_processor_ = processor;
@@ -397,6 +450,8 @@ namespace bt
 
     void MessageBasedMonsterManager::Stop()
     {
+        // 동시에 불린 다른 Stop이 join 중이면 끝날 때까지 기다린다 (반환 시 업데이트 스레드는 항상 종료된 상태)
+        std::lock_guard<std::mutex> lock(stop_mutex_);
         if (!running_)
             return;
 
@@ -465,6 +520,50 @@ namespace bt
 
     void MessageBasedMonsterManager::ProcessMonsterUpdates(float delta_time)
     {
+        if (bt_engine_)
+        {
+            // 이벤트 기반: 대기 중(Delay 등)인 몬스터는 깨어날 때까지 건너뛴다
+            auto& scheduler = bt_engine_->GetScheduler();
+            auto  now       = std::chrono::steady_clock::now(); // 이번 프레임의 시각 (타이머 휠과 시간 노드가 공유)
+            tick_ids_.clear();
+            tick_batch_.clear();
+            for (uint32_t id : scheduler.CollectReady(now))
+            {
+                auto it = monsters_.find(id);
+                if (it == monsters_.end() || !it->second || !it->second->GetAI())
+                    continue;
+                tick_ids_.push_back(id);
+                tick_batch_.push_back(it->second->GetAI());
+            }
+
+            // 병렬 단계: 각 AI는 자기 몬스터만 수정한다. monsters_ 등 매니저 상태는 이 동안 읽기 전용이다.
+            // 배리어 이후 commit 단계에서 대기 여부를 배치 순서대로 반영
+            // (현재 몬스터 트리는 순찰이 항상 실행 중이라 재울 틱이 없다, 대기 노드를 쓰는 트리부터 효과가 있다)
+            // 같은 트리를 쓰는 몬스터는 노드 단위로 묶어 실행 (HasTarget 등은 몬스터 묶음에 대해 한 번 호출)
+            // AI가 옮긴 몬스터의 격자 위치도 commit 단계에서 반영한다 (병렬 단계 동안 격자는 읽기 전용)
+            const bool incremental = spatial_mode_ == SpatialUpdateMode::INCREMENTAL;
+            bt_engine_->TickAllBatched(tick_batch_,
+                                       delta_time,
+                                       now,
+                                       [this, incremental](size_t index, IExecutor& ai)
+                                       {
+                                           auto tree = ai.GetBehaviorTree();
+                                           if (tree)
+                                           {
+                                               bt_engine_->ParkIfIdle(tick_ids_[index], *tree, ai.GetContext());
+                                           }
+                                           if (incremental)
+                                           {
+                                               SyncMonsterPosition(tick_ids_[index]);
+                                           }
+                                       });
+            if (!incremental)
+            {
+                RebuildSpatialGrid();
+            }
+            return;
+        }
+
         for (auto& pair : monsters_)
         {
             auto monster = pair.second;
@@ -476,6 +575,36 @@ namespace bt
 
             // 위치 변경 감지 및 메시지 전송
             // (실제 구현에서는 이전 위치와 비교)
+            if (spatial_mode_ == SpatialUpdateMode::INCREMENTAL)
+            {
+                spatial_grid_.Move(pair.first, monster->GetPosition().x, monster->GetPosition().z);
+            }
+        }
+        if (spatial_mode_ == SpatialUpdateMode::REBUILD)
+        {
+            RebuildSpatialGrid();
+        }
+    }
+
+    void MessageBasedMonsterManager::SyncMonsterPosition(uint32_t monster_id)
+    {
+        auto it = monsters_.find(monster_id);
+        if (it != monsters_.end() && it->second)
+        {
+            // 같은 칸 안의 이동은 좌표만 바뀐다
+            spatial_grid_.Move(monster_id, it->second->GetPosition().x, it->second->GetPosition().z);
+        }
+    }
+
+    void MessageBasedMonsterManager::RebuildSpatialGrid()
+    {
+        spatial_grid_.Clear();
+        for (const auto& [id, monster] : monsters_)
+        {
+            if (monster)
+            {
+                spatial_grid_.Insert(id, monster->GetPosition().x, monster->GetPosition().z);
+            }
         }
     }
 
@@ -628,9 +757,9 @@ namespace bt
             state.set_z(pos.z);
             state.set_rotation(pos.rotation);
 
-            state.set_health(monster->GetStats().health);
+            state.set_health(monster->GetHealth());
             state.set_max_health(monster->GetMaxHealth());
-            state.set_level(monster->GetStats().level);
+            state.set_level(monster->GetLevel());
             state.set_type(static_cast<uint32_t>(monster->GetType()));
 
             states.push_back(state);
@@ -11,8 +11,10 @@
 #include <vector>
 
 #include "../../../shared/Game/PacketProtocol.h"
+#include "../../BT/AgentArena.h"
 #include "../../Common/GameMessageProcessor.h"
 #include "../../Common/GameMessages.h"
+#include "../../World/SpatialGrid.h"
 #include "Monster.h"
 #include "MonsterTypes.h"
 
@@ -23,6 +25,7 @@ namespace bt
     class PlayerManager;
     class MessageBasedPlayerManager;
     class Engine;
+    class IExecutor;
 } // namespace bt
 
 namespace bt
@@ -44,6 +47,9 @@ namespace bt
         std::shared_ptr<Monster>              GetMonster(uint32_t monster_id);
         std::vector<std::shared_ptr<Monster>> GetAllMonsters();
         std::vector<std::shared_ptr<Monster>> GetMonstersInRange(const MonsterPosition& position, float range);
+        std::vector<std::shared_ptr<Monster>> GetNearestMonsters(const MonsterPosition& position,
+                                                                 size_t                 count,
+                                                                 float                  range); // 가까운 순서
 
         // 몬스터 생성
         std::shared_ptr<Monster> SpawnMonster(MonsterType            type,
@@ -66,6 +72,9 @@ namespace bt
         // Behavior Tree 엔진 설정
         void SetBTEngine(std::shared_ptr<Engine> engine);
 
+        // 주변 탐색용 공간 인덱스 갱신 방식 (기본 INCREMENTAL: 이번 프레임에 틱한 몬스터만 commit 단계에서 갱신)
+        void SetSpatialUpdateMode(SpatialUpdateMode mode);
+
         // 메시지 프로세서 설정
         void SetMessageProcessor(std::shared_ptr<GameMessageProcessor> processor);
 
@@ -92,6 +101,17 @@ namespace bt
         std::atomic<uint32_t>                                                  next_monster_id_;
         std::atomic<bool>                                                      auto_spawn_enabled_;
 
+        // 몬스터 AI 컨텍스트용 아레나 (디스폰된 몬스터의 아레나를 다음 스폰에 재사용)
+        AgentArenaPool arena_pool_;
+
+        // 프레임별 AI 틱 배치 (재사용)
+        std::vector<uint32_t>                   tick_ids_;
+        std::vector<std::shared_ptr<IExecutor>> tick_batch_;
+
+        // 몬스터 위치 격자 (monsters_와 같이 업데이트 스레드에서만 접근, AI 병렬 단계 동안은 읽기 전용)
+        SpatialGrid       spatial_grid_;
+        SpatialUpdateMode spatial_mode_ = SpatialUpdateMode::INCREMENTAL;
+
         // 의존성
         std::shared_ptr<Engine>                    bt_engine_;
         std::shared_ptr<GameMessageProcessor>      message_processor_;
@@ -99,6 +119,7 @@ namespace bt
 
         // 업데이트 스레드
         std::thread       update_thread_;
+        std::mutex        stop_mutex_; // Stop이 여러 스레드에서 불려도 업데이트 스레드를 한 번만 join
         std::atomic<bool> running_{false};
         std::atomic<bool> update_enabled_{true};
 
@@ -111,6 +132,9 @@ namespace bt
         void ProcessMonsterUpdates(float delta_time);
         void UpdateThread();
 
+        void SyncMonsterPosition(uint32_t monster_id); // INCREMENTAL: 한 마리의 격자 위치 갱신
+        void RebuildSpatialGrid();                     // REBUILD: 전체 다시 채움
+
         MonsterPosition GetRandomRespawnPoint() const;
 
         // JSON 파싱 헬퍼 함수들
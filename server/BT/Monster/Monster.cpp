@@ -27,8 +27,10 @@ namespace bt
         , current_patrol_index_(0)
         , spawn_position_(position)
     {
-        // 기본 통계 설정
-        stats_            = MonsterFactory::GetDefaultStats(type);
+        // 타입별 설정은 공유 Blackboard로, 체력/마나만 최대치로 채워 몬스터별로 보관
+        config_           = MonsterFactory::GetConfigBlackboard(type);
+        health_           = GetMaxHealth();
+        mana_             = GetMaxMana();
         last_update_time_ = std::chrono::steady_clock::now();
 
         // 기본 순찰점 설정 (스폰 위치 주변)
@@ -69,20 +71,20 @@ namespace bt
 
     void Monster::TakeDamage(uint32_t damage)
     {
-        if (damage >= stats_.health)
+        if (damage >= health_)
         {
-            stats_.health = 0;
-            state_        = MonsterStateType::DEAD;
-            death_time_   = std::chrono::duration_cast<std::chrono::milliseconds>(
-                              std::chrono::steady_clock::now().time_since_epoch())
-                              .count() /
-                          1000.0f;
+            health_     = 0;
+            state_      = MonsterStateType::DEAD;
+            death_time_ = std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::steady_clock::now().time_since_epoch())
+                            .count() /
+                        1000.0f;
             std::cout << "몬스터 " << name_ << " 사망!" << std::endl;
         }
         else
         {
-            stats_.health -= damage;
-            std::cout << "몬스터 " << name_ << " 데미지 받음: " << damage << " (남은 체력: " << stats_.health << ")"
+            health_ -= damage;
+            std::cout << "몬스터 " << name_ << " 데미지 받음: " << damage << " (남은 체력: " << health_ << ")"
                       << std::endl;
         }
     }
@@ -94,18 +96,13 @@ namespace bt
             return;
         }
 
-        uint32_t old_health = stats_.health;
-        stats_.health += amount;
+        uint32_t old_health = health_;
+        health_             = std::min(health_ + amount, GetMaxHealth());
 
-        if (stats_.health > stats_.max_health)
-        {
-            stats_.health = stats_.max_health;
-        }
-
-        uint32_t actual_heal = stats_.health - old_health;
+        uint32_t actual_heal = health_ - old_health;
         if (actual_heal > 0)
         {
-            std::cout << "몬스터 " << name_ << " 치료됨: " << actual_heal << " (현재 체력: " << stats_.health << ")"
+            std::cout << "몬스터 " << name_ << " 치료됨: " << actual_heal << " (현재 체력: " << health_ << ")"
                       << std::endl;
         }
     }
@@ -119,18 +116,20 @@ namespace bt
         // TODO: 서버에서 플레이어 정보를 주입받아 처리
         // 현재는 빈 구현으로 두고 서버에서 실제 로직 처리
 
-        // 주변 몬스터 검색
+        // 주변 몬스터 검색 (후보는 호출자가 공간 격자로 좁혀 넘긴다, 여기서는 3D 거리로 최종 확인)
+        const float detection_range = GetDetectionRange();
+        const float detection_sq    = detection_range * detection_range;
         for (const auto& monster : monsters)
         {
             if (!monster || monster.get() == this || !monster->IsAlive())
                 continue;
 
             const auto& monster_pos = monster->GetPosition();
-            float       distance =
-                std::sqrt(std::pow(monster_pos.x - position_.x, 2) + std::pow(monster_pos.y - position_.y, 2) +
-                          std::pow(monster_pos.z - position_.z, 2));
+            const float dx          = monster_pos.x - position_.x;
+            const float dy          = monster_pos.y - position_.y;
+            const float dz          = monster_pos.z - position_.z;
 
-            if (distance <= stats_.detection_range)
+            if (dx * dx + dy * dy + dz * dz <= detection_sq)
             {
                 environment_info_.nearby_monsters.push_back(monster->GetTargetID());
             }
@@ -148,12 +147,12 @@ namespace bt
 
     bool Monster::HasEnemyInAttackRange() const
     {
-        return HasEnemyInRange(stats_.attack_range);
+        return HasEnemyInRange(GetAttackRange());
     }
 
     bool Monster::HasEnemyInDetectionRange() const
     {
-        return HasEnemyInRange(stats_.detection_range);
+        return HasEnemyInRange(GetDetectionRange());
     }
 
     bool Monster::HasEnemyInChaseRange() const
@@ -181,7 +180,7 @@ namespace bt
         if (target_id == environment_info_.nearest_enemy_id)
         {
             return environment_info_.has_line_of_sight &&
-                   environment_info_.nearest_enemy_distance <= stats_.detection_range;
+                   environment_info_.nearest_enemy_distance <= GetDetectionRange();
         }
 
         return false;
@@ -221,8 +220,8 @@ namespace bt
             return;
 
         // TODO: 실제 타겟에게 데미지 주기 (PlayerManager를 통해)
-        std::cout << "Monster " << name_ << " attacks target " << target_id_ << " for " << damage_ << " damage!"
-                  << std::endl;
+        std::cout << "Monster " << name_ << " attacks target " << target_id_ << " for " << GetAttackPower()
+                  << " damage!" << std::endl;
 
         // 공격 상태로 변경
         SetState(MonsterStateType::ATTACK);
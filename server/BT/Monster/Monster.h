@@ -42,13 +42,22 @@ namespace bt
         void                   SetPosition(float x, float y, float z, float rotation = 0.0f);
         void                   MoveTo(float x, float y, float z, float rotation = 0.0f);
 
-        // 통계 관련
-        const MonsterStats& GetStats() const { return stats_; }
-        void                SetStats(const MonsterStats& stats) { stats_ = stats; }
-        void                TakeDamage(uint32_t damage);
-        void                Heal(uint32_t amount);
-        bool                IsAlive() const { return stats_.health > 0; }
-        uint32_t            GetMaxHealth() const { return stats_.max_health; }
+        // 통계 관련 (체력/마나만 몬스터별, 나머지는 타입별 설정 Blackboard에서 읽음)
+        uint32_t GetHealth() const { return health_; }
+        uint32_t GetMana() const { return mana_; }
+        void     TakeDamage(uint32_t damage);
+        void     Heal(uint32_t amount);
+        bool     IsAlive() const { return health_ > 0; }
+        uint32_t GetLevel() const { return config_->Get(monster_keys::level); }
+        uint32_t GetMaxHealth() const { return config_->Get(monster_keys::max_health); }
+        uint32_t GetMaxMana() const { return config_->Get(monster_keys::max_mana); }
+        uint32_t GetAttackPower() const { return config_->Get(monster_keys::attack_power); }
+        float    GetMoveSpeed() const { return config_->Get(monster_keys::move_speed); }
+        float    GetAttackRange() const { return config_->Get(monster_keys::attack_range); }
+        float    GetDetectionRange() const { return config_->Get(monster_keys::detection_range); }
+
+        // 타입별 설정 Blackboard (같은 타입의 몬스터가 공유, AI 컨텍스트의 부모 계층)
+        const std::shared_ptr<const Blackboard>& GetConfig() const { return config_; }
 
         // AI 관련
         std::shared_ptr<MonsterBTExecutor> GetAI() const { return ai_; }
@@ -77,7 +86,7 @@ namespace bt
         float GetDeathTime() const { return death_time_; }
         bool  ShouldRespawn(float current_time) const;
 
-        // 환경 인지
+        // 환경 인지 (players/monsters는 주변 후보, 보통 공간 격자의 탐지 범위 질의 결과)
         EnvironmentInfo GetEnvironmentInfo() const { return environment_info_; }
         void            UpdateEnvironmentInfo(const std::vector<std::shared_ptr<Player>>&  players,
                                               const std::vector<std::shared_ptr<Monster>>& monsters);
@@ -111,7 +120,9 @@ namespace bt
         MonsterType                           type_;
         MonsterStateType                      state_;
         MonsterPosition                       position_;
-        MonsterStats                          stats_;
+        uint32_t                              health_;
+        uint32_t                              mana_;
+        std::shared_ptr<const Blackboard>     config_;
         std::shared_ptr<MonsterBTExecutor>    ai_;
         std::string                           ai_name_;
         std::string                           bt_name_;
@@ -125,11 +136,7 @@ namespace bt
         MonsterPosition              spawn_position_; // 스폰 위치 (기본 순찰점)
 
         // 전투 관련
-        float    detection_range_ = 15.0f;
-        float    attack_range_    = 3.0f;
-        float    chase_range_     = 25.0f;
-        uint32_t damage_          = 10;
-        float    move_speed_      = 2.0f;
+        float chase_range_ = 25.0f;
 
         // 리스폰 관련
         float respawn_time_ = 30.0f;
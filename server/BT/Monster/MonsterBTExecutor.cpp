@@ -1,55 +1,75 @@
 #include <iostream>
-#include <map>
 
+#include "Monster.h"
 #include "MonsterBTExecutor.h"
 
 namespace bt
 {
 
     // MonsterBTExecutor 구현
-    MonsterBTExecutor::MonsterBTExecutor(const std::string& name, const std::string& bt_name)
-        : name_(name), bt_name_(bt_name), active_(true)
+    MonsterBTExecutor::MonsterBTExecutor(const std::string&          name,
+                                         const std::string&          bt_name,
+                                         std::shared_ptr<AgentArena> arena)
+        : context_(std::move(arena)), name_(name), bt_name_(bt_name), active_(true)
     {
         last_update_time_ = std::chrono::steady_clock::now();
     }
 
-    void MonsterBTExecutor::Update(float /* delta_time */)
+    void MonsterBTExecutor::Update(float delta_time)
     {
-        static std::map<std::string, int> update_counts;
-        std::string                       monster_name = name_; // AI 이름 사용
-        update_counts[monster_name]++;
+        if (Tree* behavior_tree = PrepareBatchTick(delta_time))
+        {
+            // Behavior Tree 실행
+            behavior_tree->Execute(context_);
+        }
+    }
 
-        if (update_counts[monster_name] % 100 == 0)
+    Tree* MonsterBTExecutor::PrepareBatchTick(float /* delta_time */)
+    {
+        // 병렬 틱 중에도 안전하도록 실행자별 카운터 사용
+        update_count_++;
+
+        if (update_count_ % 100 == 0)
         { // 10초마다 로그 출력
-            std::cout << "MonsterBTExecutor::update 호출됨: " << monster_name
-                      << " (카운트: " << update_counts[monster_name] << ")" << std::endl;
+            std::cout << "MonsterBTExecutor::update 호출됨: " << name_ << " (카운트: " << update_count_ << ")"
+                      << std::endl;
         }
 
-        if (!active_.load() || !behavior_tree_)
+        // 새 버전이 게시되었으면 이번 틱부터 교체 (실행 상태 이전 포함)
+        const auto& behavior_tree = tree_binding_.Acquire(context_);
+        if (!active_.load() || !behavior_tree)
         {
-            if (update_counts[monster_name] % 100 == 0)
+            if (update_count_ % 100 == 0)
             {
                 std::cout << "MonsterBTExecutor::update - active: " << active_.load()
-                          << ", behavior_tree: " << (behavior_tree_ ? "있음" : "없음") << std::endl;
+                          << ", behavior_tree: " << (behavior_tree ? "있음" : "없음") << std::endl;
             }
-            return;
+            return nullptr;
         }
 
         auto now = std::chrono::steady_clock::now();
         context_.SetStartTime(now);
 
-        // 몬스터 참조를 컨텍스트에 설정
+        // 몬스터 참조를 컨텍스트에 설정 (리프는 AgentNode<Monster>로 타입 조회 없이 받는다)
         context_.SetAI(shared_from_this());
-
-        // Behavior Tree 실행
-        behavior_tree_->Execute(context_);
+        context_.SetAgent(monster_.get());
+        if (monster_)
+        {
+            context_.SetAgentId(monster_->GetID()); // 실행 추적에 몬스터 id로 남긴다
+        }
 
         last_update_time_ = now;
+        return behavior_tree.get();
     }
 
     void MonsterBTExecutor::SetBehaviorTree(std::shared_ptr<Tree> tree)
     {
-        behavior_tree_ = tree;
+        tree_binding_.SetTree(tree);
+    }
+
+    void MonsterBTExecutor::BindTreeSlot(std::shared_ptr<TreeSlot> slot)
+    {
+        tree_binding_.Bind(slot);
     }
 
 } // namespace bt
@@ -8,6 +8,7 @@
 #include "../../BT/Context.h"
 #include "../../BT/IExecutor.h"
 #include "../../BT/Tree.h"
+#include "../../BT/TreeSlot.h"
 
 namespace bt
 {
@@ -19,13 +20,18 @@ namespace bt
     class MonsterBTExecutor : public IExecutor, public std::enable_shared_from_this<MonsterBTExecutor>
     {
     public:
-        MonsterBTExecutor(const std::string& name, const std::string& bt_name);
+        // arena를 주면 컨텍스트의 트리 상태/블랙보드/코루틴 프레임을 그 아레나에서 할당한다
+        MonsterBTExecutor(const std::string&          name,
+                          const std::string&          bt_name,
+                          std::shared_ptr<AgentArena> arena = nullptr);
         ~MonsterBTExecutor() = default;
 
         // IExecutor 인터페이스 구현
         void                  Update(float delta_time) override;                    // AI 업데이트
+        Tree*                 PrepareBatchTick(float delta_time) override;          // 배치 틱 준비 (트리 실행 전까지)
         void                  SetBehaviorTree(std::shared_ptr<Tree> tree) override; // Behavior Tree 설정
-        std::shared_ptr<Tree> GetBehaviorTree() const override { return behavior_tree_; }
+        std::shared_ptr<Tree> GetBehaviorTree() const override { return tree_binding_.GetTree(); }
+        void                  BindTreeSlot(std::shared_ptr<TreeSlot> slot) override; // 핫 리로드 따라가기
         Context&              GetContext() override { return context_; } // 컨텍스트 접근
         const Context&        GetContext() const override { return context_; }
         const std::string&    GetName() const override { return name_; } // 이름 접근
@@ -38,7 +44,7 @@ namespace bt
         std::shared_ptr<Monster> GetMonster() const { return monster_; }
 
     private:
-        std::shared_ptr<Tree> behavior_tree_;
+        TreeBinding           tree_binding_; // 엔진 슬롯의 현재 버전 (틱 경계에서 교체)
         Context               context_;
         std::string           name_;
         std::string           bt_name_;
@@ -46,6 +52,7 @@ namespace bt
 
         std::shared_ptr<Monster>              monster_;
         std::chrono::steady_clock::time_point last_update_time_;
+        uint64_t                              update_count_ = 0;
     };
 
 } // namespace bt
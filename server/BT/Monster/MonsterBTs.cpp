@@ -1,8 +1,14 @@
+#include <algorithm>
+#include <filesystem>
 #include <iostream>
 
 #include "../../BT/Control/Selector.h"
 #include "../../BT/Control/Sequence.h"
+#include "../../BT/Engine.h"
+#include "../../BT/NodeRegistry.h"
+#include "../../BT/SubTree.h"
 #include "../../BT/Tree.h"
+#include "../../BT/TreeLoader.h"
 #include "../Action/Attack.h"
 #include "../Action/Patrol.h"
 #include "../Condition/HasTarget.h"
@@ -12,6 +18,24 @@
 namespace bt
 {
 
+    std::shared_ptr<Tree> MonsterBTs::CreateAttackBT()
+    {
+        auto tree = std::make_shared<Tree>("monster_attack");
+
+        // 타겟이 있고 공격 범위 내에 있으면 공격 (바깥 트리의 선점 가드는 앞의 두 조건)
+        auto attack_sequence = std::make_shared<Sequence>("attack_sequence");
+        attack_sequence->AddChild(std::make_shared<bt::condition::HasTarget>("has_target"));
+        attack_sequence->AddChild(std::make_shared<bt::condition::InAttackRange>("in_attack_range"));
+        attack_sequence->AddChild(std::make_shared<bt::action::Attack>("attack"));
+
+        tree->SetRoot(attack_sequence);
+        tree->SetExecutionMode(ExecutionMode::MEMORY); // 실행 중인 공격에서 재개 (조건은 매 틱 재확인)
+        tree->Compile(); // 평탄화된 실행 형태로 컴파일
+
+        std::cout << "공통 공격 Behavior Tree 생성 완료" << std::endl;
+        return tree;
+    }
+
     std::shared_ptr<Tree> MonsterBTs::CreateGoblinBT()
     {
         auto tree = std::make_shared<Tree>("goblin_bt");
@@ -19,11 +43,8 @@ namespace bt
         // 루트 노드: Selector (하나라도 성공하면 성공)
         auto root = std::make_shared<Selector>("goblin_root");
 
-        // 공격 시퀀스: 타겟이 있고 공격 범위 내에 있으면 공격
-        auto attack_sequence = std::make_shared<Sequence>("attack_sequence");
-        attack_sequence->AddChild(std::make_shared<bt::condition::HasTarget>("has_target"));
-        attack_sequence->AddChild(std::make_shared<bt::condition::InAttackRange>("in_attack_range"));
-        attack_sequence->AddChild(std::make_shared<bt::action::Attack>("attack"));
+        // 공격 시퀀스: 공통 공격 트리 참조 (엔진에 등록할 때 연결)
+        auto attack_sequence = std::make_shared<SubTree>("attack_sequence", "monster_attack");
 
         // 순찰 액션
         auto patrol_action = std::make_shared<bt::action::Patrol>("patrol");
@@ -33,6 +54,8 @@ namespace bt
         root->AddChild(patrol_action);
 
         tree->SetRoot(root);
+        tree->SetExecutionMode(ExecutionMode::MEMORY); // 실행 중인 공격/순찰에서 재개 (공격 가드는 매 틱 재확인)
+        tree->Compile(); // 평탄화된 실행 형태로 컴파일
 
         std::cout << "Goblin Behavior Tree 생성 완료" << std::endl;
         return tree;
@@ -45,10 +68,7 @@ namespace bt
         // 오크는 고블린과 비슷하지만 더 공격적
         auto root = std::make_shared<Selector>("orc_root");
 
-        auto attack_sequence = std::make_shared<Sequence>("attack_sequence");
-        attack_sequence->AddChild(std::make_shared<bt::condition::HasTarget>("has_target"));
-        attack_sequence->AddChild(std::make_shared<bt::condition::InAttackRange>("in_attack_range"));
-        attack_sequence->AddChild(std::make_shared<bt::action::Attack>("attack"));
+        auto attack_sequence = std::make_shared<SubTree>("attack_sequence", "monster_attack");
 
         auto patrol_action = std::make_shared<bt::action::Patrol>("patrol");
 
@@ -56,6 +76,8 @@ namespace bt
         root->AddChild(patrol_action);
 
         tree->SetRoot(root);
+        tree->SetExecutionMode(ExecutionMode::MEMORY); // 실행 중인 공격/순찰에서 재개 (공격 가드는 매 틱 재확인)
+        tree->Compile(); // 평탄화된 실행 형태로 컴파일
 
         std::cout << "Orc Behavior Tree 생성 완료" << std::endl;
         return tree;
@@ -68,10 +90,7 @@ namespace bt
         // 드래곤은 더 복잡한 AI
         auto root = std::make_shared<Selector>("dragon_root");
 
-        auto attack_sequence = std::make_shared<Sequence>("attack_sequence");
-        attack_sequence->AddChild(std::make_shared<bt::condition::HasTarget>("has_target"));
-        attack_sequence->AddChild(std::make_shared<bt::condition::InAttackRange>("in_attack_range"));
-        attack_sequence->AddChild(std::make_shared<bt::action::Attack>("attack"));
+        auto attack_sequence = std::make_shared<SubTree>("attack_sequence", "monster_attack");
 
         auto patrol_action = std::make_shared<bt::action::Patrol>("patrol");
 
@@ -79,6 +98,8 @@ namespace bt
         root->AddChild(patrol_action);
 
         tree->SetRoot(root);
+        tree->SetExecutionMode(ExecutionMode::MEMORY); // 실행 중인 공격/순찰에서 재개 (공격 가드는 매 틱 재확인)
+        tree->Compile(); // 평탄화된 실행 형태로 컴파일
 
         std::cout << "Dragon Behavior Tree 생성 완료" << std::endl;
         return tree;
@@ -90,10 +111,7 @@ namespace bt
 
         auto root = std::make_shared<Selector>("skeleton_root");
 
-        auto attack_sequence = std::make_shared<Sequence>("attack_sequence");
-        attack_sequence->AddChild(std::make_shared<bt::condition::HasTarget>("has_target"));
-        attack_sequence->AddChild(std::make_shared<bt::condition::InAttackRange>("in_attack_range"));
-        attack_sequence->AddChild(std::make_shared<bt::action::Attack>("attack"));
+        auto attack_sequence = std::make_shared<SubTree>("attack_sequence", "monster_attack");
 
         auto patrol_action = std::make_shared<bt::action::Patrol>("patrol");
 
@@ -101,6 +119,8 @@ namespace bt
         root->AddChild(patrol_action);
 
         tree->SetRoot(root);
+        tree->SetExecutionMode(ExecutionMode::MEMORY); // 실행 중인 공격/순찰에서 재개 (공격 가드는 매 틱 재확인)
+        tree->Compile(); // 평탄화된 실행 형태로 컴파일
 
         std::cout << "Skeleton Behavior Tree 생성 완료" << std::endl;
         return tree;
@@ -112,10 +132,7 @@ namespace bt
 
         auto root = std::make_shared<Selector>("zombie_root");
 
-        auto attack_sequence = std::make_shared<Sequence>("attack_sequence");
-        attack_sequence->AddChild(std::make_shared<bt::condition::HasTarget>("has_target"));
-        attack_sequence->AddChild(std::make_shared<bt::condition::InAttackRange>("in_attack_range"));
-        attack_sequence->AddChild(std::make_shared<bt::action::Attack>("attack"));
+        auto attack_sequence = std::make_shared<SubTree>("attack_sequence", "monster_attack");
 
         auto patrol_action = std::make_shared<bt::action::Patrol>("patrol");
 
@@ -123,6 +140,8 @@ namespace bt
         root->AddChild(patrol_action);
 
         tree->SetRoot(root);
+        tree->SetExecutionMode(ExecutionMode::MEMORY); // 실행 중인 공격/순찰에서 재개 (공격 가드는 매 틱 재확인)
+        tree->Compile(); // 평탄화된 실행 형태로 컴파일
 
         std::cout << "Zombie Behavior Tree 생성 완료" << std::endl;
         return tree;
@@ -136,6 +155,7 @@ namespace bt
         auto root = std::make_shared<bt::action::Patrol>("merchant_patrol");
 
         tree->SetRoot(root);
+        tree->Compile(); // 평탄화된 실행 형태로 컴파일
 
         std::cout << "Merchant Behavior Tree 생성 완료" << std::endl;
         return tree;
@@ -148,10 +168,7 @@ namespace bt
         // 경비병은 공격과 순찰
         auto root = std::make_shared<Selector>("guard_root");
 
-        auto attack_sequence = std::make_shared<Sequence>("attack_sequence");
-        attack_sequence->AddChild(std::make_shared<bt::condition::HasTarget>("has_target"));
-        attack_sequence->AddChild(std::make_shared<bt::condition::InAttackRange>("in_attack_range"));
-        attack_sequence->AddChild(std::make_shared<bt::action::Attack>("attack"));
+        auto attack_sequence = std::make_shared<SubTree>("attack_sequence", "monster_attack");
 
         auto patrol_action = std::make_shared<bt::action::Patrol>("patrol");
 
@@ -159,9 +176,61 @@ namespace bt
         root->AddChild(patrol_action);
 
         tree->SetRoot(root);
+        tree->SetExecutionMode(ExecutionMode::MEMORY); // 실행 중인 공격/순찰에서 재개 (공격 가드는 매 틱 재확인)
+        tree->Compile(); // 평탄화된 실행 형태로 컴파일
 
         std::cout << "Guard Behavior Tree 생성 완료" << std::endl;
         return tree;
     }
 
+    void MonsterBTs::RegisterNodeTypes(NodeRegistry& registry)
+    {
+        registry.RegisterLeaf<bt::condition::HasTarget>("HasTarget");
+        registry.RegisterLeaf<bt::condition::InAttackRange>("InAttackRange");
+        registry.RegisterLeaf<bt::action::Attack>("Attack");
+        registry.RegisterLeaf<bt::action::Patrol>("Patrol");
+    }
+
+    size_t MonsterBTs::LoadTreesFromDirectory(Engine& engine, const std::string& directory)
+    {
+        std::error_code error;
+        if (!std::filesystem::is_directory(directory, error))
+        {
+            return 0;
+        }
+
+        NodeRegistry registry;
+        RegisterNodeTypes(registry);
+        TreeLoader loader(registry);
+
+        // 같은 트리의 .json과 .btb가 함께 있으면 이름순으로 나중인 .json이 적용된다
+        std::vector<std::filesystem::path> files;
+        for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+        {
+            auto extension = entry.path().extension();
+            if (entry.is_regular_file() && (extension == ".json" || extension == ".btb"))
+            {
+                files.push_back(entry.path());
+            }
+        }
+        std::sort(files.begin(), files.end());
+
+        size_t loaded = 0;
+        for (const auto& file : files)
+        {
+            try
+            {
+                auto tree = loader.LoadFile(file.string());
+                engine.RegisterTree(tree->GetName(), tree);
+                std::cout << "Behavior Tree 로드 완료: " << tree->GetName() << " (" << file.string() << ")" << std::endl;
+                loaded++;
+            }
+            catch (const TreeLoadError& e)
+            {
+                std::cerr << "Behavior Tree 로드 실패: " << e.what() << std::endl;
+            }
+        }
+        return loaded;
+    }
+
 } // namespace bt
@@ -8,6 +8,8 @@ namespace bt
 {
     class Tree;
     class Node;
+    class Engine;
+    class NodeRegistry;
 } // namespace bt
 
 namespace bt
@@ -17,6 +19,9 @@ namespace bt
     class MonsterBTs
     {
     public:
+        // 몬스터 트리가 SubTree로 공유하는 공격 트리 ("monster_attack", 몬스터 트리보다 먼저 등록)
+        static std::shared_ptr<Tree> CreateAttackBT();
+
         // 각 몬스터별 BT 생성 함수
         static std::shared_ptr<Tree> CreateGoblinBT();
         static std::shared_ptr<Tree> CreateOrcBT();
@@ -25,6 +30,13 @@ namespace bt
         static std::shared_ptr<Tree> CreateZombieBT();
         static std::shared_ptr<Tree> CreateMerchantBT();
         static std::shared_ptr<Tree> CreateGuardBT();
+
+        // 데이터 기반 트리용 몬스터 리프 노드 등록 (HasTarget, InAttackRange, Attack, Patrol)
+        static void RegisterNodeTypes(NodeRegistry& registry);
+
+        // 디렉토리의 트리 정의(*.json, 미리 컴파일된 *.btb)를 로드해 트리 이름으로 등록 (같은 이름의 코드 트리를 대체)
+        // 검증에 실패한 파일은 건너뛰며, 등록한 트리 수를 반환한다.
+        static size_t LoadTreesFromDirectory(Engine& engine, const std::string& directory);
     };
 
 } // namespace bt
@@ -1,5 +1,7 @@
 #include <algorithm>
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
 
 #include <cctype>
 
@@ -10,9 +12,10 @@
 namespace bt
 {
 
-    std::shared_ptr<Monster> MonsterFactory::CreateMonster(MonsterType            type,
-                                                           const std::string&     name,
-                                                           const MonsterPosition& position)
+    std::shared_ptr<Monster> MonsterFactory::CreateMonster(MonsterType                 type,
+                                                           const std::string&          name,
+                                                           const MonsterPosition&      position,
+                                                           std::shared_ptr<AgentArena> arena)
     {
         auto monster = std::make_shared<Monster>(name, type, position);
 
@@ -22,19 +25,21 @@ namespace bt
         monster->SetBTName(bt_name);
 
         // AI 생성 및 설정
-        auto ai = std::make_shared<MonsterBTExecutor>(name, bt_name);
+        auto ai = std::make_shared<MonsterBTExecutor>(name, bt_name, std::move(arena));
         ai->SetMonster(monster); // AI에 몬스터 참조 설정
+        ai->GetContext().SetSharedBlackboard(monster->GetConfig());
         monster->SetAI(ai);
 
         return monster;
     }
 
-    std::shared_ptr<Monster> MonsterFactory::CreateMonster(const MonsterSpawnConfig& config)
+    std::shared_ptr<Monster> MonsterFactory::CreateMonster(const MonsterSpawnConfig&   config,
+                                                           std::shared_ptr<AgentArena> arena)
     {
         auto monster = std::make_shared<Monster>(config.name, config.type, config.position);
         monster->SetPosition(config.position.x, config.position.y, config.position.z, config.position.rotation);
         monster->Heal(config.health);                                        // 체력 설정
-        monster->TakeDamage(monster->GetStats().max_health - config.health); // 현재 체력 설정
+        monster->TakeDamage(monster->GetMaxHealth() - config.health); // 현재 체력 설정
 
         // AI 이름과 BT 이름 설정
         monster->SetAIName(config.name);
@@ -42,13 +47,38 @@ namespace bt
         monster->SetBTName(bt_name);
 
         // AI 생성 및 설정
-        auto ai = std::make_shared<MonsterBTExecutor>(config.name, bt_name);
+        auto ai = std::make_shared<MonsterBTExecutor>(config.name, bt_name, std::move(arena));
         ai->SetMonster(monster); // AI에 몬스터 참조 설정
+        ai->GetContext().SetSharedBlackboard(monster->GetConfig());
         monster->SetAI(ai);
 
         return monster;
     }
 
+    std::shared_ptr<const Blackboard> MonsterFactory::GetConfigBlackboard(MonsterType type)
+    {
+        static std::mutex                                                          mutex;
+        static std::unordered_map<MonsterType, std::shared_ptr<const Blackboard>> configs;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto&                       config = configs[type];
+        if (!config)
+        {
+            MonsterStats stats      = GetDefaultStats(type);
+            auto         blackboard = std::make_shared<Blackboard>();
+            blackboard->Set(monster_keys::level, stats.level);
+            blackboard->Set(monster_keys::max_health, stats.max_health);
+            blackboard->Set(monster_keys::max_mana, stats.max_mana);
+            blackboard->Set(monster_keys::attack_power, stats.attack_power);
+            blackboard->Set(monster_keys::defense, stats.defense);
+            blackboard->Set(monster_keys::move_speed, stats.move_speed);
+            blackboard->Set(monster_keys::attack_range, stats.attack_range);
+            blackboard->Set(monster_keys::detection_range, stats.detection_range);
+            config = blackboard;
+        }
+        return config;
+    }
+
     MonsterStats MonsterFactory::GetDefaultStats(MonsterType type)
     {
         MonsterStats stats;
@@ -3,6 +3,8 @@
 #include <memory>
 #include <string>
 
+#include "../../BT/AgentArena.h"
+#include "../../BT/Blackboard.h"
 #include "Monster.h"
 #include "MonsterTypes.h"
 
@@ -13,14 +15,20 @@ namespace bt
     class MonsterFactory
     {
     public:
-        static std::shared_ptr<Monster> CreateMonster(MonsterType            type,
-                                                      const std::string&     name,
-                                                      const MonsterPosition& position);
-        static std::shared_ptr<Monster> CreateMonster(const MonsterSpawnConfig& config);
+        // arena: AI 컨텍스트를 할당할 에이전트 아레나 (nullptr이면 전역 힙)
+        static std::shared_ptr<Monster> CreateMonster(MonsterType                 type,
+                                                      const std::string&          name,
+                                                      const MonsterPosition&      position,
+                                                      std::shared_ptr<AgentArena> arena = nullptr);
+        static std::shared_ptr<Monster> CreateMonster(const MonsterSpawnConfig&   config,
+                                                      std::shared_ptr<AgentArena> arena = nullptr);
 
         // 몬스터별 기본 통계 설정
         static MonsterStats GetDefaultStats(MonsterType type);
 
+        // 몬스터 타입별 설정 Blackboard (타입당 하나를 모든 몬스터가 부모 계층으로 공유)
+        static std::shared_ptr<const Blackboard> GetConfigBlackboard(MonsterType type);
+
         // 몬스터별 Behavior Tree 이름 반환
         static std::string GetBTName(MonsterType type);
 
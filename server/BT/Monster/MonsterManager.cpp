@@ -27,6 +27,10 @@ namespace bt
     {
         uint32_t id = next_monster_id_.fetch_add(1);
         monster->SetID(id); // 몬스터 객체에 ID 설정
+        if (auto ai = monster->GetAI())
+        {
+            ai->GetContext().SeedRandom(id); // 같은 ID면 같은 랜덤 선택 (AI 재현용)
+        }
         monsters_.insert(id, monster);
         std::cout << "몬스터 추가: " << monster->GetName() << " (ID: " << id << ")" << std::endl;
     }
@@ -79,10 +83,10 @@ namespace bt
             // BT 엔진에서 몬스터 AI 등록 제거됨 - 서버에서 직접 관리
 
             // Behavior Tree 설정
-            auto tree = bt_engine_->GetTree(bt_name);
-            if (tree)
+            auto slot = bt_engine_->GetTreeSlot(bt_name);
+            if (slot && slot->Load())
             {
-                monster->GetAI()->SetBehaviorTree(tree);
+                monster->GetAI()->BindTreeSlot(slot); // 핫 리로드된 버전을 다음 틱에 가져감
                 std::cout << "몬스터 AI Behavior Tree 설정: " << name << " -> " << bt_name << std::endl;
             }
             else
@@ -400,10 +404,42 @@ namespace bt
                 all_monsters.push_back(monster);
             }
 
-            // 각 몬스터의 환경 정보 업데이트
-            for (const auto& [id, monster] : read_view)
+            // 이번 프레임 위치로 격자를 다시 채운다 (격자 id는 all_monsters/all_players 인덱스)
+            // 몬스터 추가/제거가 다른 스레드에서 일어나므로 프레임마다 다시 채우는 방식(REBUILD)만 쓴다
+            monster_grid_.Clear();
+            for (size_t i = 0; i < all_monsters.size(); ++i)
+            {
+                const auto& pos = all_monsters[i]->GetPosition();
+                monster_grid_.Insert(static_cast<uint32_t>(i), pos.x, pos.z);
+            }
+            player_grid_.Clear();
+            for (size_t i = 0; i < all_players.size(); ++i)
+            {
+                const auto& pos = all_players[i]->GetPosition();
+                player_grid_.Insert(static_cast<uint32_t>(i), pos.x, pos.z);
+            }
+
+            // 각 몬스터의 환경 정보 업데이트 (탐지 범위 안의 후보만 넘기므로 비용이 주변 밀도에 비례)
+            std::vector<std::shared_ptr<Monster>> nearby_monsters;
+            std::vector<std::shared_ptr<Player>>  nearby_players;
+            for (const auto& monster : all_monsters)
             {
-                monster->UpdateEnvironmentInfo(all_players, all_monsters);
+                const auto& pos   = monster->GetPosition();
+                const float range = monster->GetDetectionRange();
+                nearby_monsters.clear();
+                nearby_players.clear();
+                monster_grid_.ForEachInRadius(pos.x,
+                                              pos.z,
+                                              range,
+                                              [&](uint32_t index, float /* distance_sq */)
+                                              { nearby_monsters.push_back(all_monsters[index]); });
+                player_grid_.ForEachInRadius(pos.x,
+                                             pos.z,
+                                             range,
+                                             [&](uint32_t index, float /* distance_sq */)
+                                             { nearby_players.push_back(all_players[index]); });
+
+                monster->UpdateEnvironmentInfo(nearby_players, nearby_monsters);
                 monster->Update(delta_time);
             }
         }
@@ -434,9 +470,9 @@ namespace bt
                         monster_data["position"]["y"]        = monster->GetPosition().y;
                         monster_data["position"]["z"]        = monster->GetPosition().z;
                         monster_data["position"]["rotation"] = monster->GetPosition().rotation;
-                        monster_data["health"]               = monster->GetStats().health;
-                        monster_data["max_health"]           = monster->GetStats().max_health;
-                        monster_data["level"]                = monster->GetStats().level;
+                        monster_data["health"]               = monster->GetHealth();
+                        monster_data["max_health"]           = monster->GetMaxHealth();
+                        monster_data["level"]                = monster->GetLevel();
                         monster_data["ai_name"]              = monster->GetAIName();
                         monster_data["bt_name"]              = monster->GetBTName();
                         event["monsters"].push_back(monster_data);
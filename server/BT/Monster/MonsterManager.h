@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "../../Common/ReadOnlyView.h"
+#include "../../World/SpatialGrid.h"
 #include "Monster.h"
 #include "MonsterTypes.h"
 
@@ -84,6 +85,10 @@ namespace bt
         void ProcessAutoSpawn(float delta_time);
         void ProcessRespawn(float delta_time);
 
+        // 환경 인지용 위치 격자 (Update 스레드 전용, 프레임마다 다시 채움)
+        SpatialGrid monster_grid_;
+        SpatialGrid player_grid_;
+
         // 플레이어 리스폰 포인트
         std::vector<MonsterPosition> player_respawn_points_;
 
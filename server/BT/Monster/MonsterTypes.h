@@ -3,6 +3,8 @@
 #include <string>
 #include <vector>
 
+#include "../../BT/Blackboard.h"
+
 namespace bt
 {
 
@@ -29,7 +31,7 @@ namespace bt
         DEAD
     };
 
-    // 몬스터 통계
+    // 몬스터 통계 (타입별 기본값, 타입 설정 Blackboard를 채우는 원본)
     struct MonsterStats
     {
         uint32_t level           = 1;
@@ -44,6 +46,19 @@ namespace bt
         float    detection_range = 10.0f;
     };
 
+    // 몬스터 타입별 설정 Blackboard 키
+    namespace monster_keys
+    {
+        inline const BlackboardKey<uint32_t> level{"config.level"};
+        inline const BlackboardKey<uint32_t> max_health{"config.max_health"};
+        inline const BlackboardKey<uint32_t> max_mana{"config.max_mana"};
+        inline const BlackboardKey<uint32_t> attack_power{"config.attack_power"};
+        inline const BlackboardKey<uint32_t> defense{"config.defense"};
+        inline const BlackboardKey<float>    move_speed{"config.move_speed"};
+        inline const BlackboardKey<float>    attack_range{"config.attack_range"};
+        inline const BlackboardKey<float>    detection_range{"config.detection_range"};
+    } // namespace monster_keys
+
     // 몬스터 위치
     struct MonsterPosition
     {
@@ -31,6 +31,7 @@ namespace bt
     {
         // Behavior Tree 엔진 초기화
         bt_engine_ = std::make_shared<Engine>();
+        bt_engine_->SetThreadCount(config_.ai_threads);
 
         // Behavior Tree 초기화
         // InitializeBehaviorTrees();
@@ -695,11 +696,9 @@ namespace bt
             // 플레이어 매니저를 통해 플레이어 위치 업데이트
             if (message_based_player_manager_)
             {
-                auto player = message_based_player_manager_->GetPlayer(player_id);
-                if (player)
+                // 플레이어 위치 업데이트 (주변 탐색용 공간 인덱스도 함께 갱신)
+                if (message_based_player_manager_->MovePlayer(player_id, x, y, z, rotation))
                 {
-                    // 플레이어 위치 업데이트
-                    player->SetPosition(x, y, z, rotation);
                     LogMessage("플레이어 위치 업데이트 성공: ID=" + std::to_string(player_id));
                 }
                 else
@@ -928,7 +927,7 @@ namespace bt
                     json += "\"position\":{\"x\":" + std::to_string(monster->GetPosition().x) +
                             ",\"y\":" + std::to_string(monster->GetPosition().y) +
                             ",\"z\":" + std::to_string(monster->GetPosition().z) + "},";
-                    json += "\"health\":" + std::to_string(monster->GetStats().health) + ",";
+                    json += "\"health\":" + std::to_string(monster->GetHealth()) + ",";
                     json += "\"max_health\":" + std::to_string(monster->GetMaxHealth()) + ",";
                     json += "\"is_active\":" + std::string(monster->IsAlive() ? "true" : "false");
                     json += "}";
@@ -47,6 +47,7 @@ namespace bt
         uint16_t                    http_websocket_port = 8080; // HTTP/WebSocket 서버 포트 (고정)
         size_t                      max_clients         = 1000;
         size_t                      worker_threads      = 4;
+        size_t                      ai_threads          = 0; // AI 병렬 틱 워커 수 (0이면 업데이트 스레드에서 순차 실행)
         bool                        debug_mode          = false;
         size_t                      max_packet_size     = 4096;
         boost::chrono::milliseconds connection_timeout{30000}; // 30초
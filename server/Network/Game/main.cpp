@@ -1,3 +1,4 @@
+#include <atomic>
 #include <filesystem>
 #include <iomanip>
 #include <iostream>
@@ -7,6 +8,8 @@
 #include <csignal>
 #include <signal.h>
 
+#include "../../BT/Engine.h"
+#include "../../BT/TraceReplay.h"
 #include "../../BT/Tree.h"
 #include "../shared/Logger.h"
 #include "BT/Monster/MessageBasedMonsterManager.h"
@@ -42,6 +45,65 @@ namespace bt
             .detach();
     }
 
+    // 트리 핫 리로드 요청 (SIGHUP, 메인 루프에서 처리)
+    std::atomic<bool> g_reload_trees{false};
+
+    void reload_signal_handler(int /* signal */) { g_reload_trees.store(true); }
+
+    // 몬스터 Behavior Tree 등록 (코드 트리 뒤에 config/bt의 데이터 기반 정의로 같은 이름을 대체)
+    // 공통 공격 트리를 먼저 등록해 몬스터 트리의 SubTree 참조가 등록할 때 바로 연결되게 한다.
+    size_t register_monster_trees(Engine& engine)
+    {
+        engine.RegisterTree("monster_attack", MonsterBTs::CreateAttackBT());
+        engine.RegisterTree("goblin_bt", MonsterBTs::CreateGoblinBT());
+        engine.RegisterTree("orc_bt", MonsterBTs::CreateOrcBT());
+        engine.RegisterTree("dragon_bt", MonsterBTs::CreateDragonBT());
+        engine.RegisterTree("skeleton_bt", MonsterBTs::CreateSkeletonBT());
+        engine.RegisterTree("zombie_bt", MonsterBTs::CreateZombieBT());
+        engine.RegisterTree("merchant_bt", MonsterBTs::CreateMerchantBT());
+        engine.RegisterTree("guard_bt", MonsterBTs::CreateGuardBT());
+        size_t loaded = MonsterBTs::LoadTreesFromDirectory(engine, "config/bt");
+
+        // 데이터 트리끼리의 앞선 참조를 연결하고 누락/순환 참조를 보고 (틱 시작 전에만 호출)
+        try
+        {
+            engine.LinkSubTrees();
+        }
+        catch (const TreeLinkError& e)
+        {
+            std::cerr << "Behavior Tree 링크 실패: " << e.what() << std::endl;
+        }
+        return loaded;
+    }
+
+    // 기록된 BT 실행 추적을 서버와 같은 트리로 재생하고 노드별 결과/시간을 JSON으로 출력
+    int replay_bt_trace(const std::string& path)
+    {
+        try
+        {
+            TraceData trace = TraceData::Load(path);
+            Engine    engine;
+            register_monster_trees(engine);
+
+            TraceReplayer replayer(trace);
+            for (const auto& info : trace.trees)
+            {
+                if (!replayer.AddTree(engine.GetTree(info.name)))
+                {
+                    std::cerr << "재생할 트리 없음 (정의가 바뀌었거나 등록되지 않음): " << info.name << "\n";
+                }
+            }
+            TraceReplayReport report = replayer.Run();
+            std::cout << report.ToJson().dump(2) << std::endl;
+            return report.matched == report.ticks ? 0 : 2;
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "BT 추적 재생 실패: " << e.what() << "\n";
+            return 1;
+        }
+    }
+
 } // namespace bt
 
 int main(int argc, char* argv[])
@@ -62,6 +124,9 @@ int main(int argc, char* argv[])
     // 시그널 핸들러 등록
     std::signal(SIGINT, signal_handler);
     std::signal(SIGTERM, signal_handler);
+#ifdef SIGHUP
+    std::signal(SIGHUP, reload_signal_handler); // kill -HUP으로 config/bt 다시 로드
+#endif
 
     LOG_INFO("=== BT MMORPG 서버 (Boost.Asio) 시작 ===");
 
@@ -73,6 +138,9 @@ int main(int argc, char* argv[])
     config.worker_threads = 4;
     config.debug_mode     = true;
 
+    uint32_t    bt_trace_interval = 0; // 0이면 BT 실행 추적을 켜지 않음
+    std::string bt_trace_file     = "logs/bt_trace.btt";
+
     // 명령행 인수 처리
     for (int i = 1; i < argc; i++)
     {
@@ -93,10 +161,26 @@ int main(int argc, char* argv[])
         {
             config.worker_threads = std::stoul(argv[++i]);
         }
+        else if (arg == "--ai-threads" && i + 1 < argc)
+        {
+            config.ai_threads = std::stoul(argv[++i]);
+        }
         else if (arg == "--debug")
         {
             config.debug_mode = true;
         }
+        else if (arg == "--bt-trace" && i + 1 < argc)
+        {
+            bt_trace_interval = static_cast<uint32_t>(std::stoul(argv[++i]));
+        }
+        else if (arg == "--bt-trace-file" && i + 1 < argc)
+        {
+            bt_trace_file = argv[++i];
+        }
+        else if (arg == "--bt-replay" && i + 1 < argc)
+        {
+            return replay_bt_trace(argv[++i]);
+        }
         else if (arg == "--help")
         {
             std::cout << "사용법: " << argv[0] << " [옵션]\n";
@@ -105,7 +189,11 @@ int main(int argc, char* argv[])
             std::cout << "  --host <호스트>      서버 호스트 (기본값: 0.0.0.0)\n";
             std::cout << "  --max-clients <수>   최대 클라이언트 수 (기본값: 1000)\n";
             std::cout << "  --threads <수>       워커 스레드 수 (기본값: 4)\n";
+            std::cout << "  --ai-threads <수>    AI 병렬 틱 스레드 수 (기본값: 0, 순차 실행)\n";
             std::cout << "  --debug             디버그 모드 활성화\n";
+            std::cout << "  --bt-trace <N>       BT 실행 추적 (AI 스레드마다 N틱에 한 번 기록, 종료 시 파일로 저장)\n";
+            std::cout << "  --bt-trace-file <경로> BT 추적 파일 (기본값: logs/bt_trace.btt)\n";
+            std::cout << "  --bt-replay <경로>   BT 추적 파일을 재생해 노드별 결과/시간을 출력하고 종료\n";
             std::cout << "  --help              이 도움말 표시\n";
             return 0;
         }
@@ -139,13 +227,19 @@ int main(int argc, char* argv[])
     if (bt_engine && monster_manager && player_manager)
     {
         // 몬스터별 Behavior Tree 등록
-        bt_engine->RegisterTree("goblin_bt", MonsterBTs::CreateGoblinBT());
-        bt_engine->RegisterTree("orc_bt", MonsterBTs::CreateOrcBT());
-        bt_engine->RegisterTree("dragon_bt", MonsterBTs::CreateDragonBT());
-        bt_engine->RegisterTree("skeleton_bt", MonsterBTs::CreateSkeletonBT());
-        bt_engine->RegisterTree("zombie_bt", MonsterBTs::CreateZombieBT());
-        bt_engine->RegisterTree("merchant_bt", MonsterBTs::CreateMerchantBT());
-        bt_engine->RegisterTree("guard_bt", MonsterBTs::CreateGuardBT());
+        // 데이터 기반 트리 정의가 있으면 같은 이름의 코드 트리를 대체 (재빌드 없이 튜닝)
+        size_t loaded_trees = register_monster_trees(*bt_engine);
+        if (loaded_trees > 0)
+        {
+            LOG_INFO("데이터 기반 BT 로드: " + std::to_string(loaded_trees) + "개");
+        }
+
+        // BT 실행 추적 (이후 핫 리로드된 트리에도 적용)
+        if (bt_trace_interval > 0)
+        {
+            bt_engine->SetTraceRecorder(std::make_shared<TraceRecorder>(bt_trace_interval));
+            LOG_INFO("BT 실행 추적: " + std::to_string(bt_trace_interval) + "틱에 한 번 기록");
+        }
 
         LOG_INFO("Behavior Tree 엔진 초기화 완료");
         LOG_INFO("등록된 BT: " + std::to_string(bt_engine->GetRegisteredTrees()) + "개");
@@ -218,6 +312,13 @@ int main(int argc, char* argv[])
         if (bt_engine)
         {
             // BT 엔진에서 몬스터 업데이트 제거됨 - MonsterManager에서 직접 처리
+
+            // 트리 핫 리로드: 로드/검증/컴파일은 여기서 하고 게시만 원자적으로 (AI 틱은 멈추지 않음)
+            if (g_reload_trees.exchange(false))
+            {
+                size_t reloaded = MonsterBTs::LoadTreesFromDirectory(*bt_engine, "config/bt");
+                LOG_INFO("Behavior Tree 핫 리로드: " + std::to_string(reloaded) + "개");
+            }
         }
 
         // 통계 정보 출력 (10초마다)
@@ -240,6 +341,26 @@ int main(int argc, char* argv[])
         }
     }
 
+    // 몬스터 AI는 몬스터 매니저의 업데이트 스레드에서도 틱하므로(TickAllBatched) 추적을 저장하기 전에 그 스레드를
+    // 멈추고 기다린다. 시그널을 받은 스레드의 Server::Stop과 겹쳐도 Stop은 업데이트 스레드가 끝난 뒤에 반환한다.
+    if (monster_manager)
+    {
+        monster_manager->Stop();
+    }
+    if (auto recorder = bt_engine ? bt_engine->GetTraceRecorder() : nullptr)
+    {
+        bt_engine->SetTraceRecorder(nullptr); // 이후 트리를 실행하는 곳이 남아 있어도 더 기록하지 않는다
+        try
+        {
+            recorder->WriteFile(bt_trace_file);
+            LOG_INFO("BT 실행 추적 저장: " + bt_trace_file);
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("BT 실행 추적 저장 실패: " + std::string(e.what()));
+        }
+    }
+
     LOG_INFO("서버가 정상적으로 종료되었습니다.");
     return 0;
 }
@@ -64,6 +64,7 @@ namespace bt
 
         uint32_t player_id = player->GetID();
         players_.insert(player_id, player);
+        IndexPlayer(*player);
 
         std::cout << "MessageBasedPlayerManager: 플레이어 추가됨 - ID: " << player_id << ", 이름: " << player->GetName()
                   << std::endl;
@@ -86,6 +87,10 @@ namespace bt
         if (player)
         {
             players_.erase(player_id);
+            {
+                std::unique_lock<std::shared_mutex> lock(spatial_mutex_);
+                spatial_grid_.Remove(player_id);
+            }
 
             std::cout << "MessageBasedPlayerManager: 플레이어 제거됨 - ID: " << player_id
                       << ", 이름: " << player->GetName() << std::endl;
@@ -109,17 +114,97 @@ namespace bt
                                                                                       float z,
                                                                                       float range)
     {
-        return players_.filter(
-            [x, y, z, range](const std::shared_ptr<Player>& player)
+        // 격자로 평면 반경 안의 후보만 모은 뒤 현재 위치의 3D 거리로 거른다
+        std::vector<uint32_t> candidates;
+        {
+            std::shared_lock<std::shared_mutex> lock(spatial_mutex_);
+            spatial_grid_.ForEachInRadius(
+                x, z, range, [&candidates](uint32_t id, float /* distance_sq */) { candidates.push_back(id); });
+        }
+
+        std::vector<std::shared_ptr<Player>> result;
+        const float                          range_sq = range * range;
+        for (uint32_t id : candidates)
+        {
+            auto player = players_.get(id);
+            if (!player)
+                continue;
+
+            const auto& pos = player->GetPosition();
+            const float dx  = pos.x - x;
+            const float dy  = pos.y - y;
+            const float dz  = pos.z - z;
+            if (dx * dx + dy * dy + dz * dz <= range_sq)
+            {
+                result.push_back(player);
+            }
+        }
+        return result;
+    }
+
+    std::vector<std::shared_ptr<Player>> MessageBasedPlayerManager::GetNearestPlayers(float  x,
+                                                                                      float  z,
+                                                                                      size_t count,
+                                                                                      float  range)
+    {
+        // 평면(XZ) 거리 기준, 가까운 순서
+        std::vector<SpatialGrid::Hit> hits;
+        {
+            std::shared_lock<std::shared_mutex> lock(spatial_mutex_);
+            spatial_grid_.QueryNearest(x, z, count, range, hits);
+        }
+
+        std::vector<std::shared_ptr<Player>> result;
+        result.reserve(hits.size());
+        for (const auto& hit : hits)
+        {
+            if (auto player = players_.get(hit.id))
             {
-                if (!player)
-                    return false;
+                result.push_back(player);
+            }
+        }
+        return result;
+    }
+
+    bool MessageBasedPlayerManager::MovePlayer(uint32_t player_id, float x, float y, float z, float rotation)
+    {
+        auto player = players_.get(player_id);
+        if (!player)
+            return false;
+
+        player->SetPosition(x, y, z, rotation);
+        if (spatial_mode_.load() == SpatialUpdateMode::INCREMENTAL)
+        {
+            std::unique_lock<std::shared_mutex> lock(spatial_mutex_);
+            spatial_grid_.Move(player_id, x, z); // 같은 칸 안의 이동은 좌표만 바뀐다
+        }
+        return true;
+    }
+
+    void MessageBasedPlayerManager::SetSpatialUpdateMode(SpatialUpdateMode mode)
+    {
+        spatial_mode_.store(mode);
+        RebuildSpatialGrid(); // 어느 방식이든 현재 위치에서 시작
+    }
 
-                auto  pos      = player->GetPosition();
-                float distance = std::sqrt(std::pow(pos.x - x, 2) + std::pow(pos.y - y, 2) + std::pow(pos.z - z, 2));
+    void MessageBasedPlayerManager::IndexPlayer(const Player& player)
+    {
+        std::unique_lock<std::shared_mutex> lock(spatial_mutex_);
+        spatial_grid_.Insert(player.GetID(), player.GetPosition().x, player.GetPosition().z);
+    }
 
-                return distance <= range;
-            });
+    void MessageBasedPlayerManager::RebuildSpatialGrid()
+    {
+        auto                                read_view = players_.get_read_only_view();
+        std::unique_lock<std::shared_mutex> lock(spatial_mutex_);
+        spatial_grid_.Clear();
+        for (const auto& [id, player] : read_view)
+        {
+            if (player)
+            {
+                spatial_grid_.Insert(id, player->GetPosition().x, player->GetPosition().z);
+            }
+        }
     }
 
     size_t MessageBasedPlayerManager::GetPlayerCount() const
@@ -137,6 +222,7 @@ namespace bt
         player->SetPosition(position.x, position.y, position.z, position.rotation);
 
         players_.insert(player_id, player);
+        IndexPlayer(*player);
 
         // 플레이어 생성 메시지 전송
         auto join_message =
@@ -157,6 +243,7 @@ namespace bt
         player->SetPosition(position.x, position.y, position.z, position.rotation);
 
         players_.insert(player_id, player);
+        IndexPlayer(*player);
 
         // 클라이언트 ID와 플레이어 ID 매핑 저장 (간단한 구현)
         // 실제로는 별도의 매핑 테이블이 필요할 수 있음
@@ -216,6 +303,11 @@ namespace bt
         if (!running_)
             return;
 
+        if (spatial_mode_.load() == SpatialUpdateMode::REBUILD)
+        {
+            RebuildSpatialGrid();
+        }
+
         // 플레이어 업데이트
         auto read_view = players_.get_read_only_view();
         for (const auto& pair : read_view)
@@ -279,6 +371,7 @@ namespace bt
                 // 리스폰 처리 (Player 클래스에는 ShouldRespawn가 없으므로 간단한 로직 사용)
                 // 실제 리스폰 로직은 Player::Update에서 처리됨
                 player->Respawn();
+                IndexPlayer(*player); // 리스폰 위치로 이동
                 BroadcastPlayerUpdate(player);
             }
         }
@@ -2,11 +2,13 @@
 
 #include <atomic>
 #include <memory>
+#include <shared_mutex>
 #include <vector>
 
 #include "../Common/GameMessageProcessor.h"
 #include "../Common/GameMessages.h"
 #include "../Common/ReadOnlyView.h"
+#include "../World/SpatialGrid.h"
 #include "PlayerManager.h"
 
 namespace bt
@@ -31,8 +33,17 @@ namespace bt
         std::shared_ptr<Player>              GetPlayer(uint32_t player_id);
         std::vector<std::shared_ptr<Player>> GetAllPlayers();
         std::vector<std::shared_ptr<Player>> GetPlayersInRange(float x, float y, float z, float range);
+        std::vector<std::shared_ptr<Player>> GetNearestPlayers(float x, float z, size_t count, float range);
         size_t                               GetPlayerCount() const;
 
+        // 플레이어 위치 변경 (INCREMENTAL 모드에서는 공간 인덱스도 함께 갱신, 없는 플레이어면 false)
+        bool MovePlayer(uint32_t player_id, float x, float y, float z, float rotation);
+
+        // 주변 탐색용 공간 인덱스 갱신 방식
+        // INCREMENTAL(기본): MovePlayer 등 이 매니저를 거친 위치 변경마다 갱신
+        // REBUILD: Update마다 전체를 다시 채움 (Player::SetPosition을 직접 부르는 코드의 이동도 반영)
+        void SetSpatialUpdateMode(SpatialUpdateMode mode);
+
         // Player creation
         std::shared_ptr<Player> CreatePlayer(const std::string& name, const MonsterPosition& position);
         std::shared_ptr<Player> CreatePlayerForClient(uint32_t               client_id,
@@ -65,6 +76,12 @@ namespace bt
         // Player storage
         OptimizedCollection<uint32_t, std::shared_ptr<Player>> players_;
 
+        // 플레이어 위치 격자 (네트워크/업데이트 스레드가 함께 쓰므로 spatial_mutex_로 보호)
+        // spatial_mutex_는 가장 안쪽 락이다 (잡은 채로 다른 락을 잡지 않는다)
+        SpatialGrid                    spatial_grid_;
+        mutable std::shared_mutex      spatial_mutex_;
+        std::atomic<SpatialUpdateMode> spatial_mode_{SpatialUpdateMode::INCREMENTAL};
+
         // Player management
         std::atomic<uint32_t> next_player_id_;
 
@@ -72,6 +89,8 @@ namespace bt
         std::atomic<bool> running_;
 
         // Helper methods
+        void IndexPlayer(const Player& player);
+        void RebuildSpatialGrid();
         void BroadcastPlayerUpdate(const std::shared_ptr<Player>& player);
         void BroadcastPlayerJoin(const std::shared_ptr<Player>& player);
         void BroadcastPlayerLeave(uint32_t player_id);
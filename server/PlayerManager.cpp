@@ -17,6 +17,7 @@ namespace bt
     {
         LOCK_PLAYERS(players_mutex_);
         players_[player->GetID()] = player;
+        spatial_grid_.Insert(player->GetID(), player->GetPosition().x, player->GetPosition().z);
         std::cout << "플레이어 추가: " << player->GetName() << " (ID: " << player->GetID() << ")" << std::endl;
     }
 
@@ -28,6 +29,7 @@ namespace bt
         {
             std::cout << "플레이어 제거: " << it->second->GetName() << " (ID: " << player_id << ")" << std::endl;
             players_.erase(it);
+            spatial_grid_.Remove(player_id);
         }
     }
 
@@ -57,21 +59,27 @@ namespace bt
     {
         std::lock_guard<std::mutex>          lock(players_mutex_);
         std::vector<std::shared_ptr<Player>> result;
-
-        for (const auto& [id, player] : players_)
-        {
-            if (!player->IsAlive())
-                continue;
-
-            auto  player_pos = player->GetPosition();
-            float distance = std::sqrt(std::pow(player_pos.x - position.x, 2) + std::pow(player_pos.y - position.y, 2) +
-                                       std::pow(player_pos.z - position.z, 2));
-
-            if (distance <= range)
-            {
-                result.push_back(player);
-            }
-        }
+        const float                          range_sq = range * range;
+
+        // 격자의 평면 반경 후보만 현재 위치의 3D 거리로 거른다 (격자는 마지막 Update 시점 위치 기준)
+        spatial_grid_.ForEachInRadius(position.x,
+                                      position.z,
+                                      range,
+                                      [&](uint32_t id, float /* distance_sq */)
+                                      {
+                                          auto it = players_.find(id);
+                                          if (it == players_.end() || !it->second->IsAlive())
+                                              return;
+
+                                          const auto& player_pos = it->second->GetPosition();
+                                          const float dx         = player_pos.x - position.x;
+                                          const float dy         = player_pos.y - position.y;
+                                          const float dz         = player_pos.z - position.z;
+                                          if (dx * dx + dy * dy + dz * dz <= range_sq)
+                                          {
+                                              result.push_back(it->second);
+                                          }
+                                      });
         return result;
     }
 
@@ -126,6 +134,7 @@ namespace bt
             client_to_player_id_[client_id] = player_id;
             player_to_client_id_[player_id] = client_id;
             players_[player_id]             = player;
+            spatial_grid_.Insert(player_id, position.x, position.z);
         }
 
         std::cout << "클라이언트용 플레이어 생성: " << name << " (ID: " << player_id << ", Client ID: " << client_id
@@ -149,6 +158,7 @@ namespace bt
                 std::cout << "클라이언트용 플레이어 제거: " << player_it->second->GetName() << " (ID: " << player_id
                           << ", Client ID: " << client_id << ")" << std::endl;
                 players_.erase(player_it);
+                spatial_grid_.Remove(player_id);
             }
 
             // 매핑 제거
@@ -262,6 +272,16 @@ namespace bt
         ProcessCombat(delta_time);
         ProcessPlayerAI(delta_time);
         ProcessPlayerRespawn(delta_time);
+
+        // 위치를 여러 경로(랜덤 이동, 리스폰, Player::SetPosition 직접 호출)에서 바꾸므로 프레임마다 다시 채운다
+        {
+            LOCK_PLAYERS(players_mutex_);
+            spatial_grid_.Clear();
+            for (const auto& [id, player] : players_)
+            {
+                spatial_grid_.Insert(id, player->GetPosition().x, player->GetPosition().z);
+            }
+        }
     }
 
     void PlayerManager::ProcessPlayerAI(float delta_time)
@@ -8,6 +8,7 @@
 
 #include "BT/Monster/MonsterTypes.h" // MonsterPosition을 위해 필요
 #include "Player.h"
+#include "World/SpatialGrid.h"
 
 namespace bt
 {
@@ -66,6 +67,7 @@ namespace bt
 
     private:
         std::unordered_map<uint32_t, std::shared_ptr<Player>> players_;
+        SpatialGrid                                           spatial_grid_; // players_mutex_로 보호
         std::unordered_map<uint32_t, uint32_t>                client_to_player_id_; // 클라이언트 ID -> 플레이어 ID
         std::unordered_map<uint32_t, uint32_t>                player_to_client_id_; // 플레이어 ID -> 클라이언트 ID
         std::atomic<uint32_t>                                 next_player_id_;
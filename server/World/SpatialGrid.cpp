@@ -0,0 +1,215 @@
+#include <algorithm>
+
+#include "SpatialGrid.h"
+
+namespace bt
+{
+
+    SpatialGrid::SpatialGrid(float cell_size)
+        : cell_size_(cell_size > 0.0f ? cell_size : 16.0f), inverse_cell_size_(1.0f / cell_size_)
+    {
+    }
+
+    void SpatialGrid::Insert(uint32_t id, float x, float z)
+    {
+        if (Move(id, x, z))
+            return;
+
+        const uint32_t entry = static_cast<uint32_t>(entries_.size());
+        entries_.push_back({id, x, z, 0, 0});
+        index_.emplace(id, entry);
+        Link(entry, CellKeyAt(x, z));
+    }
+
+    bool SpatialGrid::Move(uint32_t id, float x, float z)
+    {
+        auto it = index_.find(id);
+        if (it == index_.end())
+            return false;
+
+        const uint32_t entry = it->second;
+        entries_[entry].x    = x;
+        entries_[entry].z    = z;
+
+        const uint64_t cell = CellKeyAt(x, z);
+        if (cell != entries_[entry].cell)
+        {
+            Unlink(entry);
+            Link(entry, cell);
+        }
+        return true;
+    }
+
+    bool SpatialGrid::Remove(uint32_t id)
+    {
+        auto it = index_.find(id);
+        if (it == index_.end())
+            return false;
+
+        const uint32_t entry = it->second;
+        index_.erase(it);
+        Unlink(entry);
+
+        // 마지막 엔트리를 빈자리로 옮긴다 (칸 목록과 id 색인이 가리키는 위치도 함께 고친다)
+        const uint32_t last = static_cast<uint32_t>(entries_.size() - 1);
+        if (entry != last)
+        {
+            entries_[entry]                                       = entries_[last];
+            cells_[entries_[entry].cell][entries_[entry].in_cell] = entry;
+            index_[entries_[entry].id]                            = entry;
+        }
+        entries_.pop_back();
+        return true;
+    }
+
+    void SpatialGrid::Clear()
+    {
+        entries_.clear();
+        index_.clear();
+        occupied_cells_ = 0;
+
+        // 직전 Clear 이후 다시 채워지지 않은 칸은 버리고, 이번에 쓰인 칸의 버퍼만 남긴다
+        // (REBUILD 모드에서 보관하는 칸이 한 번이라도 쓰인 모든 칸이 아니라 직전 프레임에 쓰인 칸으로 한정된다)
+        for (auto it = cells_.begin(); it != cells_.end();)
+        {
+            if (it->second.empty())
+            {
+                it = cells_.erase(it);
+                continue;
+            }
+            it->second.clear();
+            ++it;
+        }
+    }
+
+    size_t SpatialGrid::QueryRadius(float x, float z, float radius, std::vector<Hit>& out) const
+    {
+        const size_t first = out.size();
+        ForEachInRadius(x, z, radius, [&out](uint32_t id, float distance_sq) { out.push_back({id, distance_sq}); });
+        return out.size() - first;
+    }
+
+    size_t SpatialGrid::QueryNearest(float x, float z, size_t count, float max_radius, std::vector<Hit>& out) const
+    {
+        if (count == 0 || entries_.empty() || !(max_radius >= 0.0f))
+            return 0;
+
+        const size_t first     = out.size();
+        const float  radius_sq = max_radius * max_radius;
+        size_t       seen      = 0;
+        auto         scan_cell = [&](int64_t cx, int64_t cz)
+        {
+            auto it = cells_.find(CellKey(cx, cz));
+            if (it == cells_.end())
+                return;
+            for (uint32_t entry : it->second)
+            {
+                const Entry& candidate   = entries_[entry];
+                const float  dx          = candidate.x - x;
+                const float  dz          = candidate.z - z;
+                const float  distance_sq = dx * dx + dz * dz;
+                seen++;
+                if (distance_sq <= radius_sq)
+                {
+                    out.push_back({candidate.id, distance_sq});
+                }
+            }
+        };
+        auto closer = [](const Hit& a, const Hit& b) { return a.distance_sq < b.distance_sq; };
+
+        // 중심 칸에서 바깥으로 한 링씩 넓혀 가다가, 훑지 않은 영역까지의 거리가 count번째 후보보다 멀어지면 멈춘다
+        const int64_t center_x = CellCoord(x);
+        const int64_t center_z = CellCoord(z);
+        for (int64_t ring = 0;; ++ring)
+        {
+            const double side = static_cast<double>(2 * ring + 1);
+            if (side * side > static_cast<double>(occupied_cells_))
+            {
+                // 링이 엔티티가 있는 칸 수보다 넓어지면 전체를 본다
+                out.resize(first);
+                for (const Entry& candidate : entries_)
+                {
+                    const float dx          = candidate.x - x;
+                    const float dz          = candidate.z - z;
+                    const float distance_sq = dx * dx + dz * dz;
+                    if (distance_sq <= radius_sq)
+                    {
+                        out.push_back({candidate.id, distance_sq});
+                    }
+                }
+                break;
+            }
+
+            if (ring == 0)
+            {
+                scan_cell(center_x, center_z);
+            }
+            else
+            {
+                for (int64_t cx = center_x - ring; cx <= center_x + ring; ++cx)
+                {
+                    scan_cell(cx, center_z - ring);
+                    scan_cell(cx, center_z + ring);
+                }
+                for (int64_t cz = center_z - ring + 1; cz <= center_z + ring - 1; ++cz)
+                {
+                    scan_cell(center_x - ring, cz);
+                    scan_cell(center_x + ring, cz);
+                }
+            }
+            if (seen == entries_.size())
+                break;
+
+            // 훑은 정사각형 밖의 엔티티는 적어도 border만큼 떨어져 있다
+            const float border = std::min({x - static_cast<float>(center_x - ring) * cell_size_,
+                                           static_cast<float>(center_x + ring + 1) * cell_size_ - x,
+                                           z - static_cast<float>(center_z - ring) * cell_size_,
+                                           static_cast<float>(center_z + ring + 1) * cell_size_ - z});
+            if (border > max_radius)
+                break;
+            if (out.size() - first >= count)
+            {
+                auto nth = out.begin() + static_cast<std::ptrdiff_t>(first + count - 1);
+                std::nth_element(out.begin() + static_cast<std::ptrdiff_t>(first), nth, out.end(), closer);
+                if (nth->distance_sq <= border * border)
+                    break;
+            }
+        }
+
+        const size_t found = std::min(count, out.size() - first);
+        auto         begin = out.begin() + static_cast<std::ptrdiff_t>(first);
+        std::partial_sort(begin, begin + static_cast<std::ptrdiff_t>(found), out.end(), closer);
+        out.resize(first + found);
+        return found;
+    }
+
+    void SpatialGrid::Link(uint32_t entry, uint64_t cell)
+    {
+        std::vector<uint32_t>& members = cells_[cell];
+        if (members.empty())
+        {
+            occupied_cells_++;
+        }
+        entries_[entry].cell    = cell;
+        entries_[entry].in_cell = static_cast<uint32_t>(members.size());
+        members.push_back(entry);
+    }
+
+    void SpatialGrid::Unlink(uint32_t entry)
+    {
+        auto                   it       = cells_.find(entries_[entry].cell);
+        std::vector<uint32_t>& members  = it->second;
+        const uint32_t         slot     = entries_[entry].in_cell;
+        members[slot]                   = members.back();
+        entries_[members[slot]].in_cell = slot;
+        members.pop_back();
+
+        // 비게 된 칸은 지운다 (움직이는 엔티티가 지나간 칸이 쌓이지 않도록)
+        if (members.empty())
+        {
+            cells_.erase(it);
+            occupied_cells_--;
+        }
+    }
+
+} // namespace bt
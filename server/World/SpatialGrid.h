@@ -0,0 +1,139 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace bt
+{
+
+    // 공간 인덱스 갱신 방식
+    enum class SpatialUpdateMode
+    {
+        INCREMENTAL, // 위치가 바뀐 엔티티만 갱신 (칸이 바뀔 때만 재배치, 대부분이 멈춰 있을 때 유리)
+        REBUILD      // 프레임마다 전체를 다시 채움 (대부분이 매 프레임 움직일 때 유리)
+    };
+
+    // XZ 평면 균일 격자 공간 해시 (몬스터/플레이어 주변 탐색)
+    // 엔티티 id와 평면 위치만 보관한다. 반경/최근접 질의는 주변 칸만 훑으므로 비용이 월드 전체 인구가 아니라
+    // 주변 밀도에 비례한다. 높이(y)는 쓰지 않으므로 3D 거리가 필요하면 호출자가 결과를 다시 거른다.
+    // 스레드 안전하지 않다 (소유자가 갱신과 질의를 직렬화한다).
+    class SpatialGrid
+    {
+    public:
+        struct Hit
+        {
+            uint32_t id;
+            float    distance_sq; // 평면 거리 제곱
+        };
+
+        // cell_size는 주로 쓰는 질의 반경 정도가 적당하다 (반경 질의가 3x3 칸 안팎을 훑는다)
+        explicit SpatialGrid(float cell_size = 16.0f);
+
+        // 추가 (이미 있으면 Move와 같다)
+        void Insert(uint32_t id, float x, float z);
+
+        // 위치 갱신: 같은 칸 안의 이동은 좌표만 바꾼다 (등록되지 않은 id면 false)
+        bool Move(uint32_t id, float x, float z);
+
+        bool Remove(uint32_t id);
+
+        // 모든 엔티티 제거 (이번에 쓰인 칸 버퍼는 남겨 두어 REBUILD 모드에서 프레임마다 다시 할당하지 않는다)
+        void Clear();
+
+        bool   Contains(uint32_t id) const { return index_.count(id) != 0; }
+        size_t Size() const { return entries_.size(); }
+        float  GetCellSize() const { return cell_size_; }
+        size_t GetOccupiedCellCount() const { return occupied_cells_; } // 엔티티가 있는 칸 수
+        size_t GetBucketCount() const { return cells_.size(); }         // 보관 중인 칸 버퍼 수 (빈 버퍼 포함)
+
+        // 반경 안의 엔티티를 out 뒤에 추가 (순서 없음), 추가한 수 반환
+        size_t QueryRadius(float x, float z, float radius, std::vector<Hit>& out) const;
+
+        // 가까운 순서로 최대 count개를 out 뒤에 추가 (max_radius 밖은 제외), 추가한 수 반환
+        size_t QueryNearest(float x, float z, size_t count, float max_radius, std::vector<Hit>& out) const;
+
+        // 반경 안의 엔티티마다 fn(id, distance_sq) 호출 (결과를 모으지 않는 질의용)
+        template <typename Fn>
+        void ForEachInRadius(float x, float z, float radius, Fn&& fn) const
+        {
+            if (entries_.empty() || !(radius >= 0.0f))
+                return;
+
+            const float radius_sq = radius * radius;
+            auto        visit     = [&](const Entry& entry)
+            {
+                const float dx          = entry.x - x;
+                const float dz          = entry.z - z;
+                const float distance_sq = dx * dx + dz * dz;
+                if (distance_sq <= radius_sq)
+                {
+                    fn(entry.id, distance_sq);
+                }
+            };
+
+            const int64_t min_x = CellCoord(x - radius);
+            const int64_t max_x = CellCoord(x + radius);
+            const int64_t min_z = CellCoord(z - radius);
+            const int64_t max_z = CellCoord(z + radius);
+
+            // 훑을 칸이 엔티티가 있는 칸보다 많으면 전체를 보는 편이 싸다
+            if (static_cast<double>(max_x - min_x + 1) * static_cast<double>(max_z - min_z + 1) >
+                static_cast<double>(occupied_cells_))
+            {
+                for (const Entry& entry : entries_)
+                {
+                    visit(entry);
+                }
+                return;
+            }
+
+            for (int64_t cx = min_x; cx <= max_x; ++cx)
+            {
+                for (int64_t cz = min_z; cz <= max_z; ++cz)
+                {
+                    auto it = cells_.find(CellKey(cx, cz));
+                    if (it == cells_.end())
+                        continue;
+                    for (uint32_t entry : it->second)
+                    {
+                        visit(entries_[entry]);
+                    }
+                }
+            }
+        }
+
+    private:
+        struct Entry
+        {
+            uint32_t id;
+            float    x;
+            float    z;
+            uint64_t cell;    // 속한 칸 키
+            uint32_t in_cell; // 칸 목록 안의 위치 (swap-pop 제거용)
+        };
+
+        int64_t CellCoord(float value) const { return static_cast<int64_t>(std::floor(value * inverse_cell_size_)); }
+
+        static uint64_t CellKey(int64_t cx, int64_t cz)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cz);
+        }
+        uint64_t CellKeyAt(float x, float z) const { return CellKey(CellCoord(x), CellCoord(z)); }
+
+        void Link(uint32_t entry, uint64_t cell);
+        void Unlink(uint32_t entry);
+
+        float  cell_size_;
+        float  inverse_cell_size_;
+        size_t occupied_cells_ = 0; // 비어 있지 않은 칸 수 (전체 탐색 전환 기준, Clear 직후의 빈 버퍼는 세지 않는다)
+
+        std::vector<Entry>                                  entries_; // 조밀 배열 (질의가 연속 메모리를 훑는다)
+        std::unordered_map<uint32_t, uint32_t>              index_;   // id -> entries_ 위치
+        std::unordered_map<uint64_t, std::vector<uint32_t>> cells_;   // 칸 -> entries_ 위치
+    };
+
+} // namespace bt